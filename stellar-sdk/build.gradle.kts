@@ -58,6 +58,15 @@ kotlin {
         }
     }
 
+    // Benchmarks in com.soneso.stellar.sdk.benchmark only print timings, so test tasks skip them
+    // unless the build runs with -Pbenchmark, e.g.:
+    // ./gradlew :stellar-sdk:jvmTest -Pbenchmark --tests "com.soneso.stellar.sdk.benchmark.*"
+    tasks.withType<AbstractTestTask>().configureEach {
+        if (!project.hasProperty("benchmark")) {
+            filter.excludeTestsMatching("com.soneso.stellar.sdk.benchmark.*")
+        }
+    }
+
     // Configure JS test resource processing
     tasks.named("jsTestProcessResources") {
         (this as ProcessResources).duplicatesStrategy = DuplicatesStrategy.INCLUDE
@@ -143,7 +152,8 @@ kotlin {
             dependencies {
                 implementation("io.ktor:ktor-client-cio:2.3.8")
                 implementation("org.bouncycastle:bcprov-jdk18on:1.78")
-                implementation("commons-codec:commons-codec:1.16.1")
+                // Optional: the libsodium Ed25519 provider (-Dstellar.sdk.ed25519=libsodium) needs JNA at runtime
+                compileOnly("net.java.dev.jna:jna:5.14.0")
             }
         }
 
@@ -153,6 +163,7 @@ kotlin {
                 implementation("org.junit.jupiter:junit-jupiter:5.10.2")
                 // Add SLF4J implementation to fix logging warnings
                 implementation("org.slf4j:slf4j-simple:2.0.9")
+                implementation("net.java.dev.jna:jna:5.14.0")
             }
         }
 
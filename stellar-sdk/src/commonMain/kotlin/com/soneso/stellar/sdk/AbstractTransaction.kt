@@ -1,8 +1,14 @@
 package com.soneso.stellar.sdk
 
 import com.soneso.stellar.sdk.xdr.*
-import kotlin.io.encoding.Base64
-import kotlin.io.encoding.ExperimentalEncodingApi
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.flow
+import kotlinx.coroutines.withContext
+import kotlin.concurrent.Volatile
+import kotlin.jvm.JvmName
 
 /**
  * Abstract base class for transaction classes.
@@ -42,13 +48,25 @@ import kotlin.io.encoding.ExperimentalEncodingApi
  * The network ID (SHA-256 hash of passphrase) is included in the transaction hash to prevent
  * replay attacks across different networks.
  *
+ * ## Caching
+ *
+ * The signature base, the hash and the encoded envelope are computed once and reused, so
+ * signing with several keys encodes and hashes the transaction only once:
+ * - [signatureBase], [hash] and [hashHex] depend only on the transaction body and network.
+ *   For a [FeeBumpTransaction] the body includes the inner transaction's signatures, so they
+ *   are recomputed when those change.
+ * - [toEnvelopeXdrBase64] is additionally recomputed whenever [signatures] changes.
+ *
+ * The body is treated as immutable once the transaction is built. Changes made afterwards to
+ * mutable parts of it, such as [Operation.sourceAccount] or byte arrays inside
+ * the Soroban data, are not detected; build a new transaction instead.
+ *
  * @property network The network this transaction is for
  * @property signatures List of signatures attached to this transaction (mutable)
  *
  * @see <a href="https://developers.stellar.org/docs/learn/fundamentals/transactions">Transactions</a>
  * @see <a href="https://developers.stellar.org/docs/learn/encyclopedia/security/signatures-multisig">Signatures and Multisig</a>
  */
-@OptIn(ExperimentalEncodingApi::class)
 abstract class AbstractTransaction(
     val network: Network
 ) {
@@ -60,28 +78,106 @@ abstract class AbstractTransaction(
      */
     val signatures: MutableList<DecoratedSignature> = mutableListOf()
 
+    /**
+     * A value computed for a given [key]; stale once the key no longer matches.
+     */
+    private class Cached<T>(val key: Any?, val value: T)
+
+    @Volatile
+    private var cachedSignatureBase: Cached<ByteArray>? = null
+
+    @Volatile
+    private var cachedHash: Cached<ByteArray>? = null
+
+    @Volatile
+    private var cachedEnvelope: Cached<String>? = null
+
     /**
      * Returns the signature base - the data that must be signed.
      *
      * The signature base consists of the network ID hash concatenated with the transaction XDR.
-     * This data is hashed and signed by transaction signers.
+     * This data is hashed and signed by transaction signers. It is computed once; see the
+     * caching rules on [AbstractTransaction].
+     *
+     * Subclasses outside the SDK override this to provide their signature base; [hash] is then
+     * computed from it.
      *
      * @return The signature base bytes
      */
-    abstract suspend fun signatureBase(): ByteArray
+    open suspend fun signatureBase(): ByteArray {
+        val key = signaturePayloadKey()
+        cachedSignatureBase?.let { if (it.key == key) return it.value.copyOf() }
+        val signatureBase = encodeSignatureBase()
+        cachedSignatureBase = Cached(key, signatureBase)
+        return signatureBase.copyOf()
+    }
 
     /**
      * Returns the transaction hash (SHA-256 of signature base).
      *
      * The transaction hash uniquely identifies the transaction on the network.
-     * It's also what gets signed by transaction signers.
+     * It's also what gets signed by transaction signers. It is computed once; see the
+     * caching rules on [AbstractTransaction].
      *
      * @return The 32-byte SHA-256 hash
      */
-    suspend fun hash(): ByteArray {
-        return Util.hash(signatureBase())
+    suspend fun hash(): ByteArray = cachedHash().copyOf()
+
+    /**
+     * Returns the cached hash without a defensive copy; callers must not modify it.
+     */
+    private suspend fun cachedHash(): ByteArray {
+        val key = signaturePayloadKey()
+        cachedHash?.let { if (it.key == key) return it.value }
+        val hash = computeHash()
+        cachedHash = Cached(key, hash)
+        return hash
+    }
+
+    /**
+     * Returns the tagged transaction that forms the signature payload, or null if the subclass
+     * only provides [signatureBase].
+     */
+    internal open fun taggedTransaction(): TransactionSignaturePayloadTaggedTransactionXdr? = null
+
+    /**
+     * Encodes the signature base from [taggedTransaction]. Overridden by transactions that
+     * already hold their signature payload encoded.
+     */
+    internal open suspend fun encodeSignatureBase(): ByteArray {
+        val taggedTransaction = checkNotNull(taggedTransaction()) {
+            "${this::class.simpleName} must override signatureBase()"
+        }
+        return getTransactionSignatureBase(taggedTransaction, network)
+    }
+
+    /**
+     * Computes the transaction hash. When [taggedTransaction] is available, streams the payload
+     * XDR straight into the hasher instead of materializing the signature base.
+     */
+    internal open suspend fun computeHash(): ByteArray {
+        val taggedTransaction = taggedTransaction() ?: return Util.hash(signatureBase())
+        return getTransactionHash(taggedTransaction, network)
+    }
+
+    /**
+     * Encodes the envelope returned by [toEnvelopeXdr].
+     */
+    internal open fun encodeEnvelope(): ByteArray {
+        val envelope = toEnvelopeXdr()
+        // Sizing the writer up front avoids growing and trimming the buffer
+        val writer = XdrWriter(envelope.encodedSize())
+        envelope.encode(writer)
+        return writer.toByteArray()
     }
 
+    /**
+     * Returns the mutable state, besides the transaction body, that the signature payload
+     * depends on. Cached payload values are recomputed when it no longer equals the state
+     * they were computed for.
+     */
+    internal open fun signaturePayloadKey(): Any? = null
+
     /**
      * Returns the transaction hash as a lowercase hexadecimal string.
      *
@@ -90,7 +186,7 @@ abstract class AbstractTransaction(
      * @return The transaction hash as a 64-character hex string
      */
     suspend fun hashHex(): String {
-        return Util.bytesToHex(hash()).lowercase()
+        return Util.bytesToHex(cachedHash()).lowercase()
     }
 
     /**
@@ -106,14 +202,16 @@ abstract class AbstractTransaction(
      * Returns base64-encoded TransactionEnvelope XDR.
      *
      * This is the format required when submitting transactions to Horizon or RPC servers.
+     * The result is reused until [signatures] change; see the caching rules on [AbstractTransaction].
      *
      * @return The base64-encoded envelope
      */
     fun toEnvelopeXdrBase64(): String {
-        val writer = XdrWriter()
-        toEnvelopeXdr().encode(writer)
-        val bytes = writer.toByteArray()
-        return Base64.encode(bytes)
+        val key = signaturePayloadKey() to signatures.toList()
+        cachedEnvelope?.let { if (it.key == key) return it.value }
+        val base64 = encodeBase64(encodeEnvelope())
+        cachedEnvelope = Cached(key, base64)
+        return base64
     }
 
     /**
@@ -129,11 +227,36 @@ abstract class AbstractTransaction(
      * @throws IllegalStateException if the keypair doesn't contain a private key
      */
     suspend fun sign(signer: KeyPair) {
-        val txHash = hash()
+        val txHash = cachedHash()
         val decoratedSignature = signer.signDecorated(txHash)
         signatures.add(decoratedSignature)
     }
 
+    /**
+     * Adds signatures from all [signers], signing the transaction hash concurrently.
+     *
+     * The hash is computed once and the signatures are produced in parallel on
+     * [Dispatchers.Default], which is bounded by the number of CPU cores. They are appended
+     * to [signatures] in the order of [signers], and only once all of them succeeded.
+     *
+     * Works the same for a [FeeBumpTransaction]; sign its inner transaction first, as the
+     * fee bump hash covers the inner signatures.
+     *
+     * @param signers The keypairs to sign with (must have private keys)
+     * @throws IllegalStateException if any keypair doesn't contain a private key
+     */
+    suspend fun signAll(signers: List<KeyPair>) {
+        val txHash = cachedHash()
+        val decoratedSignatures = if (signers.size <= 1) {
+            signers.map { it.signDecorated(txHash) }
+        } else {
+            withContext(Dispatchers.Default) {
+                signers.map { signer -> async { signer.signDecorated(txHash) } }.awaitAll()
+            }
+        }
+        signatures.addAll(decoratedSignatures)
+    }
+
     /**
      * Adds a hash(x) signature by revealing the preimage.
      *
@@ -150,6 +273,21 @@ abstract class AbstractTransaction(
         signatures.add(DecoratedSignature(hint, preimage))
     }
 
+    /**
+     * Matches the [signatures] of this transaction to the given signers and verifies them.
+     *
+     * Each signature is only checked against the signers whose hint it carries, and all
+     * Ed25519 signatures are verified in one batch, so the cost grows with the number of
+     * signatures rather than signatures times signers. Covers all signer kinds: Ed25519 keys,
+     * pre-authorized transaction hashes, hash(x) preimages and Ed25519 signed payloads.
+     *
+     * @param signers The signers of the account to check against, typically its current signer set
+     * @return The signers that authorized this transaction and the signatures matching none of them
+     */
+    suspend fun verifySignatures(signers: Collection<SignerKey>): SignatureVerification {
+        return SignatureVerification.verify(cachedHash(), signatures.toList(), signers)
+    }
+
     companion object {
         /**
          * Minimum base fee per operation in stroops (0.00001 XLM).
@@ -162,6 +300,10 @@ abstract class AbstractTransaction(
          */
         const val MIN_BASE_FEE = 100L
 
+        // Envelopes per chunk and chunks in flight when decoding envelope streams
+        private const val ENVELOPE_DECODE_CHUNK_SIZE = 256
+        private const val ENVELOPE_DECODE_PARALLELISM = 8
+
         /**
          * Creates an AbstractTransaction from a base64-encoded transaction envelope XDR.
          *
@@ -172,7 +314,7 @@ abstract class AbstractTransaction(
          */
         fun fromEnvelopeXdr(envelope: String, network: Network): AbstractTransaction {
             val bytes = try {
-                Base64.decode(envelope)
+                decodeBase64(envelope)
             } catch (e: Exception) {
                 throw IllegalArgumentException("Invalid base64 encoding: ${e.message}", e)
             }
@@ -211,6 +353,79 @@ abstract class AbstractTransaction(
             }
         }
 
+        /**
+         * Decodes a stream of base64-encoded transaction envelopes, for example the `envelopeXdr`
+         * of every transaction returned by `getTransactions` while ingesting history.
+         *
+         * Envelopes are collected in chunks of [chunkSize] and each chunk is decoded on
+         * [Dispatchers.Default]. At most [parallelism] chunks are decoded at the same time, which
+         * also bounds how far collection runs ahead of the consumer. Transactions are emitted in
+         * the order of [envelopes]; a malformed envelope fails the flow after the transactions
+         * before it were emitted.
+         *
+         * ```kotlin
+         * val transactions = AbstractTransaction.fromEnvelopeXdrs(
+         *     response.transactions.asFlow().map { it.envelopeXdr },
+         *     Network.PUBLIC
+         * )
+         * transactions.collect { store(it) }
+         * ```
+         *
+         * @param envelopes The base64-encoded envelopes
+         * @param network The network the transactions are for
+         * @param chunkSize How many envelopes are decoded together
+         * @param parallelism How many chunks are decoded at the same time
+         * @return The decoded transactions, in input order
+         */
+        fun fromEnvelopeXdrs(
+            envelopes: Flow<String>,
+            network: Network,
+            chunkSize: Int = ENVELOPE_DECODE_CHUNK_SIZE,
+            parallelism: Int = ENVELOPE_DECODE_PARALLELISM
+        ): Flow<AbstractTransaction> = decodeEnvelopes(envelopes, chunkSize, parallelism) {
+            fromEnvelopeXdr(it, network)
+        }
+
+        /**
+         * Decodes a stream of transaction envelopes in XDR bytes; see the [String] overload.
+         *
+         * @param envelopes The envelopes in XDR bytes
+         * @param network The network the transactions are for
+         * @param chunkSize How many envelopes are decoded together
+         * @param parallelism How many chunks are decoded at the same time
+         * @return The decoded transactions, in input order
+         */
+        @JvmName("fromEnvelopeXdrBytes")
+        fun fromEnvelopeXdrs(
+            envelopes: Flow<ByteArray>,
+            network: Network,
+            chunkSize: Int = ENVELOPE_DECODE_CHUNK_SIZE,
+            parallelism: Int = ENVELOPE_DECODE_PARALLELISM
+        ): Flow<AbstractTransaction> = decodeEnvelopes(envelopes, chunkSize, parallelism) {
+            fromEnvelopeXdr(it, network)
+        }
+
+        private fun <T> decodeEnvelopes(
+            envelopes: Flow<T>,
+            chunkSize: Int,
+            parallelism: Int,
+            decode: (T) -> AbstractTransaction
+        ): Flow<AbstractTransaction> {
+            require(chunkSize > 0) { "Chunk size must be positive, got $chunkSize" }
+            val chunks = flow {
+                var chunk = ArrayList<T>(chunkSize)
+                envelopes.collect { envelope ->
+                    chunk.add(envelope)
+                    if (chunk.size == chunkSize) {
+                        emit(chunk)
+                        chunk = ArrayList(chunkSize)
+                    }
+                }
+                if (chunk.isNotEmpty()) emit(chunk)
+            }
+            return chunks.flatMapOrderedConcurrently(parallelism, Dispatchers.Default) { chunk -> chunk.map(decode) }
+        }
+
         /**
          * Helper method to get the signature base for a transaction.
          *
@@ -231,9 +446,30 @@ abstract class AbstractTransaction(
                 networkId = networkId,
                 taggedTransaction = taggedTransaction
             )
-            val writer = XdrWriter()
+            val writer = XdrWriter(payload.encodedSize())
             payload.encode(writer)
             return writer.toByteArray()
         }
+
+        /**
+         * Helper method to get the hash of a transaction's signature base.
+         *
+         * Equivalent to hashing [getTransactionSignatureBase], but the payload is encoded
+         * directly into an incremental SHA-256 hasher without building the signature base.
+         *
+         * @param taggedTransaction The tagged transaction XDR
+         * @param network The network for this transaction
+         * @return The 32-byte transaction hash
+         */
+        internal suspend fun getTransactionHash(
+            taggedTransaction: TransactionSignaturePayloadTaggedTransactionXdr,
+            network: Network
+        ): ByteArray {
+            val payload = TransactionSignaturePayloadXdr(
+                networkId = HashXdr(network.networkId()),
+                taggedTransaction = taggedTransaction
+            )
+            return Util.hashXdr { writer -> payload.encode(writer) }
+        }
     }
 }
@@ -88,13 +88,8 @@ sealed class Asset : Comparable<Asset> {
             )
         )
 
-        // Serialize to XDR bytes
-        val writer = XdrWriter()
-        preimage.encode(writer)
-        val xdrBytes = writer.toByteArray()
-
-        // Hash the preimage
-        val rawContractId = Util.hash(xdrBytes)
+        // Hash the XDR-encoded preimage
+        val rawContractId = Util.hashXdr { writer -> preimage.encode(writer) }
 
         // Encode as contract address (C...)
         return StrKey.encodeContract(rawContractId)
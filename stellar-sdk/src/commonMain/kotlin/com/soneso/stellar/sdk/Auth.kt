@@ -210,7 +210,7 @@ object Auth {
         network: Network
     ): SorobanAuthorizationEntryXdr {
         val entrySigner = Signer { preimage ->
-            val payload = Util.hash(preimage.toXdrByteArray())
+            val payload = Util.hashXdr { writer -> preimage.encode(writer) }
             val signature = signer.sign(payload)
             Signature(signer.getAccountId(), signature)
         }
@@ -417,7 +417,7 @@ object Auth {
         preimage: HashIDPreimageXdr,
         signature: Signature
     ) {
-        val payload = Util.hash(preimage.toXdrByteArray())
+        val payload = Util.hashXdr { writer -> preimage.encode(writer) }
         val keyPair = KeyPair.fromAccountId(signature.publicKey)
 
         if (!keyPair.verify(payload, signature.signature)) {
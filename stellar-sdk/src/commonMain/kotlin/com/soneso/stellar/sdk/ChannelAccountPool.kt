@@ -0,0 +1,176 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.channels.Channel
+import kotlin.concurrent.atomics.AtomicBoolean
+import kotlin.concurrent.atomics.ExperimentalAtomicApi
+
+/**
+ * Pool of channel accounts whose sequence numbers are tracked locally.
+ *
+ * Submitting many transactions from one account serializes them on its sequence number, and
+ * loading the account before every transaction adds a network round trip. Channel accounts
+ * solve both: each transaction uses a channel account as its source, while the operations
+ * keep their own source account, so transactions on different channels can be in flight
+ * at the same time.
+ *
+ * A channel is leased exclusively to one coroutine at a time, so its sequence number is
+ * incremented locally without locking. It is loaded with [loadSequenceNumber] on first use
+ * and afterwards only when it has been marked stale with [ChannelAccount.markBadSequence],
+ * typically after a `tx_bad_seq` result. When every channel is leased, callers suspend until
+ * one is released.
+ *
+ * ```kotlin
+ * val pool = ChannelAccountPool(channelKeyPairs) { accountId ->
+ *     horizonServer.loadAccount(accountId).sequenceNumber
+ * }
+ *
+ * pool.withChannel { channel ->
+ *     val transaction = TransactionBuilder(channel, Network.PUBLIC)
+ *         .addOperation(PaymentOperation(destination, AssetTypeNative, "10").apply {
+ *             sourceAccount = treasury.getAccountId()
+ *         })
+ *         .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+ *         .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, deadline)))
+ *         .build()
+ *     transaction.signAll(listOf(channel.keypair, treasury))
+ *     val response = horizonServer.submitTransactionAsync(transaction.toEnvelopeXdrBase64())
+ *     // isBadSequence: the result code in response.errorResultXdr is txBAD_SEQ
+ *     if (isBadSequence(response)) channel.markBadSequence()
+ * }
+ * ```
+ *
+ * @param channels Keypairs of the channel accounts; they must be distinct
+ * @param loadSequenceNumber Loads the current sequence number of a channel account from the network
+ */
+class ChannelAccountPool(
+    channels: List<KeyPair>,
+    private val loadSequenceNumber: suspend (accountId: String) -> Long
+) {
+    // A channel taken by an acquire() that is cancelled before it resumes goes back to the pool
+    private val idle: Channel<ChannelAccount> = Channel(Channel.UNLIMITED) { channel -> idle.trySend(channel) }
+
+    /**
+     * The number of channel accounts in the pool.
+     */
+    val size: Int = channels.size
+
+    init {
+        require(channels.isNotEmpty()) { "At least one channel account required" }
+        require(channels.map { it.getAccountId() }.toSet().size == channels.size) {
+            "Channel accounts must be distinct"
+        }
+        channels.forEach { idle.trySend(ChannelAccount(this, it)) }
+    }
+
+    /**
+     * Leases an idle channel account, suspending until one is available.
+     *
+     * The channel's sequence number is loaded first if it is not known yet or was marked stale.
+     * The channel must be returned with [release].
+     *
+     * @return The leased channel account
+     */
+    @OptIn(ExperimentalAtomicApi::class)
+    suspend fun acquire(): ChannelAccount {
+        val channel = idle.receive()
+        channel.leased.store(true)
+        try {
+            channel.synchronize(loadSequenceNumber)
+        } catch (e: Throwable) {
+            release(channel)
+            throw e
+        }
+        return channel
+    }
+
+    /**
+     * Returns a leased channel account to the pool.
+     *
+     * @param channel A channel account obtained from [acquire] on this pool
+     * @throws IllegalStateException if the channel account is not leased, e.g. released twice
+     */
+    @OptIn(ExperimentalAtomicApi::class)
+    fun release(channel: ChannelAccount) {
+        require(channel.pool === this) { "Channel account ${channel.accountId} does not belong to this pool" }
+        check(channel.leased.compareAndSet(expectedValue = true, newValue = false)) {
+            "Channel account ${channel.accountId} is not leased"
+        }
+        idle.trySend(channel)
+    }
+
+    /**
+     * Runs [block] with a leased channel account and releases it afterwards.
+     *
+     * If [block] throws, the transaction may or may not have reached the network, so the
+     * channel's sequence number is reloaded before its next use.
+     *
+     * @param block Builds and submits a transaction with the channel as source account
+     * @return The result of [block]
+     */
+    suspend fun <T> withChannel(block: suspend (ChannelAccount) -> T): T {
+        val channel = acquire()
+        try {
+            return block(channel)
+        } catch (e: Throwable) {
+            channel.markBadSequence()
+            throw e
+        } finally {
+            release(channel)
+        }
+    }
+}
+
+/**
+ * Channel account leased from a [ChannelAccountPool].
+ *
+ * Used as the source account of a [TransactionBuilder], which increments the local sequence
+ * number on every build. Only the coroutine holding the lease may use it.
+ */
+@OptIn(ExperimentalAtomicApi::class)
+class ChannelAccount internal constructor(
+    internal val pool: ChannelAccountPool,
+    override val keypair: KeyPair
+) : TransactionBuilderAccount {
+    override val accountId: String = keypair.getAccountId()
+
+    // True between acquire and release; guards against releasing a channel twice
+    internal val leased = AtomicBoolean(false)
+
+    private var _sequenceNumber: Long = 0
+
+    // False until loaded, and again after markBadSequence
+    private var sequenceNumberLoaded = false
+
+    override val sequenceNumber: Long
+        get() = _sequenceNumber
+
+    override fun setSequenceNumber(seqNum: Long) {
+        _sequenceNumber = seqNum
+    }
+
+    override fun getIncrementedSequenceNumber(): Long {
+        return _sequenceNumber + 1
+    }
+
+    override fun incrementSequenceNumber() {
+        _sequenceNumber++
+    }
+
+    /**
+     * Marks the local sequence number as stale, for example after a `tx_bad_seq` result.
+     * It is reloaded from the network the next time the channel is leased.
+     */
+    fun markBadSequence() {
+        sequenceNumberLoaded = false
+    }
+
+    internal suspend fun synchronize(loadSequenceNumber: suspend (accountId: String) -> Long) {
+        if (sequenceNumberLoaded) return
+        _sequenceNumber = loadSequenceNumber(accountId)
+        sequenceNumberLoaded = true
+    }
+
+    override fun toString(): String {
+        return "ChannelAccount(accountId='$accountId', sequenceNumber=$_sequenceNumber)"
+    }
+}
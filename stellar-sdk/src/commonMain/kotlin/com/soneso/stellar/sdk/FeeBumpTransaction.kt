@@ -1,7 +1,6 @@
 package com.soneso.stellar.sdk
 
 import com.soneso.stellar.sdk.xdr.*
-import kotlin.io.encoding.Base64
 
 /**
  * Represents a [Fee Bump Transaction](https://github.com/stellar/stellar-protocol/blob/master/core/cap-0015.md) in the Stellar network.
@@ -113,21 +112,15 @@ class FeeBumpTransaction private constructor(
         )
     }
 
-    /**
-     * Returns the signature base for this fee bump transaction.
-     *
-     * The signature base is the data that must be signed by the fee source account.
-     * It includes the network ID and the transaction data.
-     *
-     * @return The bytes to sign
-     */
-    override suspend fun signatureBase(): ByteArray {
-        val taggedTransaction = TransactionSignaturePayloadTaggedTransactionXdr.FeeBump(
+    override fun taggedTransaction(): TransactionSignaturePayloadTaggedTransactionXdr {
+        return TransactionSignaturePayloadTaggedTransactionXdr.FeeBump(
             toXdr()
         )
-        return getTransactionSignatureBase(taggedTransaction, network)
     }
 
+    // The inner envelope, including its signatures, is part of the signed payload
+    override fun signaturePayloadKey(): Any = innerTransaction.signatures.toList()
+
     /**
      * Generates the transaction envelope XDR object for submission to the network.
      *
@@ -317,9 +310,8 @@ class FeeBumpTransaction private constructor(
          * @return The decoded FeeBumpTransaction
          * @throws IllegalArgumentException if the envelope is not a fee bump transaction
          */
-        @OptIn(kotlin.io.encoding.ExperimentalEncodingApi::class)
         fun fromEnvelopeXdrBase64(envelope: String, network: Network): FeeBumpTransaction {
-            val bytes = Base64.decode(envelope)
+            val bytes = decodeBase64(envelope)
             val reader = XdrReader(bytes)
             val xdr = TransactionEnvelopeXdr.decode(reader)
 
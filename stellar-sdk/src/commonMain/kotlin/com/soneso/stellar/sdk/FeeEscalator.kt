@@ -0,0 +1,282 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.horizon.responses.FeeStatsResponse
+import com.soneso.stellar.sdk.rpc.responses.GetFeeStatsResponse
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.delay
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Wraps submitted transactions that do not get included in fee bumps with rising fees.
+ *
+ * Each call to [track] registers a transaction that has already been submitted and suspends
+ * until it was included in a ledger or expired. Every [pollInterval], [run] loads the current
+ * network fees and checks each tracked transaction. When a transaction is still pending
+ * [escalateAfterLedgers] ledgers after its last submission, it is wrapped in a fee bump paid
+ * by [feeSource] and submitted again.
+ *
+ * The fee per operation of a bump is the network fee from [loadNetworkFees], but at least
+ * [REPLACEMENT_FEE_MULTIPLIER] times the fee of the version already submitted: the network
+ * only replaces a queued transaction with a fee bump paying that much more. Only one version
+ * of a transaction can be included, so [maxFee] caps the total fee spent on it; once the next
+ * bump would exceed it, the transaction is no longer escalated but still tracked.
+ *
+ * ```kotlin
+ * val escalator = FeeEscalator(
+ *     feeSource = feeAccount,
+ *     maxFee = 1_000_000,
+ *     loadNetworkFees = { NetworkFees.fromFeeStats(horizonServer.feeStats().execute(), percentile = 90) },
+ *     isIncluded = { tx -> runCatching { horizonServer.transactions().transaction(tx.hashHex()) }.isSuccess },
+ *     submitTransaction = { tx -> horizonServer.submitTransactionAsync(tx.toEnvelopeXdrBase64()) }
+ * )
+ * launch { escalator.run() }
+ *
+ * horizonServer.submitTransactionAsync(transaction.toEnvelopeXdrBase64())
+ * val escalation = escalator.track(transaction)
+ * ```
+ *
+ * @param feeSource The account paying the fee bumps; it signs every fee bump
+ * @param maxFee Highest total fee in stroops of one fee bump
+ * @param escalateAfterLedgers How many ledgers a submitted version may stay pending before it is bumped
+ * @param pollInterval How often network fees and pending transactions are checked
+ * @param loadNetworkFees Loads the latest ledger and the current fee per operation
+ * @param isIncluded Returns true once the transaction, or a fee bump wrapping it, was included
+ *   in a ledger, successfully or not. Called with the inner transaction; Horizon finds fee
+ *   bumps by the hash of their inner transaction.
+ * @param submitTransaction Submits a fee bump
+ */
+class FeeEscalator(
+    private val feeSource: KeyPair,
+    private val maxFee: Long,
+    private val escalateAfterLedgers: Int = 3,
+    private val pollInterval: Duration = 5.seconds,
+    private val loadNetworkFees: suspend () -> NetworkFees,
+    private val isIncluded: suspend (Transaction) -> Boolean,
+    private val submitTransaction: suspend (FeeBumpTransaction) -> Unit
+) {
+    private class Tracked(val transaction: Transaction) {
+        val result = CompletableDeferred<FeeEscalation>()
+        var current: AbstractTransaction = transaction
+        var baseFee: Long = transaction.inclusionFeePerOperation()
+        var feeBumps = 0
+
+        // Latest ledger when the current version was submitted, or null before the first poll
+        var submittedLedger: Long? = null
+    }
+
+    private val inbox = RunnerInbox<Tracked>("Fee escalator stopped while the transaction was tracked") { it.result }
+
+    init {
+        require(feeSource.canSign()) { "Fee source keypair must contain a private key" }
+        require(maxFee >= AbstractTransaction.MIN_BASE_FEE) {
+            "Maximum fee must be at least ${AbstractTransaction.MIN_BASE_FEE} stroops, got $maxFee"
+        }
+        require(escalateAfterLedgers > 0) { "Ledgers before escalation must be positive, got $escalateAfterLedgers" }
+        require(pollInterval.isPositive()) { "Poll interval must be positive, got $pollInterval" }
+    }
+
+    /**
+     * Tracks a submitted transaction and suspends until it was included or expired.
+     *
+     * @param transaction The signed transaction, already submitted
+     * @return The version that was submitted last and how often it was bumped
+     * @throws IllegalStateException if the escalator has been closed
+     * @throws Exception whatever checking, signing or submitting the transaction threw
+     */
+    suspend fun track(transaction: Transaction): FeeEscalation {
+        val tracked = Tracked(transaction)
+        check(inbox.trySend(tracked)) { "Fee escalator is closed" }
+        return tracked.result.await()
+    }
+
+    /**
+     * Stops accepting transactions. [run] keeps tracking the transactions already registered
+     * and returns once all of them were included or expired.
+     */
+    fun close() {
+        inbox.close()
+    }
+
+    /**
+     * Checks and escalates tracked transactions until [close] is called and none is pending.
+     *
+     * Launch it in a scope that outlives the callers of [track]. If [loadNetworkFees] throws,
+     * the round is skipped and the poll interval doubles, up to [MAX_BACKOFF_FACTOR] times,
+     * until fees load again. Cancelling it fails the transactions still tracked.
+     */
+    suspend fun run() {
+        val pending = mutableListOf<Tracked>()
+        var backoff = 1
+        try {
+            while (true) {
+                if (pending.isEmpty()) {
+                    pending.add(inbox.receiveOrNull() ?: return)
+                }
+                delay(pollInterval * backoff)
+                while (true) {
+                    pending.add(inbox.tryReceive() ?: break)
+                }
+
+                val fees = try {
+                    loadNetworkFees()
+                } catch (e: CancellationException) {
+                    throw e
+                } catch (e: Exception) {
+                    backoff = minOf(backoff * 2, MAX_BACKOFF_FACTOR)
+                    continue
+                }
+                backoff = 1
+                val nowSeconds = TransactionBuilder.currentTimeMillis() / 1000L
+                val iterator = pending.iterator()
+                while (iterator.hasNext()) {
+                    val tracked = iterator.next()
+                    val done = try {
+                        poll(tracked, fees, nowSeconds)
+                    } catch (e: Throwable) {
+                        inbox.fail(tracked, e)
+                        if (e is CancellationException) throw e
+                        true
+                    }
+                    if (done) iterator.remove()
+                }
+            }
+        } finally {
+            inbox.stop(pending)
+        }
+    }
+
+    /**
+     * Checks one transaction and bumps it if due; returns true once it is no longer pending.
+     */
+    private suspend fun poll(tracked: Tracked, fees: NetworkFees, nowSeconds: Long): Boolean {
+        if (isIncluded(tracked.transaction)) {
+            tracked.result.complete(FeeEscalation(tracked.current, tracked.feeBumps, included = true))
+            return true
+        }
+        val maxTime = tracked.transaction.preconditions.timeBounds?.maxTime ?: 0L
+        if (maxTime != 0L && nowSeconds > maxTime) {
+            tracked.result.complete(FeeEscalation(tracked.current, tracked.feeBumps, included = false))
+            return true
+        }
+
+        val submittedLedger = tracked.submittedLedger
+        if (submittedLedger == null) {
+            tracked.submittedLedger = fees.latestLedger
+            return false
+        }
+        if (fees.latestLedger - submittedLedger < escalateAfterLedgers) return false
+
+        val baseFee = maxOf(fees.baseFee, tracked.baseFee * REPLACEMENT_FEE_MULTIPLIER)
+        val operations = tracked.transaction.operations.size + 1
+        val resourceFee = tracked.transaction.sorobanData?.resourceFee?.value ?: 0L
+        if (baseFee > (maxFee - resourceFee) / operations) return false
+
+        val feeBump = FeeBumpTransactionBuilder(tracked.transaction)
+            .setFeeSource(feeSource.getAccountId())
+            .setBaseFee(baseFee)
+            .build()
+        feeBump.sign(feeSource)
+        submitTransaction(feeBump)
+
+        tracked.current = feeBump
+        tracked.baseFee = baseFee
+        tracked.feeBumps++
+        tracked.submittedLedger = fees.latestLedger
+        return false
+    }
+
+    companion object {
+        /**
+         * How many times the fee per operation of the queued version a fee bump must pay to replace it.
+         */
+        const val REPLACEMENT_FEE_MULTIPLIER = 10L
+
+        /**
+         * The longest wait between retries of [loadNetworkFees], in poll intervals.
+         */
+        const val MAX_BACKOFF_FACTOR = 32
+    }
+}
+
+// Fee per operation excluding the Soroban resource fee, rounded up
+private fun Transaction.inclusionFeePerOperation(): Long {
+    val inclusionFee = fee - (sorobanData?.resourceFee?.value ?: 0L)
+    return (inclusionFee + operations.size - 1) / operations.size
+}
+
+/**
+ * Network state used by [FeeEscalator] to decide whether and how much to bump.
+ *
+ * @property latestLedger The sequence number of the latest ledger
+ * @property baseFee The fee per operation a transaction should offer to be included, in stroops
+ */
+data class NetworkFees(val latestLedger: Long, val baseFee: Long) {
+    companion object {
+        /**
+         * Takes the fee from a percentile of the fees charged in recent ledgers, as reported by Horizon.
+         *
+         * @param stats The response of [com.soneso.stellar.sdk.horizon.HorizonServer.feeStats]
+         * @param percentile One of 10, 20, ..., 90, 95 and 99
+         * @return The network fees
+         */
+        fun fromFeeStats(stats: FeeStatsResponse, percentile: Int = 90): NetworkFees {
+            val fees = stats.feeCharged
+            val fee = percentile(
+                percentile,
+                longArrayOf(
+                    fees.p10, fees.p20, fees.p30, fees.p40, fees.p50, fees.p60,
+                    fees.p70, fees.p80, fees.p90, fees.p95, fees.p99
+                )
+            )
+            return NetworkFees(stats.lastLedger, maxOf(fee, stats.lastLedgerBaseFee))
+        }
+
+        /**
+         * Takes the fee from a percentile of the inclusion fees of classic transactions, as
+         * reported by Soroban RPC.
+         *
+         * @param stats The response of [com.soneso.stellar.sdk.rpc.SorobanServer.getFeeStats]
+         * @param percentile One of 10, 20, ..., 90, 95 and 99
+         * @return The network fees
+         */
+        fun fromFeeStats(stats: GetFeeStatsResponse, percentile: Int = 90): NetworkFees {
+            val fees = stats.inclusionFee
+            val fee = percentile(
+                percentile,
+                longArrayOf(
+                    fees.p10, fees.p20, fees.p30, fees.p40, fees.p50, fees.p60,
+                    fees.p70, fees.p80, fees.p90, fees.p95, fees.p99
+                )
+            )
+            return NetworkFees(stats.latestLedger, maxOf(fee, AbstractTransaction.MIN_BASE_FEE))
+        }
+
+        private val PERCENTILES = intArrayOf(10, 20, 30, 40, 50, 60, 70, 80, 90, 95, 99)
+
+        private fun percentile(percentile: Int, values: LongArray): Long {
+            val index = PERCENTILES.indexOf(percentile)
+            require(index >= 0) { "Unsupported percentile: $percentile" }
+            return values[index]
+        }
+    }
+}
+
+/**
+ * Outcome of a transaction tracked by a [FeeEscalator].
+ *
+ * @property transaction The version submitted last: the original transaction or its latest fee bump.
+ *   An earlier version may have been included instead.
+ * @property feeBumps How many fee bumps were submitted
+ * @property included True if the transaction was included in a ledger, false if it expired
+ */
+class FeeEscalation internal constructor(
+    val transaction: AbstractTransaction,
+    val feeBumps: Int,
+    val included: Boolean
+) {
+    override fun toString(): String {
+        return "FeeEscalation(feeBumps=$feeBumps, included=$included)"
+    }
+}
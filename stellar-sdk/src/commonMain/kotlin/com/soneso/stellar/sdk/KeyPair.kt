@@ -1,9 +1,11 @@
 package com.soneso.stellar.sdk
 
+import com.soneso.stellar.sdk.crypto.Ed25519SigningKey
 import com.soneso.stellar.sdk.crypto.getEd25519Crypto
 import com.soneso.stellar.sdk.xdr.AccountIDXdr
 import com.soneso.stellar.sdk.xdr.PublicKeyXdr
 import com.soneso.stellar.sdk.xdr.Uint256Xdr
+import kotlin.concurrent.Volatile
 import kotlin.jvm.JvmStatic
 
 /**
@@ -51,6 +53,14 @@ import kotlin.jvm.JvmStatic
  * KeyPair instances are immutable and thread-safe. The underlying cryptographic
  * operations are also thread-safe.
  *
+ * ## Signing Performance
+ *
+ * The first signature is made one-shot from the secret seed. The second call to [sign] or
+ * [signDecorated] expands the seed into a long-lived [Ed25519SigningKey] (see
+ * [com.soneso.stellar.sdk.crypto.Ed25519Crypto.prepareSigner]), which later signatures with
+ * the same KeyPair reuse to skip the key derivation. A KeyPair that signs only once, such as a
+ * freshly generated one, never holds an expanded key in platform memory.
+ *
  * @see <a href="https://tools.ietf.org/html/rfc8032">RFC 8032 - Edwards-Curve Digital Signature Algorithm (EdDSA)</a>
  * @see <a href="https://libsodium.gitbook.io/doc/">libsodium documentation</a>
  * @see <a href="https://www.bouncycastle.org/">BouncyCastle</a>
@@ -239,6 +249,16 @@ class KeyPair private constructor(
      */
     fun canSign(): Boolean = privateKey != null
 
+    /**
+     * Expanded signing key, prepared by the second signature. Concurrent calls may each
+     * prepare a key; one of them wins and the others are released by the platform.
+     */
+    @Volatile
+    private var signingKey: Ed25519SigningKey? = null
+
+    @Volatile
+    private var hasSigned = false
+
     /**
      * Returns the human-readable account ID encoded in strkey (G...).
      */
@@ -286,10 +306,15 @@ class KeyPair private constructor(
      * @throws IllegalStateException if the private key for this keypair is null
      */
     suspend fun sign(data: ByteArray): ByteArray {
+        signingKey?.let { return it.sign(data) }
         val key = privateKey ?: throw IllegalStateException(
             "KeyPair does not contain secret key. Use KeyPair.fromSecretSeed method to create a new KeyPair with a secret key."
         )
-        return crypto.sign(data, key)
+        if (!hasSigned) {
+            hasSigned = true
+            return crypto.sign(data, key)
+        }
+        return crypto.prepareSigner(key).also { signingKey = it }.sign(data)
     }
 
     /**
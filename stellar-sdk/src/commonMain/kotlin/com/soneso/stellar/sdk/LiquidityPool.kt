@@ -60,10 +60,7 @@ data class LiquidityPool(
      * @return The liquidity pool ID as a hex string (lowercase)
      */
     suspend fun getLiquidityPoolId(): String {
-        val writer = XdrWriter()
-        toXdr().encode(writer)
-        val xdrBytes = writer.toByteArray()
-        val poolId = Util.hash(xdrBytes)
+        val poolId = Util.hashXdr { writer -> toXdr().encode(writer) }
         return Util.bytesToHex(poolId).lowercase()
     }
 
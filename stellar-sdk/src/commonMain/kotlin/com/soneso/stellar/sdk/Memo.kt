@@ -96,7 +96,7 @@ class MemoText : Memo {
      * @throws IllegalArgumentException if the UTF-8 encoded text exceeds 28 bytes
      */
     constructor(text: String) {
-        val encodedBytes = text.encodeToByteArray()
+        val encodedBytes = xdrEncodeUtf8(text)
         require(encodedBytes.size <= 28) {
             "Text memo cannot be more than 28 bytes. The provided text is ${encodedBytes.size} bytes when UTF-8 encoded."
         }
@@ -1,5 +1,7 @@
 package com.soneso.stellar.sdk
 
+import kotlin.concurrent.Volatile
+
 /**
  * Network class is used to specify which Stellar network you want to use.
  * Each network has a [networkPassphrase] which is hashed to every transaction id.
@@ -13,13 +15,19 @@ data class Network(val networkPassphrase: String) {
         require(networkPassphrase.isNotBlank()) { "Network passphrase cannot be blank" }
     }
 
+    @Volatile
+    private var cachedNetworkId: ByteArray? = null
+
     /**
      * Returns network id (SHA-256 hashed [networkPassphrase]).
      *
+     * The hash is computed on first use and a copy is returned on every call.
+     *
      * @return The 32-byte network ID
      */
     suspend fun networkId(): ByteArray {
-        return Util.hash(networkPassphrase.encodeToByteArray())
+        val networkId = cachedNetworkId ?: Util.hash(networkPassphrase.encodeToByteArray()).also { cachedNetworkId = it }
+        return networkId.copyOf()
     }
 
     override fun toString(): String = networkPassphrase
@@ -0,0 +1,219 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.xdr.*
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.launch
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Coalesces individual payments into transactions of up to 100 operations.
+ *
+ * Each call to [pay] queues one payment and suspends until the transaction carrying it has
+ * been submitted. Payments are grouped by memo, since a transaction has a single memo. A group
+ * is submitted as soon as it holds as many payments as one transaction can carry within the
+ * operation and fee limits, and otherwise [flushInterval] after its first payment was queued.
+ * Transactions use channel accounts from [channels] as source, so several batches can be in
+ * flight at the same time.
+ *
+ * Payments keep their own source account; set [Operation.sourceAccount] to the paying account
+ * and include its keypair in [signers].
+ *
+ * ```kotlin
+ * val batcher = PaymentBatcher(pool, Network.PUBLIC, baseFee = 200, signers = listOf(treasury)) { tx ->
+ *     val response = horizonServer.submitTransaction(tx.toEnvelopeXdrBase64())
+ *     TransactionResultXdr.decode(XdrReader(Base64.decode(response.resultXdr!!)))
+ * }
+ * launch { batcher.run() }
+ *
+ * val result = batcher.pay(PaymentOperation(destination, AssetTypeNative, "10").apply {
+ *     sourceAccount = treasury.getAccountId()
+ * })
+ * ```
+ *
+ * @param channels Pool of channel accounts used as transaction source accounts
+ * @param network The network transactions are built for
+ * @param baseFee The fee per operation in stroops
+ * @param signers Keypairs signing every transaction besides the channel account, typically
+ *   the source accounts of the payments
+ * @param flushInterval How long payments are collected before a batch is submitted
+ * @param maxFee Highest total fee of one transaction in stroops; limits the operations per
+ *   transaction to `maxFee / baseFee`
+ * @param timeout Validity of each transaction in seconds, from the time it is built
+ * @param submitTransaction Submits a signed transaction and returns its result
+ */
+class PaymentBatcher(
+    private val channels: ChannelAccountPool,
+    private val network: Network,
+    private val baseFee: Long,
+    private val signers: List<KeyPair> = emptyList(),
+    private val flushInterval: Duration = 1.seconds,
+    maxFee: Long = baseFee * Transaction.MAX_OPERATIONS,
+    private val timeout: Long = 30,
+    private val submitTransaction: suspend (Transaction) -> TransactionResultXdr
+) {
+    private sealed class Entry {
+        class Payment(val payment: PaymentOperation, val memo: Memo) : Entry() {
+            val result = CompletableDeferred<PaymentBatchResult>()
+        }
+
+        class Flush(val generation: Int) : Entry()
+    }
+
+    private val inbox = RunnerInbox<Entry>("Payment batcher stopped before the payment was submitted") { entry ->
+        (entry as? Entry.Payment)?.result
+    }
+
+    /**
+     * The most operations one transaction carries, given the operation limit and the maximum fee.
+     */
+    val maxOperationsPerTransaction: Int
+
+    init {
+        require(baseFee >= AbstractTransaction.MIN_BASE_FEE) {
+            "Base fee must be at least ${AbstractTransaction.MIN_BASE_FEE} stroops, got $baseFee"
+        }
+        require(maxFee >= baseFee) { "Maximum fee $maxFee is lower than the base fee $baseFee" }
+        require(flushInterval.isPositive()) { "Flush interval must be positive, got $flushInterval" }
+        maxOperationsPerTransaction = minOf(Transaction.MAX_OPERATIONS.toLong(), maxFee / baseFee).toInt()
+    }
+
+    /**
+     * Queues a payment and suspends until the transaction carrying it has been submitted.
+     *
+     * @param payment The payment
+     * @param memo The memo of the transaction; only payments with equal memos share a transaction
+     * @return The result of the payment and of its transaction
+     * @throws IllegalStateException if the batcher has been closed
+     * @throws Exception whatever building, signing or submitting the transaction threw
+     */
+    suspend fun pay(payment: PaymentOperation, memo: Memo = MemoNone): PaymentBatchResult {
+        val entry = Entry.Payment(payment, memo)
+        check(inbox.trySend(entry)) { "Payment batcher is closed" }
+        return entry.result.await()
+    }
+
+    /**
+     * Stops accepting payments. [run] submits the payments already queued and returns.
+     */
+    fun close() {
+        inbox.close()
+    }
+
+    /**
+     * Collects and submits batches until [close] is called.
+     *
+     * Launch it in a scope that outlives the callers of [pay]; cancelling it fails the
+     * payments that are still queued or in flight.
+     */
+    suspend fun run(): Unit = coroutineScope {
+        // Payments waiting for the next flush, by memo
+        val pending = LinkedHashMap<Memo, MutableList<Entry.Payment>>()
+        var generation = 0
+        var timer: Job? = null
+
+        fun stopTimer() {
+            timer?.cancel()
+            timer = null
+            generation++
+        }
+
+        try {
+            for (entry in inbox) {
+                when (entry) {
+                    is Entry.Payment -> {
+                        val group = pending.getOrPut(entry.memo) { mutableListOf() }
+                        group.add(entry)
+                        if (group.size == maxOperationsPerTransaction) {
+                            pending.remove(entry.memo)
+                            launch { submit(group) }
+                        }
+                        if (pending.isEmpty()) {
+                            stopTimer()
+                        } else if (timer == null) {
+                            val flushGeneration = generation
+                            timer = launch {
+                                delay(flushInterval)
+                                inbox.trySend(Entry.Flush(flushGeneration))
+                            }
+                        }
+                    }
+                    // A timer stopped after it fired may still deliver its flush
+                    is Entry.Flush -> if (entry.generation == generation) {
+                        stopTimer()
+                        pending.values.forEach { group -> launch { submit(group) } }
+                        pending.clear()
+                    }
+                }
+            }
+            stopTimer()
+            pending.values.forEach { group -> launch { submit(group) } }
+            pending.clear()
+        } finally {
+            inbox.stop(pending.values.flatten())
+        }
+    }
+
+    private suspend fun submit(payments: List<Entry.Payment>) {
+        try {
+            channels.withChannel { channel ->
+                val transaction = TransactionBuilder(channel, network)
+                    .addOperations(payments.map { it.payment })
+                    .addMemo(payments[0].memo)
+                    .setBaseFee(baseFee)
+                    .setTimeout(timeout)
+                    .build()
+                transaction.signAll(listOfNotNull(channel.keypair.takeIf { it.canSign() }) + signers)
+
+                val result = submitTransaction(transaction)
+                if (result.result.discriminant == TransactionResultCodeXdr.txBAD_SEQ) {
+                    channel.markBadSequence()
+                }
+                val hash = transaction.hashHex()
+                val operationResults = (result.result as? TransactionResultResultXdr.Results)?.value
+                payments.forEachIndexed { i, entry ->
+                    entry.result.complete(PaymentBatchResult(hash, result, operationResults?.getOrNull(i)))
+                }
+            }
+        } catch (e: Throwable) {
+            payments.forEach { inbox.fail(it, e) }
+            if (e is CancellationException) throw e
+        }
+    }
+}
+
+/**
+ * Result of one payment submitted through a [PaymentBatcher].
+ *
+ * @property transactionHash Hash of the transaction that carried the payment, as lowercase hex
+ * @property transactionResult Result of the whole transaction
+ * @property operationResult Result of this payment's operation, or null if the transaction
+ *   failed before its operations were applied. Inside a failed transaction an operation may
+ *   report success although its effects were rolled back; use [isSuccess].
+ */
+class PaymentBatchResult internal constructor(
+    val transactionHash: String,
+    val transactionResult: TransactionResultXdr,
+    val operationResult: OperationResultXdr?
+) {
+    /**
+     * True if the transaction succeeded, and with it this payment.
+     */
+    val isSuccess: Boolean
+        get() = transactionResult.result.discriminant == TransactionResultCodeXdr.txSUCCESS
+
+    /**
+     * The payment result code, or null if the operation was not applied as a payment.
+     */
+    val paymentResultCode: PaymentResultCodeXdr?
+        get() = ((operationResult as? OperationResultXdr.Tr)?.value as? OperationResultTrXdr.PaymentResult)
+            ?.value?.discriminant
+
+    override fun toString(): String {
+        return "PaymentBatchResult(transactionHash='$transactionHash', isSuccess=$isSuccess, paymentResultCode=$paymentResultCode)"
+    }
+}
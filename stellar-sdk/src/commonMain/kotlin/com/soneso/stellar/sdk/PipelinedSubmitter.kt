@@ -0,0 +1,147 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.xdr.TransactionResultCodeXdr
+import com.soneso.stellar.sdk.xdr.TransactionResultResultXdr
+import com.soneso.stellar.sdk.xdr.TransactionResultXdr
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.Semaphore
+import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.sync.withPermit
+
+/**
+ * Submits transactions from one account concurrently, up to [windowSize] at a time.
+ *
+ * Without preconditions, transaction `n + 1` of an account is only valid once transaction `n`
+ * has been applied, so one account can only move transactions through the network one after
+ * the other. This submitter assigns consecutive sequence numbers itself and sets
+ * `minSeqNum` (CAP-21) on each transaction to the lowest sequence number the account may
+ * currently have. A transaction with sequence number `s` is then valid whenever the account's
+ * sequence number lies between `minSeqNum` and `s - 1`, so the transactions of a window can
+ * be in flight at the same time, arrive in any order and skip sequence numbers of
+ * transactions that were rejected.
+ *
+ * A transaction is rejected with `tx_bad_seq` if one with a higher sequence number was applied
+ * in an earlier ledger. The submitter then reloads the account's sequence number, rebuilds
+ * the transaction with a new sequence number and submits it again, up to [maxAttempts] times.
+ *
+ * ```kotlin
+ * val submitter = PipelinedSubmitter(
+ *     source = hotWallet,
+ *     network = Network.PUBLIC,
+ *     baseFee = 200,
+ *     loadSequenceNumber = { accountId -> horizonServer.loadAccount(accountId).sequenceNumber },
+ *     submitTransaction = { tx -> submitAndDecodeResult(tx) }
+ * )
+ * val submissions = payouts.map { payment -> async { submitter.submit(listOf(payment)) } }.awaitAll()
+ * ```
+ *
+ * @param source The account sending the transactions; it signs every transaction
+ * @param network The network transactions are built for
+ * @param baseFee The fee per operation in stroops
+ * @param windowSize The most transactions in flight at the same time
+ * @param timeout Validity of each transaction in seconds, from the time it is built
+ * @param maxAttempts How often a transaction is built and submitted before a `tx_bad_seq`
+ *   result is returned to the caller
+ * @param loadSequenceNumber Loads the current sequence number of [source] from the network
+ * @param submitTransaction Submits a signed transaction and returns its result
+ */
+class PipelinedSubmitter(
+    private val source: KeyPair,
+    private val network: Network,
+    private val baseFee: Long,
+    windowSize: Int = 8,
+    private val timeout: Long = 30,
+    private val maxAttempts: Int = 3,
+    private val loadSequenceNumber: suspend (accountId: String) -> Long,
+    private val submitTransaction: suspend (Transaction) -> TransactionResultXdr
+) {
+    private val window = Semaphore(windowSize)
+    private val sequenceLock = Mutex()
+
+    // Lowest sequence number the account may currently have, used as minSeqNum
+    private var confirmedSequenceNumber: Long? = null
+
+    // Highest sequence number handed out
+    private var lastSequenceNumber = 0L
+
+    init {
+        require(source.canSign()) { "Source keypair must contain a private key" }
+        require(windowSize > 0) { "Window size must be positive, got $windowSize" }
+        require(maxAttempts > 0) { "Max attempts must be positive, got $maxAttempts" }
+    }
+
+    /**
+     * Builds, signs and submits a transaction with the given operations.
+     *
+     * Suspends while [windowSize] transactions are already in flight.
+     *
+     * @param operations The operations of the transaction
+     * @param memo The memo of the transaction
+     * @return The submitted transaction and its result
+     */
+    suspend fun submit(operations: List<Operation>, memo: Memo = MemoNone): PipelinedSubmission =
+        window.withPermit {
+            var attempts = 1
+            var transaction = build(operations, memo)
+            var result = submitTransaction(transaction)
+            while (result.result.discriminant == TransactionResultCodeXdr.txBAD_SEQ && attempts < maxAttempts) {
+                // A later transaction was applied first: move past it and rebuild
+                sequenceLock.withLock { synchronize() }
+                attempts++
+                transaction = build(operations, memo)
+                result = submitTransaction(transaction)
+            }
+            // Only transactions applied to the ledger consume their sequence number; rejected ones leave a gap
+            if (result.result is TransactionResultResultXdr.Results) confirm(transaction)
+            PipelinedSubmission(transaction, result, attempts)
+        }
+
+    private suspend fun build(operations: List<Operation>, memo: Memo): Transaction {
+        val (sequenceNumber, minSequenceNumber) = sequenceLock.withLock {
+            val confirmed = confirmedSequenceNumber ?: synchronize()
+            lastSequenceNumber++
+            lastSequenceNumber to confirmed
+        }
+        val transaction = TransactionBuilder(Account(source, sequenceNumber - 1), network)
+            .addOperations(operations)
+            .addMemo(memo)
+            .setBaseFee(baseFee)
+            .addPreconditions(TransactionPreconditions(minSequenceNumber = minSequenceNumber))
+            .setTimeout(timeout)
+            .build()
+        transaction.sign(source)
+        return transaction
+    }
+
+    /**
+     * Loads the account's sequence number; called with [sequenceLock] held.
+     */
+    private suspend fun synchronize(): Long {
+        val loaded = loadSequenceNumber(source.getAccountId())
+        confirmedSequenceNumber = maxOf(confirmedSequenceNumber ?: loaded, loaded)
+        lastSequenceNumber = maxOf(lastSequenceNumber, loaded)
+        return loaded
+    }
+
+    /**
+     * Records that [transaction] reached the ledger, so the account is at least at its sequence number.
+     */
+    private suspend fun confirm(transaction: Transaction) {
+        sequenceLock.withLock {
+            confirmedSequenceNumber = maxOf(confirmedSequenceNumber ?: 0L, transaction.sequenceNumber)
+        }
+    }
+}
+
+/**
+ * A transaction submitted by a [PipelinedSubmitter].
+ *
+ * @property transaction The transaction as last submitted
+ * @property result Its result
+ * @property attempts How often it was built and submitted
+ */
+class PipelinedSubmission internal constructor(
+    val transaction: Transaction,
+    val result: TransactionResultXdr,
+    val attempts: Int
+)
@@ -0,0 +1,74 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.channels.ChannelIterator
+
+/**
+ * Queue between the callers of a background engine and its `run()` loop, used by
+ * [PaymentBatcher] and [FeeEscalator].
+ *
+ * Every element may carry a deferred result its caller suspends on. Whatever the loop does not
+ * get to finish is failed with an [IllegalStateException] carrying [stoppedMessage], so no
+ * caller is left waiting: an element the channel drops because `run()` was cancelled before it
+ * resumed, the elements passed to [stop], and those still queued when [stop] is called.
+ *
+ * @param stoppedMessage Message of the exception failing elements left over by a stopped loop
+ * @param resultOf The deferred result of an element, or null if nobody waits on it
+ */
+internal class RunnerInbox<T : Any>(
+    private val stoppedMessage: String,
+    private val resultOf: (T) -> CompletableDeferred<*>?
+) {
+    private val channel = Channel<T>(Channel.UNLIMITED) { element -> fail(element) }
+
+    /**
+     * Queues an element; returns false once the inbox is closed.
+     */
+    fun trySend(element: T): Boolean = channel.trySend(element).isSuccess
+
+    /**
+     * Suspends until an element arrives; returns null once the inbox is closed and empty.
+     */
+    suspend fun receiveOrNull(): T? = channel.receiveCatching().getOrNull()
+
+    fun tryReceive(): T? = channel.tryReceive().getOrNull()
+
+    operator fun iterator(): ChannelIterator<T> = channel.iterator()
+
+    /**
+     * Stops accepting elements; those already queued can still be received.
+     */
+    fun close() {
+        channel.close()
+    }
+
+    /**
+     * Fails the result of [element] with [cause].
+     *
+     * Without a cause, or when the cause is the cancellation of `run()`, the result fails with
+     * the stopped exception instead: a caller that was not cancelled itself must not finish as
+     * if it had been.
+     */
+    fun fail(element: T, cause: Throwable? = null) {
+        val failure = if (cause == null || cause is CancellationException) {
+            IllegalStateException(stoppedMessage, cause)
+        } else {
+            cause
+        }
+        resultOf(element)?.completeExceptionally(failure)
+    }
+
+    /**
+     * Closes the inbox and fails [leftOver] and every element still queued. Call it from a
+     * `finally` block of `run()`; after a normal return there is nothing left to fail.
+     */
+    fun stop(leftOver: Iterable<T>) {
+        channel.close()
+        leftOver.forEach { fail(it) }
+        while (true) {
+            fail(tryReceive() ?: break)
+        }
+    }
+}
@@ -0,0 +1,157 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.crypto.VerifyItem
+import com.soneso.stellar.sdk.crypto.getEd25519Crypto
+
+/**
+ * Result of [AbstractTransaction.verifySignatures]: which signers authorized a transaction.
+ *
+ * Combine it with the signer weights and thresholds of the source account to decide whether
+ * the network would accept the transaction's operations:
+ *
+ * ```kotlin
+ * val account = horizonServer.accounts().account(transaction.sourceAccount)
+ * val weights = account.signers.associate { SignerKey.fromEncodedSignerKey(it.key) to it.weight }
+ * val verification = transaction.verifySignatures(weights.keys)
+ * val authorized = verification.meetsThreshold(weights, account.thresholds.medThreshold)
+ * ```
+ *
+ * @property signers The signers with a valid signature, and pre-authorized transaction
+ *   signers whose hash is the transaction hash
+ * @property unmatchedSignatures Signatures that belong to none of the signers. The network
+ *   rejects transactions carrying such signatures with `tx_bad_auth_extra`.
+ */
+class SignatureVerification internal constructor(
+    val signers: Set<SignerKey>,
+    val unmatchedSignatures: List<DecoratedSignature>
+) {
+    /**
+     * Account thresholds, as set with [SetOptionsOperation].
+     */
+    enum class Threshold { LOW, MEDIUM, HIGH }
+
+    /**
+     * The total weight of the signers that signed.
+     *
+     * @param weights Weight of each signer of the account
+     * @return The sum of the weights of [signers]
+     */
+    fun weight(weights: Map<SignerKey, Int>): Int = signers.sumOf { weights[it] ?: 0 }
+
+    /**
+     * Whether the signers that signed reach a threshold.
+     *
+     * As on the network, a threshold of 0 still requires a signer with a positive weight.
+     *
+     * @param weights Weight of each signer of the account
+     * @param threshold The threshold to reach
+     * @return True if [weight] is at least [threshold]
+     */
+    fun meetsThreshold(weights: Map<SignerKey, Int>, threshold: Int): Boolean =
+        weight(weights) >= maxOf(threshold, 1)
+
+    /**
+     * The thresholds the signers that signed reach.
+     *
+     * @param weights Weight of each signer of the account
+     * @param low The account's low threshold
+     * @param medium The account's medium threshold
+     * @param high The account's high threshold
+     * @return The thresholds that are met
+     */
+    fun metThresholds(weights: Map<SignerKey, Int>, low: Int, medium: Int, high: Int): Set<Threshold> {
+        val weight = weight(weights)
+        return buildSet {
+            if (weight >= maxOf(low, 1)) add(Threshold.LOW)
+            if (weight >= maxOf(medium, 1)) add(Threshold.MEDIUM)
+            if (weight >= maxOf(high, 1)) add(Threshold.HIGH)
+        }
+    }
+
+    override fun toString(): String {
+        return "SignatureVerification(signers=${signers.size}, unmatchedSignatures=${unmatchedSignatures.size})"
+    }
+
+    internal companion object {
+        /**
+         * Matches [signatures] of the transaction with hash [transactionHash] to [signers].
+         *
+         * Signers are indexed by the hint their signatures carry, so each signature is only
+         * checked against the few signers sharing its hint. All Ed25519 candidates are verified
+         * in one batch. Each signature authorizes at most one signer.
+         */
+        suspend fun verify(
+            transactionHash: ByteArray,
+            signatures: List<DecoratedSignature>,
+            signers: Collection<SignerKey>
+        ): SignatureVerification {
+            val matched = LinkedHashSet<SignerKey>()
+            val byHint = HashMap<Int, MutableList<SignerKey>>()
+            for (signer in signers) {
+                val hint = when (signer) {
+                    is SignerKey.Ed25519PublicKey -> hintOf(signer.publicKey)
+                    is SignerKey.HashX -> hintOf(signer.hash)
+                    is SignerKey.Ed25519SignedPayload -> hintOf(signer.ed25519PublicKey) xor payloadHintOf(signer.payload)
+                    is SignerKey.PreAuthTx -> {
+                        // Pre-authorized transactions are authorized by their hash, not by a signature
+                        if (signer.hash.contentEquals(transactionHash)) matched.add(signer)
+                        continue
+                    }
+                }
+                byHint.getOrPut(hint) { mutableListOf() }.add(signer)
+            }
+
+            // Candidate pairs of signature and signer, in signature order
+            val candidates = mutableListOf<Pair<Int, SignerKey>>()
+            val items = mutableListOf<VerifyItem>()
+            val candidateItems = mutableListOf<Int>()
+            signatures.forEachIndexed { i, signature ->
+                byHint[hintOf(signature.hint)]?.forEach { signer ->
+                    candidates.add(i to signer)
+                    val item = when (signer) {
+                        is SignerKey.Ed25519PublicKey -> VerifyItem(transactionHash, signature.signature, signer.publicKey)
+                        is SignerKey.Ed25519SignedPayload ->
+                            VerifyItem(signer.payload, signature.signature, signer.ed25519PublicKey)
+                        else -> null
+                    }
+                    if (item == null) {
+                        candidateItems.add(-1)
+                    } else {
+                        candidateItems.add(items.size)
+                        items.add(item)
+                    }
+                }
+            }
+            val verified = if (items.isEmpty()) BooleanArray(0) else getEd25519Crypto().verifyBatch(items)
+
+            val used = BooleanArray(signatures.size)
+            candidates.forEachIndexed { c, (i, signer) ->
+                if (used[i] || signer in matched) return@forEachIndexed
+                val valid = when (signer) {
+                    is SignerKey.HashX -> Util.hash(signatures[i].signature).contentEquals(signer.hash)
+                    else -> verified[candidateItems[c]]
+                }
+                if (valid) {
+                    used[i] = true
+                    matched.add(signer)
+                }
+            }
+            return SignatureVerification(matched, signatures.filterIndexed { i, _ -> !used[i] })
+        }
+
+        // The last 4 bytes of a key, as carried in the hint of its signatures
+        private fun hintOf(bytes: ByteArray): Int {
+            val n = bytes.size
+            return ((bytes[n - 4].toInt() and 0xFF) shl 24) or
+                ((bytes[n - 3].toInt() and 0xFF) shl 16) or
+                ((bytes[n - 2].toInt() and 0xFF) shl 8) or
+                (bytes[n - 1].toInt() and 0xFF)
+        }
+
+        // The last 4 bytes of a signed payload, zero-padded on the right if it is shorter (CAP-40)
+        private fun payloadHintOf(payload: ByteArray): Int {
+            if (payload.size >= 4) return hintOf(payload)
+            return hintOf(payload.copyOf(4))
+        }
+    }
+}
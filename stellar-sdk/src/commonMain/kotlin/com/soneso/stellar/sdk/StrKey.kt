@@ -1,15 +1,9 @@
 package com.soneso.stellar.sdk
 
-import kotlin.experimental.and
-
-/**
- * Platform-specific Base32 codec interface.
- */
-internal expect object Base32Codec {
-    fun encode(data: ByteArray): ByteArray
-    fun decode(data: ByteArray): ByteArray
-    fun isInAlphabet(data: ByteArray): Boolean
-}
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.joinAll
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.withContext
 
 /**
  * StrKey is a helper class for encoding and decoding Stellar keys to/from strings.
@@ -35,13 +29,31 @@ object StrKey {
 
     private const val BASE32_ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"
 
-    // Decoding table for base32
-    private val decodingTable: ByteArray = ByteArray(256) { 0xff.toByte() }.apply {
+    /**
+     * Number of entries decoded sequentially by one worker in [decodeEd25519PublicKeys].
+     *
+     * A multiple of 64, so that each chunk owns whole words of the invalid-entry bitmap.
+     */
+    private const val BULK_DECODE_CHUNK_SIZE = 4096
+
+    private val encodingTable: CharArray = BASE32_ALPHABET.toCharArray()
+
+    // Maps a character code to its 5-bit value, -1 for characters outside the alphabet
+    private val decodingTable: ByteArray = ByteArray(128) { -1 }.apply {
         BASE32_ALPHABET.forEachIndexed { index, char ->
             this[char.code] = index.toByte()
         }
     }
 
+    // CRC16-XModem (polynomial 0x1021) remainder of each leading byte
+    private val crc16Table: IntArray = IntArray(256) { byte ->
+        var crc = byte shl 8
+        repeat(8) {
+            crc = if (crc and 0x8000 != 0) (crc shl 1) xor 0x1021 else crc shl 1
+        }
+        crc and 0xFFFF
+    }
+
     /**
      * Encodes raw bytes to strkey ed25519 public key (G...)
      */
@@ -54,7 +66,7 @@ object StrKey {
      * Decodes strkey ed25519 public key (G...) to raw bytes
      */
     fun decodeEd25519PublicKey(data: String): ByteArray {
-        return decodeCheck(VersionByte.ACCOUNT_ID, data.toCharArray())
+        return decodeCheck(VersionByte.ACCOUNT_ID, data)
     }
 
     /**
@@ -69,6 +81,78 @@ object StrKey {
         }
     }
 
+    /**
+     * Decodes a list of strkey ed25519 public keys (G...) at once.
+     *
+     * Invalid entries are recorded in the result instead of throwing, and all keys are written
+     * into one contiguous array. Lists longer than [BULK_DECODE_CHUNK_SIZE] are split into chunks
+     * decoded concurrently on [Dispatchers.Default], in parallel on JVM and native.
+     *
+     * @param accountIds The account IDs to decode
+     * @return The decoded keys and the validity of each entry
+     */
+    suspend fun decodeEd25519PublicKeys(accountIds: List<String>): DecodeResult {
+        val keys = ByteArray(accountIds.size * 32)
+        val invalid = LongArray((accountIds.size + 63) / 64)
+        if (accountIds.size <= BULK_DECODE_CHUNK_SIZE) {
+            decodeEd25519PublicKeysChunk(accountIds, 0, accountIds.size, keys, invalid)
+        } else {
+            withContext(Dispatchers.Default) {
+                (accountIds.indices step BULK_DECODE_CHUNK_SIZE).map { from ->
+                    launch {
+                        val to = minOf(from + BULK_DECODE_CHUNK_SIZE, accountIds.size)
+                        decodeEd25519PublicKeysChunk(accountIds, from, to, keys, invalid)
+                    }
+                }.joinAll()
+            }
+        }
+        return DecodeResult(keys, accountIds.size, invalid)
+    }
+
+    /**
+     * Keys decoded by [decodeEd25519PublicKeys].
+     *
+     * Key `i` occupies bytes `i * 32` until `i * 32 + 32` of [keys]; the bytes of invalid
+     * entries are left zero.
+     *
+     * @property keys All decoded keys, back to back
+     * @property size The number of entries
+     */
+    class DecodeResult internal constructor(
+        val keys: ByteArray,
+        val size: Int,
+        // Bit i is set when entry i is invalid
+        private val invalid: LongArray
+    ) {
+        /**
+         * The number of entries that are not valid account IDs.
+         */
+        val invalidCount: Int = invalid.sumOf { it.countOneBits() }
+
+        /**
+         * Returns true if entry [index] is a valid account ID.
+         */
+        fun isValid(index: Int): Boolean {
+            if (index < 0 || index >= size) throw IndexOutOfBoundsException("Index $index out of bounds for size $size")
+            return invalid[index ushr 6] and (1L shl (index and 63)) == 0L
+        }
+
+        /**
+         * Returns a copy of the 32-byte key of entry [index].
+         *
+         * @throws IllegalArgumentException if the entry is not a valid account ID
+         */
+        fun key(index: Int): ByteArray {
+            require(isValid(index)) { "Entry $index is not a valid ed25519 public key" }
+            return keys.copyOfRange(index * 32, index * 32 + 32)
+        }
+
+        /**
+         * Returns the indices of all invalid entries in ascending order.
+         */
+        fun invalidIndices(): List<Int> = (0 until size).filter { !isValid(it) }
+    }
+
     /**
      * Encodes raw bytes to strkey ed25519 secret seed (S...)
      */
@@ -108,7 +192,7 @@ object StrKey {
      * Decodes strkey muxed ed25519 public key (M...) to raw bytes
      */
     fun decodeMed25519PublicKey(data: String): ByteArray {
-        return decodeCheck(VersionByte.MED25519_PUBLIC_KEY, data.toCharArray())
+        return decodeCheck(VersionByte.MED25519_PUBLIC_KEY, data)
     }
 
     /**
@@ -142,7 +226,7 @@ object StrKey {
      * Decodes strkey pre-authorized transaction hash (T...) to raw bytes
      */
     fun decodePreAuthTx(data: String): ByteArray {
-        return decodeCheck(VersionByte.PRE_AUTH_TX, data.toCharArray())
+        return decodeCheck(VersionByte.PRE_AUTH_TX, data)
     }
 
     /**
@@ -169,7 +253,7 @@ object StrKey {
      * Decodes strkey SHA-256 hash (X...) to raw bytes
      */
     fun decodeSha256Hash(data: String): ByteArray {
-        return decodeCheck(VersionByte.SHA256_HASH, data.toCharArray())
+        return decodeCheck(VersionByte.SHA256_HASH, data)
     }
 
     /**
@@ -198,7 +282,7 @@ object StrKey {
      * Decodes strkey signed payload (P...) to raw bytes
      */
     fun decodeSignedPayload(data: String): ByteArray {
-        return decodeCheck(VersionByte.SIGNED_PAYLOAD, data.toCharArray())
+        return decodeCheck(VersionByte.SIGNED_PAYLOAD, data)
     }
 
     /**
@@ -225,7 +309,7 @@ object StrKey {
      * Decodes strkey contract address (C...) to raw bytes
      */
     fun decodeContract(data: String): ByteArray {
-        return decodeCheck(VersionByte.CONTRACT, data.toCharArray())
+        return decodeCheck(VersionByte.CONTRACT, data)
     }
 
     /**
@@ -252,7 +336,7 @@ object StrKey {
      * Decodes strkey liquidity pool ID (L...) to raw bytes
      */
     fun decodeLiquidityPool(data: String): ByteArray {
-        return decodeCheck(VersionByte.LIQUIDITY_POOL, data.toCharArray())
+        return decodeCheck(VersionByte.LIQUIDITY_POOL, data)
     }
 
     /**
@@ -299,7 +383,7 @@ object StrKey {
      * Decodes strkey claimable balance ID (B...) to raw bytes
      */
     fun decodeClaimableBalance(data: String): ByteArray {
-        return decodeCheck(VersionByte.CLAIMABLE_BALANCE, data.toCharArray())
+        return decodeCheck(VersionByte.CLAIMABLE_BALANCE, data)
     }
 
     /**
@@ -314,101 +398,182 @@ object StrKey {
         }
     }
 
+    /**
+     * Encodes version byte, data and checksum straight into the unpadded base32 output.
+     */
     private fun encodeCheck(versionByte: VersionByte, data: ByteArray): CharArray {
-        val payload = byteArrayOf(versionByte.value) + data
-        val checksum = calculateChecksum(payload)
-        val unencoded = payload + checksum
-        val encoded = Base32Codec.encode(unencoded)
-
-        // Remove padding
-        val unpaddedLength = encoded.indexOfFirst { it == '='.code.toByte() }.let {
-            if (it == -1) encoded.size else it
-        }
-
-        return encoded.take(unpaddedLength).map { it.toInt().toChar() }.toCharArray()
+        val unencoded = ByteArray(data.size + 3)
+        unencoded[0] = versionByte.value
+        data.copyInto(unencoded, 1)
+        val checksum = calculateChecksum(unencoded, data.size + 1)
+        unencoded[data.size + 1] = checksum.toByte()
+        unencoded[data.size + 2] = (checksum ushr 8).toByte()
+        return base32Encode(unencoded)
     }
 
-    private fun decodeCheck(versionByte: VersionByte, encoded: CharArray): ByteArray {
-        require(encoded.size >= 5) { "Encoded char array must have a length of at least 5" }
+    private fun decodeCheck(versionByte: VersionByte, encoded: CharArray): ByteArray =
+        decodeCheck(versionByte, CharArraySequence(encoded))
 
-        val bytes = encoded.map { it.code.toByte() }.toByteArray()
+    private fun decodeCheck(versionByte: VersionByte, encoded: CharSequence): ByteArray {
+        require(encoded.length >= 5) { "Encoded char array must have a length of at least 5" }
 
         // Validate no leftover character
-        val leftoverBits = (bytes.size * 5) % 8
+        val leftoverBits = (encoded.length * 5) % 8
         require(leftoverBits < 5) { "Encoded char array has leftover character" }
 
         // Validate unused bits are zero
         if (leftoverBits > 0) {
-            val lastChar = bytes.last()
-            val decodedLastChar = decodingTable[lastChar.toInt() and 0xFF]
-            val leftoverBitsMask = (0x0f shr (4 - leftoverBits)).toByte()
-            require((decodedLastChar and leftoverBitsMask) == 0.toByte()) { "Unused bits should be set to 0" }
+            val leftoverBitsMask = 0x0f shr (4 - leftoverBits)
+            require((decodeChar(encoded[encoded.length - 1]) and leftoverBitsMask) == 0) {
+                "Unused bits should be set to 0"
+            }
         }
 
-        val decoded = base32Decode(bytes)
-        val decodedVersionByte = decoded[0]
-        val decodedVersion = VersionByte.fromValue(decodedVersionByte)
+        val decoded = base32Decode(encoded)
+        val decodedVersion = VersionByte.fromValue(decoded[0])
             ?: throw IllegalArgumentException("Version byte is invalid")
-
-        val payload = decoded.copyOfRange(0, decoded.size - 2)
-        val data = payload.copyOfRange(1, payload.size)
-        val checksum = decoded.copyOfRange(decoded.size - 2, decoded.size)
+        val dataSize = decoded.size - 3
 
         // Validate data length
         when (decodedVersion) {
             VersionByte.SIGNED_PAYLOAD -> {
-                require(data.size in (32 + 4 + 4)..(32 + 4 + 64)) {
-                    "Invalid data length, the length should be between 40 and 100 bytes, got ${data.size}"
+                require(dataSize in (32 + 4 + 4)..(32 + 4 + 64)) {
+                    "Invalid data length, the length should be between 40 and 100 bytes, got $dataSize"
                 }
             }
             VersionByte.MED25519_PUBLIC_KEY -> {
-                require(data.size == 40) { "Invalid data length, expected 40 bytes, got ${data.size}" }
+                require(dataSize == 40) { "Invalid data length, expected 40 bytes, got $dataSize" }
             }
             VersionByte.CLAIMABLE_BALANCE -> {
-                require(data.size == 33) { "Invalid data length, expected 33 bytes, got ${data.size}" }
+                require(dataSize == 33) { "Invalid data length, expected 33 bytes, got $dataSize" }
             }
             else -> {
-                require(data.size == 32) { "Invalid data length, expected 32 bytes, got ${data.size}" }
+                require(dataSize == 32) { "Invalid data length, expected 32 bytes, got $dataSize" }
             }
         }
 
         require(decodedVersion == versionByte) { "Version byte mismatch" }
 
-        val expectedChecksum = calculateChecksum(payload)
-        require(expectedChecksum.contentEquals(checksum)) { "Checksum invalid" }
+        val checksum = (decoded[dataSize + 1].toInt() and 0xFF) or ((decoded[dataSize + 2].toInt() and 0xFF) shl 8)
+        require(calculateChecksum(decoded, dataSize + 1) == checksum) { "Checksum invalid" }
 
-        return data
+        return decoded.copyOfRange(1, dataSize + 1)
     }
 
     /**
-     * Calculates CRC16-XModem checksum
+     * Calculates the CRC16-XModem checksum of the first [length] bytes.
      */
-    private fun calculateChecksum(bytes: ByteArray): ByteArray {
-        var crc = 0x0000
+    private fun calculateChecksum(bytes: ByteArray, length: Int): Int {
+        var crc = 0
+        for (i in 0 until length) {
+            crc = ((crc shl 8) xor crc16Table[((crc ushr 8) xor bytes[i].toInt()) and 0xFF]) and 0xFFFF
+        }
+        return crc
+    }
 
-        for (byte in bytes) {
-            var code = (crc ushr 8) and 0xFF
-            code = code xor (byte.toInt() and 0xFF)
-            code = code xor (code ushr 4)
-            crc = (crc shl 8) and 0xFFFF
-            crc = crc xor code
-            code = (code shl 5) and 0xFFFF
-            crc = crc xor code
-            code = (code shl 7) and 0xFFFF
-            crc = crc xor code
+    /**
+     * Unpadded RFC 4648 base32; whole 5-byte groups are encoded as 8 characters at once.
+     */
+    private fun base32Encode(data: ByteArray): CharArray {
+        val encoded = CharArray((data.size * 8 + 4) / 5)
+        var i = 0
+        var j = 0
+        while (i + 5 <= data.size) {
+            val group = ((data[i].toLong() and 0xFF) shl 32) or
+                ((data[i + 1].toLong() and 0xFF) shl 24) or
+                ((data[i + 2].toLong() and 0xFF) shl 16) or
+                ((data[i + 3].toLong() and 0xFF) shl 8) or
+                (data[i + 4].toLong() and 0xFF)
+            for (shift in 35 downTo 0 step 5) {
+                encoded[j++] = encodingTable[((group ushr shift) and 0x1F).toInt()]
+            }
+            i += 5
+        }
+        var buffer = 0
+        var bits = 0
+        while (i < data.size) {
+            buffer = (buffer shl 8) or (data[i++].toInt() and 0xFF)
+            bits += 8
+            while (bits >= 5) {
+                bits -= 5
+                encoded[j++] = encodingTable[(buffer ushr bits) and 0x1F]
+            }
+        }
+        if (bits > 0) {
+            encoded[j] = encodingTable[(buffer shl (5 - bits)) and 0x1F]
+        }
+        return encoded
+    }
+
+    private fun decodeEd25519PublicKeysChunk(
+        accountIds: List<String>,
+        from: Int,
+        to: Int,
+        keys: ByteArray,
+        invalid: LongArray
+    ) {
+        val decoded = ByteArray(35)
+        for (i in from until to) {
+            if (!decodeEd25519PublicKeyInto(accountIds[i], decoded, keys, i * 32)) {
+                invalid[i ushr 6] = invalid[i ushr 6] or (1L shl (i and 63))
+            }
         }
+    }
 
-        // Return little-endian
-        return byteArrayOf(crc.toByte(), (crc ushr 8).toByte())
+    /**
+     * Same checks as [decodeCheck] for an account ID, reporting failure instead of throwing.
+     */
+    private fun decodeEd25519PublicKeyInto(encoded: String, decoded: ByteArray, keys: ByteArray, offset: Int): Boolean {
+        // Version byte, 32-byte key and checksum encode to exactly 56 characters without leftover bits
+        if (encoded.length != 56 || !base32DecodeInto(encoded, decoded)) return false
+        if (decoded[0] != VersionByte.ACCOUNT_ID.value) return false
+        val checksum = (decoded[33].toInt() and 0xFF) or ((decoded[34].toInt() and 0xFF) shl 8)
+        if (calculateChecksum(decoded, 33) != checksum) return false
+        decoded.copyInto(keys, offset, 1, 33)
+        return true
     }
 
+    private fun base32Decode(encoded: CharSequence): ByteArray {
+        val decoded = ByteArray(encoded.length * 5 / 8)
+        require(base32DecodeInto(encoded, decoded)) { "Invalid base32 encoded string" }
+        return decoded
+    }
 
-    private fun base32Decode(data: ByteArray): ByteArray {
-        // Validate all characters are in alphabet
-        require(Base32Codec.isInAlphabet(data)) {
-            "Invalid base32 encoded string"
+    /**
+     * Decodes [encoded] into the first `encoded.length * 5 / 8` bytes of [decoded].
+     *
+     * @return false if a character is outside the base32 alphabet
+     */
+    private fun base32DecodeInto(encoded: CharSequence, decoded: ByteArray): Boolean {
+        var buffer = 0
+        var bits = 0
+        var j = 0
+        for (i in 0 until encoded.length) {
+            val value = decodeChar(encoded[i])
+            if (value < 0) return false
+            buffer = (buffer shl 5) or value
+            bits += 5
+            if (bits >= 8) {
+                bits -= 8
+                decoded[j++] = (buffer ushr bits).toByte()
+            }
         }
+        return true
+    }
+
+    private fun decodeChar(char: Char): Int =
+        if (char.code < decodingTable.size) decodingTable[char.code].toInt() else -1
+
+    /**
+     * Reads a secret seed in place, without copying it into an immutable [String].
+     */
+    private class CharArraySequence(private val chars: CharArray) : CharSequence {
+        override val length: Int
+            get() = chars.size
+
+        override fun get(index: Int): Char = chars[index]
 
-        return Base32Codec.decode(data)
+        override fun subSequence(startIndex: Int, endIndex: Int): CharSequence =
+            CharArraySequence(chars.copyOfRange(startIndex, endIndex))
     }
 }
@@ -131,21 +131,10 @@ class Transaction internal constructor(
         }
     }
 
-    /**
-     * Returns the signature base - the data that must be signed.
-     *
-     * The signature base consists of:
-     * - Network ID hash (32 bytes)
-     * - Transaction envelope type (ENVELOPE_TYPE_TX)
-     * - Transaction XDR
-     *
-     * @return The signature base bytes
-     */
-    override suspend fun signatureBase(): ByteArray {
-        val taggedTransaction = TransactionSignaturePayloadTaggedTransactionXdr.Tx(
+    override fun taggedTransaction(): TransactionSignaturePayloadTaggedTransactionXdr {
+        return TransactionSignaturePayloadTaggedTransactionXdr.Tx(
             value = toV1Xdr()
         )
-        return getTransactionSignatureBase(taggedTransaction, network)
     }
 
     /**
@@ -182,14 +171,17 @@ class Transaction internal constructor(
      *
      * @return The TransactionXdr object
      */
-    internal fun toV1Xdr(): TransactionXdr {
+    internal fun toV1Xdr(): TransactionXdr = v1Xdr
+
+    // The body is immutable, so it is converted once for hashing and every envelope
+    private val v1Xdr: TransactionXdr by lazy {
         val ext = if (sorobanData != null) {
             TransactionExtXdr.SorobanData(sorobanData)
         } else {
             TransactionExtXdr.Void
         }
 
-        return TransactionXdr(
+        TransactionXdr(
             sourceAccount = MuxedAccount(sourceAccount).toXdr(),
             fee = Uint32Xdr(fee.toUInt()),
             seqNum = SequenceNumberXdr(Int64Xdr(sequenceNumber)),
@@ -58,6 +58,8 @@ class TransactionBuilder(
     private var preconditions: TransactionPreconditions = TransactionPreconditions()
     private var sorobanData: SorobanTransactionDataXdr? = null
     private var txTimeout: Long? = null
+    private var maxEnvelopeSize: Int? = null
+    private var expectedSignatures: Int = 1
 
     /**
      * Returns the number of operations currently added to this transaction.
@@ -206,6 +208,28 @@ class TransactionBuilder(
         return this
     }
 
+    /**
+     * Limits the size of the signed transaction envelope this builder may produce.
+     *
+     * [build] computes the envelope's exact XDR size without serializing it and rejects the
+     * transaction when, together with [expectedSignatures] signatures, it would exceed [maxBytes].
+     * For Soroban transactions the network limit is the `txMaxSizeBytes` bandwidth setting.
+     *
+     * @param maxBytes The maximum encoded envelope size in bytes
+     * @param expectedSignatures The number of signatures the envelope will carry when submitted
+     * @return This builder for method chaining
+     * @throws IllegalArgumentException if maxBytes is not positive or expectedSignatures is out of range
+     */
+    fun setMaxEnvelopeSize(maxBytes: Int, expectedSignatures: Int = 1): TransactionBuilder {
+        require(maxBytes > 0) { "maxBytes must be positive" }
+        require(expectedSignatures in 0..MAX_ENVELOPE_SIGNATURES) {
+            "expectedSignatures must be between 0 and ${MAX_ENVELOPE_SIGNATURES}"
+        }
+        this.maxEnvelopeSize = maxBytes
+        this.expectedSignatures = expectedSignatures
+        return this
+    }
+
     /**
      * Builds the transaction and increments the source account's sequence number.
      *
@@ -214,7 +238,8 @@ class TransactionBuilder(
      * uses a higher sequence number.
      *
      * @return The built Transaction
-     * @throws IllegalStateException if required fields are missing or validation fails
+     * @throws IllegalStateException if required fields are missing, validation fails or the
+     *   envelope would exceed the size set with [setMaxEnvelopeSize]
      */
     fun build(): Transaction {
         // Validate base fee is set
@@ -275,6 +300,14 @@ class TransactionBuilder(
             network = network
         )
 
+        // Reject oversized envelopes before anything is serialized or the sequence is consumed
+        maxEnvelopeSize?.let { maxBytes ->
+            val size = transaction.toEnvelopeXdr().encodedSize() + expectedSignatures * DECORATED_SIGNATURE_SIZE
+            check(size <= maxBytes) {
+                "Transaction envelope would be $size bytes with $expectedSignatures signature(s), exceeding the limit of $maxBytes bytes"
+            }
+        }
+
         // Update source account sequence number
         sourceAccount.setSequenceNumber(sequenceNumber)
 
@@ -282,6 +315,16 @@ class TransactionBuilder(
     }
 
     companion object {
+        /**
+         * Encoded size of one DecoratedSignature: 4-byte hint plus a length-prefixed 64-byte signature.
+         */
+        private const val DECORATED_SIGNATURE_SIZE = 72
+
+        /**
+         * Maximum number of signatures a transaction envelope can carry.
+         */
+        private const val MAX_ENVELOPE_SIGNATURES = 20
+
         /**
          * Gets the current time in milliseconds.
          *
@@ -0,0 +1,223 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.xdr.*
+
+/**
+ * Pre-encoded transaction whose sequence number and payment fields can be replaced in place.
+ *
+ * High-volume senders often submit transactions that share everything (source account, fee,
+ * preconditions, memo, assets) except the sequence number and the destination and amount of
+ * each payment. A template encodes such a transaction once and records the byte offsets of
+ * those fields. [instantiate] then copies the encoded bytes and overwrites the fields, so
+ * neither the operations nor the transaction are converted to XDR and encoded again, and the
+ * hash is computed directly over the patched signature payload.
+ *
+ * ```kotlin
+ * val prototype = TransactionBuilder(account, Network.PUBLIC)
+ *     .addOperation(PaymentOperation(anyDestination, usdc, "1"))
+ *     .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+ *     .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 0)))
+ *     .build()
+ * val template = TransactionTemplate.fromTransaction(prototype)
+ *
+ * val transaction = template.instantiate(
+ *     sequenceNumber = nextSequence,
+ *     payments = listOf(TransactionTemplate.Payment(destination, "125.50"))
+ * )
+ * transaction.sign(signer)
+ * horizonServer.submitTransaction(transaction.toEnvelopeXdrBase64())
+ * ```
+ *
+ * Destinations are patched in place, so each replacement must be the same kind of address as
+ * the prototype's destination: an account ID (G...) for an account ID, a muxed account (M...)
+ * for a muxed account. Templates are immutable and may be shared between coroutines.
+ *
+ * @property network The network of the prototype transaction
+ */
+class TransactionTemplate private constructor(
+    val network: Network,
+    // Network ID, ENVELOPE_TYPE_TX and the encoded TransactionXdr, as hashed for signing
+    private val payload: ByteArray,
+    private val sequenceNumberOffset: Int,
+    private val destinationOffsets: IntArray,
+    private val destinationSizes: IntArray,
+    private val amountOffsets: IntArray
+) {
+    /**
+     * The number of payment operations, and so of [Payment]s each [instantiate] call takes.
+     */
+    val paymentCount: Int
+        get() = amountOffsets.size
+
+    /**
+     * New destination and amount of one payment operation.
+     *
+     * @property destination The recipient (G... or M..., matching the prototype's destination)
+     * @property amount The amount as a decimal string, e.g. "125.50"
+     */
+    data class Payment(val destination: String, val amount: String)
+
+    /**
+     * Creates a transaction from the template by patching the variable fields.
+     *
+     * @param sequenceNumber The sequence number of the new transaction
+     * @param payments New destination and amount of each payment operation, in operation order
+     * @return The patched transaction, ready to be signed
+     * @throws IllegalArgumentException if a value does not fit the template
+     */
+    fun instantiate(sequenceNumber: Long, payments: List<Payment>): TemplateTransaction {
+        require(sequenceNumber >= 0) { "Sequence number must be non-negative, got $sequenceNumber" }
+        require(payments.size == paymentCount) {
+            "Template has $paymentCount payment operations, got ${payments.size} payments"
+        }
+        val patched = payload.copyOf()
+        putLong(patched, sequenceNumberOffset, sequenceNumber)
+        payments.forEachIndexed { i, payment ->
+            patchDestination(patched, destinationOffsets[i], destinationSizes[i], payment.destination)
+            putLong(patched, amountOffsets[i], Util.toStroops(payment.amount))
+        }
+        return TemplateTransaction(network, patched)
+    }
+
+    private fun patchDestination(buffer: ByteArray, offset: Int, size: Int, destination: String) {
+        if (size == ED25519_DESTINATION_SIZE && destination.startsWith('G')) {
+            // The discriminant stays KEY_TYPE_ED25519; only the key changes
+            StrKey.decodeEd25519PublicKey(destination).copyInto(buffer, offset + 4)
+            return
+        }
+        val writer = XdrWriter(MED25519_DESTINATION_SIZE)
+        MuxedAccount(destination).toXdr().encode(writer)
+        val encoded = writer.toByteArray()
+        require(encoded.size == size) {
+            "Destination $destination is not the same kind of address as the template's destination"
+        }
+        encoded.copyInto(buffer, offset)
+    }
+
+    companion object {
+        // Encoded MuxedAccount sizes: discriminant + key, discriminant + id + key
+        private const val ED25519_DESTINATION_SIZE = 4 + 32
+        private const val MED25519_DESTINATION_SIZE = 4 + 8 + 32
+
+        /**
+         * Creates a template from a built transaction.
+         *
+         * The sequence number and the destination and amount of every [PaymentOperation] become
+         * variable; everything else is fixed. Signatures of the prototype are not carried over.
+         *
+         * @param transaction The prototype transaction
+         * @return The template
+         */
+        suspend fun fromTransaction(transaction: Transaction): TransactionTemplate {
+            val tx = transaction.toV1Xdr()
+            val txSize = tx.encodedSize()
+            val payload = ByteArray(SIGNATURE_PAYLOAD_PREFIX_SIZE + txSize)
+            transaction.network.networkId().copyInto(payload)
+            putInt(payload, 32, EnvelopeTypeXdr.ENVELOPE_TYPE_TX.value)
+            val writer = XdrWriter(txSize)
+            tx.encode(writer)
+            writer.toByteArray().copyInto(payload, SIGNATURE_PAYLOAD_PREFIX_SIZE)
+
+            // Walk the encoding with the generated sizes to find the variable fields
+            var offset = SIGNATURE_PAYLOAD_PREFIX_SIZE + tx.sourceAccount.encodedSize() + tx.fee.encodedSize()
+            val sequenceNumberOffset = offset
+            offset += tx.seqNum.encodedSize() + tx.cond.encodedSize() + tx.memo.encodedSize() + 4
+
+            val destinationOffsets = mutableListOf<Int>()
+            val destinationSizes = mutableListOf<Int>()
+            val amountOffsets = mutableListOf<Int>()
+            for (operation in tx.operations) {
+                val body = operation.body
+                if (body is OperationBodyXdr.PaymentOp) {
+                    // Optional source account flag, then the body discriminant
+                    val destinationOffset = offset + 4 + (operation.sourceAccount?.encodedSize() ?: 0) + 4
+                    val destinationSize = body.value.destination.encodedSize()
+                    destinationOffsets.add(destinationOffset)
+                    destinationSizes.add(destinationSize)
+                    amountOffsets.add(destinationOffset + destinationSize + body.value.asset.encodedSize())
+                }
+                offset += operation.encodedSize()
+            }
+
+            return TransactionTemplate(
+                transaction.network,
+                payload,
+                sequenceNumberOffset,
+                destinationOffsets.toIntArray(),
+                destinationSizes.toIntArray(),
+                amountOffsets.toIntArray()
+            )
+        }
+    }
+}
+
+/**
+ * Transaction created by [TransactionTemplate.instantiate].
+ *
+ * Holds its signature payload encoded: the hash is computed over those bytes and the envelope
+ * is assembled from them and the signatures. The XDR objects are only decoded when requested
+ * through [toEnvelopeXdr] or [toTransaction].
+ */
+class TemplateTransaction internal constructor(
+    network: Network,
+    // Network ID, ENVELOPE_TYPE_TX and the encoded TransactionXdr
+    private val payload: ByteArray
+) : AbstractTransaction(network) {
+
+    private val transactionXdr: TransactionXdr by lazy {
+        TransactionXdr.decode(xdrReaderAt(payload, SIGNATURE_PAYLOAD_PREFIX_SIZE))
+    }
+
+    override fun taggedTransaction(): TransactionSignaturePayloadTaggedTransactionXdr =
+        TransactionSignaturePayloadTaggedTransactionXdr.Tx(transactionXdr)
+
+    override suspend fun encodeSignatureBase(): ByteArray = payload.copyOf()
+
+    override suspend fun computeHash(): ByteArray = Util.hash(payload)
+
+    override fun encodeEnvelope(): ByteArray {
+        val writer = XdrWriter()
+        writer.writeInt(signatures.size)
+        signatures.forEach { it.toXdr().encode(writer) }
+        val encodedSignatures = writer.toByteArray()
+
+        // ENVELOPE_TYPE_TX and the transaction are the tail of the payload
+        val transactionSize = payload.size - 32
+        val envelope = ByteArray(transactionSize + encodedSignatures.size)
+        payload.copyInto(envelope, 0, 32)
+        encodedSignatures.copyInto(envelope, transactionSize)
+        return envelope
+    }
+
+    override fun toEnvelopeXdr(): TransactionEnvelopeXdr = TransactionEnvelopeXdr.V1(
+        TransactionV1EnvelopeXdr(
+            tx = transactionXdr,
+            signatures = signatures.map { it.toXdr() }
+        )
+    )
+
+    /**
+     * Decodes this transaction, with its signatures, into a regular [Transaction].
+     *
+     * @return The equivalent transaction
+     */
+    fun toTransaction(): Transaction {
+        val envelope = toEnvelopeXdr() as TransactionEnvelopeXdr.V1
+        return Transaction.fromV1EnvelopeXdr(envelope.value, network)
+    }
+}
+
+// Network ID followed by the ENVELOPE_TYPE_TX tag of the signature payload
+private const val SIGNATURE_PAYLOAD_PREFIX_SIZE = 32 + 4
+
+private fun putInt(buffer: ByteArray, offset: Int, value: Int) {
+    buffer[offset] = (value ushr 24).toByte()
+    buffer[offset + 1] = (value ushr 16).toByte()
+    buffer[offset + 2] = (value ushr 8).toByte()
+    buffer[offset + 3] = value.toByte()
+}
+
+private fun putLong(buffer: ByteArray, offset: Int, value: Long) {
+    putInt(buffer, offset, (value ushr 32).toInt())
+    putInt(buffer, offset + 4, value.toInt())
+}
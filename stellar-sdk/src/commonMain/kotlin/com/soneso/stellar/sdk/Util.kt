@@ -1,6 +1,17 @@
 package com.soneso.stellar.sdk
 
 import com.soneso.stellar.sdk.crypto.getSha256Crypto
+import com.soneso.stellar.sdk.xdr.XdrWriter
+import kotlinx.coroutines.Deferred
+import kotlinx.coroutines.async
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.flow
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.sync.Semaphore
+import kotlin.coroutines.CoroutineContext
+import kotlin.coroutines.EmptyCoroutineContext
 import kotlin.math.pow
 
 /**
@@ -92,9 +103,7 @@ object Util {
      * @return A lowercase hexadecimal string representation
      */
     internal fun bytesToHex(bytes: ByteArray): String {
-        return bytes.joinToString("") { byte ->
-            (byte.toInt() and 0xFF).toString(16).padStart(2, '0')
-        }
+        return encodeHex(bytes)
     }
 
     /**
@@ -108,14 +117,7 @@ object Util {
      * @throws IllegalArgumentException if the hex string has odd length or contains invalid characters
      */
     internal fun hexToBytes(hex: String): ByteArray {
-        val cleanHex = hex.lowercase()
-        require(cleanHex.length % 2 == 0) { "Hex string must have even length" }
-
-        return ByteArray(cleanHex.length / 2) { i ->
-            val index = i * 2
-            val byteString = cleanHex.substring(index, index + 2)
-            byteString.toInt(16).toByte()
-        }
+        return decodeHex(hex)
     }
 
     /**
@@ -131,6 +133,26 @@ object Util {
         return getSha256Crypto().hash(data)
     }
 
+    /**
+     * Returns SHA-256 hash of the XDR produced by [encode], without building the encoded bytes.
+     *
+     * The writer passed to [encode] streams its output straight into an incremental hasher,
+     * so only a small fixed-size chunk buffer is used regardless of the encoded size.
+     *
+     * Note: This is an internal utility function and should not be used directly by
+     * SDK consumers. The API may change without notice.
+     *
+     * @param encode Writes the XDR value to hash into the given writer
+     * @return The 32-byte SHA-256 hash of the encoded XDR
+     */
+    internal suspend fun hashXdr(encode: (XdrWriter) -> Unit): ByteArray {
+        val hasher = getSha256Crypto().newHasher()
+        val writer = XdrWriter { bytes, offset, length -> hasher.update(bytes, offset, length) }
+        encode(writer)
+        writer.flush()
+        return hasher.digest()
+    }
+
     /**
      * One Stroop is the smallest unit of Stellar's native asset (Lumen).
      * One Lumen = 10^7 stroops.
@@ -251,3 +273,104 @@ object Util {
  * @return Current time in milliseconds
  */
 internal expect fun currentTimeMillis(): Long
+
+/**
+ * Encodes [bytes] as standard, padded Base64.
+ *
+ * Platform codecs are used for throughput on large payloads such as ledger metadata:
+ * `java.util.Base64` on the JVM and libsodium on Kotlin/Native.
+ */
+internal expect fun encodeBase64(bytes: ByteArray): String
+
+/**
+ * Decodes standard, padded Base64 text.
+ *
+ * @throws IllegalArgumentException if [base64] is not valid Base64
+ */
+internal expect fun decodeBase64(base64: String): ByteArray
+
+/**
+ * Encodes [bytes] as a lowercase hexadecimal string.
+ */
+internal expect fun encodeHex(bytes: ByteArray): String
+
+/**
+ * Decodes a case-insensitive hexadecimal string.
+ *
+ * @throws IllegalArgumentException if [hex] has odd length or contains invalid characters
+ */
+internal expect fun decodeHex(hex: String): ByteArray
+
+private val HEX_DIGITS = "0123456789abcdef".toCharArray()
+
+/**
+ * Table-driven hex encoder for platforms without a native codec.
+ */
+internal fun encodeHexPortable(bytes: ByteArray): String {
+    val chars = CharArray(bytes.size * 2)
+    for (i in bytes.indices) {
+        val value = bytes[i].toInt() and 0xFF
+        chars[i * 2] = HEX_DIGITS[value ushr 4]
+        chars[i * 2 + 1] = HEX_DIGITS[value and 0x0F]
+    }
+    return chars.concatToString()
+}
+
+/**
+ * Hex decoder for platforms without a native codec.
+ */
+internal fun decodeHexPortable(hex: String): ByteArray {
+    require(hex.length % 2 == 0) { "Hex string must have even length" }
+    return ByteArray(hex.length / 2) { i ->
+        ((hexDigit(hex, i * 2) shl 4) or hexDigit(hex, i * 2 + 1)).toByte()
+    }
+}
+
+private fun hexDigit(hex: String, index: Int): Int {
+    return when (val c = hex[index]) {
+        in '0'..'9' -> c - '0'
+        in 'a'..'f' -> c - 'a' + 10
+        in 'A'..'F' -> c - 'A' + 10
+        else -> throw IllegalArgumentException("Invalid hex character '$c' at index $index")
+    }
+}
+
+/**
+ * Applies [transform] to the elements of this flow concurrently and emits the results in the
+ * order of the elements.
+ *
+ * At most [parallelism] elements are being transformed or waiting to be emitted at any time,
+ * which also bounds how far collection of this flow runs ahead of the consumer. A failed
+ * transform fails the returned flow once the results of all elements before it were emitted.
+ *
+ * @param parallelism The maximum number of elements in flight
+ * @param context The context the transforms run in, e.g. [kotlinx.coroutines.Dispatchers.Default]
+ * @param transform Turns one element into the values it contributes, in order
+ */
+internal fun <T, R> Flow<T>.flatMapOrderedConcurrently(
+    parallelism: Int,
+    context: CoroutineContext = EmptyCoroutineContext,
+    transform: suspend (T) -> List<R>
+): Flow<R> {
+    require(parallelism > 0) { "Parallelism must be positive, got $parallelism" }
+    val upstream = this
+    return flow {
+        coroutineScope {
+            // A permit is held from starting a transform until its result was emitted.
+            // Results are wrapped so that a failure surfaces in order instead of cancelling the scope.
+            val results = Channel<Deferred<Result<List<R>>>>(Channel.UNLIMITED)
+            val permits = Semaphore(parallelism)
+            launch {
+                upstream.collect { element ->
+                    permits.acquire()
+                    results.send(async(context) { runCatching { transform(element) } })
+                }
+                results.close()
+            }
+            for (result in results) {
+                result.await().getOrThrow().forEach { emit(it) }
+                permits.release()
+            }
+        }
+    }
+}
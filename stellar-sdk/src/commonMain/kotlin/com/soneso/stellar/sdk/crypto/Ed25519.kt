@@ -1,5 +1,10 @@
 package com.soneso.stellar.sdk.crypto
 
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.joinAll
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.withContext
+
 /**
  * Platform-specific Ed25519 cryptographic operations.
  *
@@ -78,6 +83,146 @@ interface Ed25519Crypto {
      * @return true if the signature is valid, false otherwise
      */
     suspend fun verify(data: ByteArray, signature: ByteArray, publicKey: ByteArray): Boolean
+
+    /**
+     * Verifies a batch of Ed25519 signatures.
+     *
+     * Items with a malformed signature or public key length are reported as invalid rather than
+     * throwing, so a single bad entry does not abort the batch. Large batches are split into
+     * chunks and verified concurrently on platforms with more than one CPU thread.
+     *
+     * The default implementation calls [verify] once per item.
+     *
+     * @param items The signatures to verify
+     * @return A [BooleanArray] where index `i` is true if `items[i]` is valid
+     */
+    suspend fun verifyBatch(items: List<VerifyItem>): BooleanArray {
+        return BooleanArray(items.size) { index ->
+            val item = items[index]
+            item.hasValidLengths() && verify(item.data, item.signature, item.publicKey)
+        }
+    }
+
+    /**
+     * Prepares a long-lived signing key for repeated signatures with the same private key.
+     *
+     * [sign] re-derives the expanded secret key (a full scalar base multiplication) on every
+     * call. The returned [Ed25519SigningKey] performs that derivation once and keeps the
+     * expanded key for its whole lifetime, so each subsequent signature only pays for the
+     * signing operation itself.
+     *
+     * The default implementation simply delegates to [sign]; platform implementations
+     * override it with a key that is actually expanded once.
+     *
+     * @param privateKey The 32-byte Ed25519 private key (seed). The array is copied.
+     * @return A signing key that produces the same signatures as [sign]
+     */
+    suspend fun prepareSigner(privateKey: ByteArray): Ed25519SigningKey {
+        require(privateKey.size == 32) { "Private key must be 32 bytes" }
+        val seed = privateKey.copyOf()
+        val publicKey = derivePublicKey(seed)
+        return object : Ed25519SigningKey {
+            private var closed = false
+
+            override val publicKey: ByteArray get() = publicKey.copyOf()
+
+            override suspend fun sign(data: ByteArray): ByteArray {
+                check(!closed) { "Signing key has been closed" }
+                return this@Ed25519Crypto.sign(data, seed)
+            }
+
+            override fun close() {
+                closed = true
+                seed.fill(0)
+            }
+        }
+    }
+}
+
+/**
+ * A single entry of an [Ed25519Crypto.verifyBatch] call.
+ *
+ * @property data The data that was signed
+ * @property signature The 64-byte signature
+ * @property publicKey The 32-byte Ed25519 public key
+ */
+class VerifyItem(
+    val data: ByteArray,
+    val signature: ByteArray,
+    val publicKey: ByteArray
+) {
+    internal fun hasValidLengths(): Boolean = signature.size == 64 && publicKey.size == 32
+}
+
+/**
+ * Number of items verified sequentially by one worker in [verifyChunked].
+ */
+internal const val VERIFY_BATCH_CHUNK_SIZE = 64
+
+/**
+ * Splits [items] into chunks of [VERIFY_BATCH_CHUNK_SIZE] and verifies them concurrently on
+ * [Dispatchers.Default], which is bounded by the number of CPU cores.
+ *
+ * [verifyChunk] receives the start (inclusive) and end (exclusive) index of its chunk and
+ * writes its results into the shared result array; chunks never overlap.
+ */
+internal suspend fun verifyChunked(
+    items: List<VerifyItem>,
+    verifyChunk: (items: List<VerifyItem>, from: Int, to: Int, results: BooleanArray) -> Unit
+): BooleanArray {
+    val results = BooleanArray(items.size)
+    if (items.size <= VERIFY_BATCH_CHUNK_SIZE) {
+        verifyChunk(items, 0, items.size, results)
+        return results
+    }
+    withContext(Dispatchers.Default) {
+        (items.indices step VERIFY_BATCH_CHUNK_SIZE).map { from ->
+            launch {
+                verifyChunk(items, from, minOf(from + VERIFY_BATCH_CHUNK_SIZE, items.size), results)
+            }
+        }.joinAll()
+    }
+    return results
+}
+
+/**
+ * An Ed25519 private key that has been expanded once and can sign repeatedly.
+ *
+ * Obtained from [Ed25519Crypto.prepareSigner]. Implementations are thread-safe: a single
+ * instance may be used concurrently from multiple coroutines.
+ *
+ * ### Native
+ * The 64-byte expanded secret key lives in libsodium guarded memory (`sodium_malloc`),
+ * is read-only after derivation and is wiped when [close] is called or the key becomes unreachable.
+ *
+ * ### JVM
+ * Keeps the BouncyCastle `Ed25519PrivateKeyParameters`, whose public key is derived once.
+ *
+ * ### JavaScript
+ * Keeps the libsodium.js expanded secret key.
+ */
+interface Ed25519SigningKey {
+    /**
+     * The 32-byte Ed25519 public key matching this signing key.
+     */
+    val publicKey: ByteArray
+
+    /**
+     * Signs data using the prepared key.
+     *
+     * @param data The data to sign
+     * @return The 64-byte signature
+     * @throws IllegalStateException if the key has been closed
+     */
+    suspend fun sign(data: ByteArray): ByteArray
+
+    /**
+     * Wipes the key material. The key must not be used afterwards.
+     *
+     * May be called while [sign] runs on another thread: signatures already in progress
+     * complete, later calls to [sign] throw.
+     */
+    fun close()
 }
 
 /**
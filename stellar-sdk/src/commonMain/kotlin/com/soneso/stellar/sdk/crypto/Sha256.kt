@@ -41,6 +41,44 @@ interface Sha256Crypto {
      * @return The 32-byte SHA-256 hash
      */
     suspend fun hash(data: ByteArray): ByteArray
+
+    /**
+     * Creates a streaming SHA-256 hasher.
+     *
+     * Use this instead of [hash] when the input is produced incrementally (for example by an
+     * [com.soneso.stellar.sdk.xdr.XdrWriter] writing into a sink), so the complete input never
+     * has to be materialized as one array.
+     *
+     * The function is suspend so JavaScript can finish libsodium initialization; the returned
+     * hasher itself is synchronous.
+     *
+     * @return A fresh hasher in its initial state
+     */
+    suspend fun newHasher(): Sha256Hasher
+}
+
+/**
+ * Incremental SHA-256 computation (init/update/final).
+ *
+ * A hasher is created in its initialized state by [Sha256Crypto.newHasher], accepts any number of
+ * [update] calls and is finished by [digest]. It is single-use and not thread-safe.
+ */
+interface Sha256Hasher {
+    /**
+     * Feeds a range of bytes into the hash state.
+     *
+     * @param data The source array
+     * @param offset Start index in [data]
+     * @param length Number of bytes to consume
+     */
+    fun update(data: ByteArray, offset: Int = 0, length: Int = data.size - offset)
+
+    /**
+     * Finishes the computation and returns the hash. The hasher must not be used afterwards.
+     *
+     * @return The 32-byte SHA-256 hash
+     */
+    fun digest(): ByteArray
 }
 
 /**
@@ -0,0 +1,176 @@
+package com.soneso.stellar.sdk.horizon
+
+import com.soneso.stellar.sdk.flatMapOrderedConcurrently
+import com.soneso.stellar.sdk.horizon.requests.RequestBuilder
+import com.soneso.stellar.sdk.horizon.responses.LedgerResponse
+import com.soneso.stellar.sdk.horizon.responses.TransactionResponse
+import com.soneso.stellar.sdk.horizon.responses.effects.EffectResponse
+import com.soneso.stellar.sdk.horizon.responses.operations.OperationResponse
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.flow
+import kotlinx.coroutines.flow.take
+import kotlinx.coroutines.flow.toList
+
+/**
+ * Fetches the transactions, operations or effects of a ledger range with concurrent requests.
+ *
+ * A single cursor walk issues one request after the other, which makes backfilling years of
+ * history slow. This fetcher splits the ledger range into disjoint shards of [shardSize]
+ * ledgers and fetches up to [maxConnections] shards at the same time. Within a shard, the
+ * ledgers are listed with [HorizonServer.ledgers], and the records of every ledger that has
+ * any are fetched through its `forLedger` sub-resource.
+ *
+ * Shards are emitted in ledger order, and records in ascending order within a ledger, so the
+ * resulting flow is in paging-token order, as a cursor walk over the same range would be.
+ *
+ * Each shard in flight issues one request at a time, so at most [maxConnections] requests run
+ * concurrently. A fetched shard is buffered until the shards before it were emitted, which
+ * bounds memory to about [maxConnections] shards.
+ *
+ * ## Usage
+ *
+ * ```kotlin
+ * val fetcher = LedgerRangeFetcher(server, shardSize = 500, maxConnections = 16)
+ * fetcher.operations(50_000_000L..50_100_000L, includeFailed = true).collect { operation ->
+ *     store(operation)
+ * }
+ * ```
+ *
+ * @param server Horizon server to fetch from
+ * @param shardSize Number of consecutive ledgers fetched as one shard
+ * @param maxConnections Maximum number of concurrent requests, and of shards held in memory
+ */
+class LedgerRangeFetcher(
+    private val server: HorizonServer,
+    private val shardSize: Int = DEFAULT_SHARD_SIZE,
+    private val maxConnections: Int = DEFAULT_MAX_CONNECTIONS
+) {
+    companion object {
+        /**
+         * Default number of ledgers per shard.
+         */
+        const val DEFAULT_SHARD_SIZE = 1_000
+
+        /**
+         * Default number of concurrent requests.
+         */
+        const val DEFAULT_MAX_CONNECTIONS = 8
+
+        // Largest page size Horizon accepts
+        private const val MAX_PAGE_LIMIT = 200
+    }
+
+    init {
+        require(shardSize > 0) { "Shard size must be positive, got $shardSize" }
+        require(maxConnections > 0) { "Max connections must be positive, got $maxConnections" }
+    }
+
+    /**
+     * Fetches the transactions of all ledgers in [ledgers].
+     *
+     * @param ledgers Range of ledger sequence numbers
+     * @param includeFailed Whether to include failed transactions
+     * @return [Flow] of [TransactionResponse] in paging-token order
+     */
+    fun transactions(ledgers: LongRange, includeFailed: Boolean = false): Flow<TransactionResponse> =
+        fetch(
+            ledgers,
+            hasRecords = { ledger ->
+                val successful = ledger.successfulTransactionCount ?: 1
+                val failed = if (includeFailed) ledger.failedTransactionCount ?: 1 else 0
+                successful + failed > 0
+            }
+        ) { sequence ->
+            server.transactions()
+                .forLedger(sequence)
+                .includeFailed(includeFailed)
+                .limit(MAX_PAGE_LIMIT)
+                .order(RequestBuilder.Order.ASC)
+                .asFlow(prefetch = 0)
+        }
+
+    /**
+     * Fetches the operations of all ledgers in [ledgers].
+     *
+     * @param ledgers Range of ledger sequence numbers
+     * @param includeFailed Whether to include operations of failed transactions
+     * @return [Flow] of [OperationResponse] in paging-token order
+     */
+    fun operations(ledgers: LongRange, includeFailed: Boolean = false): Flow<OperationResponse> =
+        fetch(
+            ledgers,
+            hasRecords = { ledger ->
+                val count = if (includeFailed) ledger.txSetOperationCount else ledger.operationCount
+                (count ?: 1) > 0
+            }
+        ) { sequence ->
+            server.operations()
+                .forLedger(sequence)
+                .includeFailed(includeFailed)
+                .limit(MAX_PAGE_LIMIT)
+                .order(RequestBuilder.Order.ASC)
+                .asFlow(prefetch = 0)
+        }
+
+    /**
+     * Fetches the effects of all ledgers in [ledgers].
+     *
+     * @param ledgers Range of ledger sequence numbers
+     * @return [Flow] of [EffectResponse] in paging-token order
+     */
+    fun effects(ledgers: LongRange): Flow<EffectResponse> =
+        fetch(
+            ledgers,
+            // Only successful operations have effects
+            hasRecords = { ledger -> (ledger.operationCount ?: 1) > 0 }
+        ) { sequence ->
+            server.effects()
+                .forLedger(sequence)
+                .limit(MAX_PAGE_LIMIT)
+                .order(RequestBuilder.Order.ASC)
+                .asFlow(prefetch = 0)
+        }
+
+    private fun <T> fetch(
+        ledgers: LongRange,
+        hasRecords: (LedgerResponse) -> Boolean,
+        forLedger: (Long) -> Flow<T>
+    ): Flow<T> {
+        require(ledgers.first > 0) { "Ledger sequence must be positive, got ${ledgers.first}" }
+        val shards = flow {
+            if (ledgers.isEmpty()) return@flow
+            var first = ledgers.first
+            while (true) {
+                val last = minOf(ledgers.last, first + shardSize - 1)
+                emit(first..last)
+                if (last == ledgers.last) break
+                first = last + 1
+            }
+        }
+        return shards.flatMapOrderedConcurrently(maxConnections) { shard -> fetchShard(shard, hasRecords, forLedger) }
+    }
+
+    private suspend fun <T> fetchShard(
+        shard: LongRange,
+        hasRecords: (LedgerResponse) -> Boolean,
+        forLedger: (Long) -> Flow<T>
+    ): List<T> {
+        val records = ArrayList<T>()
+        // A ledger's paging token is its sequence in the upper 32 bits of a TOID
+        val cursor = (shard.first - 1) shl 32
+        val size = shard.last - shard.first + 1
+        server.ledgers()
+            .cursor(cursor.toString())
+            .limit(minOf(MAX_PAGE_LIMIT.toLong(), size).toInt())
+            .order(RequestBuilder.Order.ASC)
+            .asFlow(prefetch = 0)
+            // Stops before requesting the page after the shard's last ledger
+            .take(size.toInt())
+            .collect { ledger ->
+                if (hasRecords(ledger)) {
+                    records.addAll(forLedger(ledger.sequence).toList())
+                }
+            }
+        return records
+    }
+}
@@ -5,6 +5,7 @@ import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
 import com.soneso.stellar.sdk.horizon.responses.AccountResponse
 import com.soneso.stellar.sdk.horizon.responses.Page
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to accounts.
@@ -147,6 +148,16 @@ class AccountsRequestBuilder(
         return executeGetRequest(buildUrl())
     }
 
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [AccountResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<AccountResponse> = pagedFlow(prefetch) { execute() }
+
     /**
      * Requests a specific data entry for an account.
      *
@@ -5,6 +5,7 @@ import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
 import com.soneso.stellar.sdk.horizon.responses.AssetResponse
 import com.soneso.stellar.sdk.horizon.responses.Page
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to assets.
@@ -87,6 +88,16 @@ class AssetsRequestBuilder(
         return executeGetRequest(buildUrl())
     }
 
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [AssetResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<AssetResponse> = pagedFlow(prefetch) { execute() }
+
     /**
      * Sets the cursor parameter for pagination.
      *
@@ -4,6 +4,7 @@ import com.soneso.stellar.sdk.horizon.responses.Page
 import com.soneso.stellar.sdk.horizon.responses.effects.EffectResponse
 import io.ktor.client.*
 import io.ktor.http.*
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to effects.
@@ -107,4 +108,14 @@ class EffectsRequestBuilder(
     suspend fun execute(): Page<EffectResponse> {
         return executeGetRequest(buildUrl())
     }
+
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [EffectResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<EffectResponse> = pagedFlow(prefetch) { execute() }
 }
@@ -5,6 +5,7 @@ import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
 import com.soneso.stellar.sdk.horizon.responses.LedgerResponse
 import com.soneso.stellar.sdk.horizon.responses.Page
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to ledgers.
@@ -72,6 +73,16 @@ class LedgersRequestBuilder(
         return executeGetRequest(buildUrl())
     }
 
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [LedgerResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<LedgerResponse> = pagedFlow(prefetch) { execute() }
+
     /**
      * Sets the cursor parameter for pagination.
      *
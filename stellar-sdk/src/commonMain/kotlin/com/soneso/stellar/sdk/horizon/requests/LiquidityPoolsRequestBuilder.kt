@@ -5,6 +5,7 @@ import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
 import com.soneso.stellar.sdk.horizon.responses.LiquidityPoolResponse
 import com.soneso.stellar.sdk.horizon.responses.Page
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to liquidity pools.
@@ -117,6 +118,16 @@ class LiquidityPoolsRequestBuilder(
         return executeGetRequest(buildUrl())
     }
 
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [LiquidityPoolResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<LiquidityPoolResponse> = pagedFlow(prefetch) { execute() }
+
     /**
      * Sets the cursor parameter for pagination.
      *
@@ -5,6 +5,7 @@ import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
 import com.soneso.stellar.sdk.horizon.responses.Page
 import com.soneso.stellar.sdk.horizon.responses.operations.OperationResponse
+import kotlinx.coroutines.flow.Flow
 
 /**
  * Builds requests connected to operations.
@@ -155,6 +156,16 @@ class OperationsRequestBuilder(
         return executeGetRequest(buildUrl())
     }
 
+    /**
+     * Streams the records of all pages, starting with the page this request selects.
+     *
+     * The next page is fetched while the current one is consumed; see [RequestBuilder.pagedFlow].
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @return [Flow] of [OperationResponse] across all pages
+     */
+    fun asFlow(prefetch: Int = DEFAULT_PAGE_PREFETCH): Flow<OperationResponse> = pagedFlow(prefetch) { execute() }
+
     override fun cursor(cursor: String): OperationsRequestBuilder {
         super.cursor(cursor)
         return this
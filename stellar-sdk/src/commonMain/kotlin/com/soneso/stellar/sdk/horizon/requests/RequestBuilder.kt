@@ -5,7 +5,14 @@ import io.ktor.client.call.*
 import io.ktor.client.request.*
 import io.ktor.http.*
 import com.soneso.stellar.sdk.horizon.exceptions.*
+import com.soneso.stellar.sdk.horizon.responses.Page
 import com.soneso.stellar.sdk.horizon.responses.Response
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.ensureActive
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.flow
+import kotlinx.coroutines.launch
 import kotlinx.serialization.KSerializer
 import kotlin.time.Duration
 
@@ -176,6 +183,56 @@ abstract class RequestBuilder(
         )
     }
 
+    /**
+     * Streams the records of the page selected by [firstPage] and of all following pages.
+     *
+     * Pages are fetched by a producer coroutine that runs up to [prefetch] pages ahead of the
+     * collector, so fetching page N+1 overlaps with consuming page N. With a [prefetch] of 0
+     * the next page is only requested once the current one was consumed. The stream ends at
+     * the first empty page; cancelling the collector cancels pending requests.
+     *
+     * @param prefetch How many pages are fetched ahead of the page being consumed
+     * @param firstPage Executes this request
+     * @return The records of all pages
+     */
+    protected inline fun <reified T> pagedFlow(
+        prefetch: Int,
+        crossinline firstPage: suspend () -> Page<T>
+    ): Flow<T> {
+        require(prefetch >= 0) { "Prefetch must not be negative, got $prefetch" }
+        return flow {
+            if (prefetch == 0) {
+                var page: Page<T>? = firstPage()
+                while (page != null && page.records.isNotEmpty()) {
+                    page.records.forEach { emit(it) }
+                    page = page.getNextPage<T>(httpClient)
+                }
+                return@flow
+            }
+            coroutineScope {
+                // A page handed to the collector is being consumed; prefetch - 1 more wait in the channel
+                val pages = Channel<Page<T>>(prefetch - 1)
+                launch {
+                    var page: Page<T>? = firstPage()
+                    while (page != null && page.records.isNotEmpty()) {
+                        pages.send(page)
+                        page = try {
+                            page.getNextPage<T>(httpClient)
+                        } catch (e: ConnectionErrorException) {
+                            // Requests interrupted by cancellation are reported as connection errors
+                            ensureActive()
+                            throw e
+                        }
+                    }
+                    pages.close()
+                }
+                for (page in pages) {
+                    page.records.forEach { emit(it) }
+                }
+            }
+        }
+    }
+
     /**
      * Sets an asset parameter on the request.
      * The asset is encoded as "assetCode:issuerAccountId" for credit assets or "native" for XLM.
@@ -267,6 +324,13 @@ abstract class RequestBuilder(
         uriBuilder.parameters[parameterName] = encodedAssets.joinToString(",")
     }
 
+    companion object {
+        /**
+         * Default number of pages fetched ahead by `asFlow()`.
+         */
+        const val DEFAULT_PAGE_PREFETCH = 1
+    }
+
     /**
      * Represents possible order parameter values.
      */
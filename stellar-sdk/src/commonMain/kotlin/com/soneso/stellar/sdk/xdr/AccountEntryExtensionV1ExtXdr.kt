@@ -39,6 +39,15 @@ sealed class AccountEntryExtensionV1ExtXdr {
         else -> throw IllegalArgumentException("Unknown AccountEntryExtensionV1ExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        2 -> AccountEntryExtensionV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown AccountEntryExtensionV1ExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class AccountEntryExtensionV1ExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V2 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
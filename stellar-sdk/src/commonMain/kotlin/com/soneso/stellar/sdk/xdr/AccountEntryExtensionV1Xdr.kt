@@ -30,10 +30,22 @@ data class AccountEntryExtensionV1Xdr(
       val ext = AccountEntryExtensionV1ExtXdr.decode(reader)
       return AccountEntryExtensionV1Xdr(liabilities, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      LiabilitiesXdr.skip(reader)
+      AccountEntryExtensionV1ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     liabilities.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liabilities.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
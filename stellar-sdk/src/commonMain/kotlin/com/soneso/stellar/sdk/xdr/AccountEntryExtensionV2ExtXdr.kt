@@ -39,6 +39,15 @@ sealed class AccountEntryExtensionV2ExtXdr {
         else -> throw IllegalArgumentException("Unknown AccountEntryExtensionV2ExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        3 -> AccountEntryExtensionV3Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown AccountEntryExtensionV2ExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class AccountEntryExtensionV2ExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V3 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -36,6 +36,13 @@ data class AccountEntryExtensionV2Xdr(
       val ext = AccountEntryExtensionV2ExtXdr.decode(reader)
       return AccountEntryExtensionV2Xdr(numSponsored, numSponsoring, signerSponsoringIDs, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      repeat(reader.readInt()) { SponsorshipDescriptorXdr.skip(reader) }
+      AccountEntryExtensionV2ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -47,4 +54,16 @@ data class AccountEntryExtensionV2Xdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += numSponsored.encodedSize()
+    size += numSponsoring.encodedSize()
+    size += 4
+    signerSponsoringIDs.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
 }
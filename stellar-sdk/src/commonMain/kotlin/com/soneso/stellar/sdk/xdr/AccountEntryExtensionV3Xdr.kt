@@ -37,6 +37,12 @@ data class AccountEntryExtensionV3Xdr(
       val seqTime = TimePointXdr.decode(reader)
       return AccountEntryExtensionV3Xdr(ext, seqLedger, seqTime)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      TimePointXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +50,12 @@ data class AccountEntryExtensionV3Xdr(
     seqLedger.encode(writer)
     seqTime.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += seqLedger.encodedSize()
+    size += seqTime.encodedSize()
+    return size
+  }
 }
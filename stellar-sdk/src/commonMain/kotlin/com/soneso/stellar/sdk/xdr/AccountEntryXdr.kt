@@ -75,6 +75,19 @@ data class AccountEntryXdr(
       val ext = AccountEntryExtXdr.decode(reader)
       return AccountEntryXdr(accountId, balance, seqNum, numSubEntries, inflationDest, flags, homeDomain, thresholds, signers, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      SequenceNumberXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) AccountIDXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      String32Xdr.skip(reader)
+      ThresholdsXdr.skip(reader)
+      repeat(reader.readInt()) { SignerXdr.skip(reader) }
+      AccountEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -97,4 +110,56 @@ data class AccountEntryXdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += balance.encodedSize()
+    size += seqNum.encodedSize()
+    size += numSubEntries.encodedSize()
+    if (inflationDest != null) {
+      size += 4
+      size += inflationDest.encodedSize()
+    } else {
+      size += 4
+    }
+    size += flags.encodedSize()
+    size += homeDomain.encodedSize()
+    size += thresholds.encodedSize()
+    size += 4
+    signers.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is AccountEntryXdr) return false
+    return accountId == other.accountId &&
+      balance == other.balance &&
+      seqNum == other.seqNum &&
+      numSubEntries == other.numSubEntries &&
+      inflationDest == other.inflationDest &&
+      flags == other.flags &&
+      homeDomain == other.homeDomain &&
+      thresholds.contentEquals(other.thresholds) &&
+      signers == other.signers &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = accountId.hashCode()
+    result = 31 * result + balance.hashCode()
+    result = 31 * result + seqNum.hashCode()
+    result = 31 * result + numSubEntries.hashCode()
+    result = 31 * result + inflationDest.hashCode()
+    result = 31 * result + flags.hashCode()
+    result = 31 * result + homeDomain.hashCode()
+    result = 31 * result + thresholds.contentHashCode()
+    result = 31 * result + signers.hashCode()
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
@@ -51,9 +51,15 @@ enum class AccountFlagsXdr(val value: Int) {
       return entries.find { it.value == value }
         ?: throw IllegalArgumentException("Unknown AccountFlagsXdr value: $value")
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeInt(value)
   }
+
+  fun encodedSize(): Int = 4
 }
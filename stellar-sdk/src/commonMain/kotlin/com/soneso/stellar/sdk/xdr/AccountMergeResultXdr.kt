@@ -51,6 +51,21 @@ sealed class AccountMergeResultXdr {
         else -> throw IllegalArgumentException("Unknown AccountMergeResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AccountMergeResultCodeXdr.decode(reader)
+      when (discriminant) {
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_SUCCESS -> Int64Xdr.skip(reader)
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_MALFORMED -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_NO_ACCOUNT -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_IMMUTABLE_SET -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_HAS_SUB_ENTRIES -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_SEQNUM_TOO_FAR -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_DEST_FULL -> {}
+        AccountMergeResultCodeXdr.ACCOUNT_MERGE_IS_SPONSOR -> {}
+        else -> throw IllegalArgumentException("Unknown AccountMergeResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -62,4 +77,16 @@ sealed class AccountMergeResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is SourceAccountBalance -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -28,6 +28,12 @@ data class AllowTrustOpXdr(
       val authorize = Uint32Xdr.decode(reader)
       return AllowTrustOpXdr(trustor, asset, authorize)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      AssetCodeXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +41,12 @@ data class AllowTrustOpXdr(
     asset.encode(writer)
     authorize.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += trustor.encodedSize()
+    size += asset.encodedSize()
+    size += authorize.encodedSize()
+    return size
+  }
 }
@@ -46,9 +46,15 @@ enum class AllowTrustResultCodeXdr(val value: Int) {
       return entries.find { it.value == value }
         ?: throw IllegalArgumentException("Unknown AllowTrustResultCodeXdr value: $value")
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeInt(value)
   }
+
+  fun encodedSize(): Int = 4
 }
@@ -40,6 +40,20 @@ sealed class AllowTrustResultXdr {
         else -> throw IllegalArgumentException("Unknown AllowTrustResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AllowTrustResultCodeXdr.decode(reader)
+      when (discriminant) {
+        AllowTrustResultCodeXdr.ALLOW_TRUST_SUCCESS -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_MALFORMED -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_NO_TRUST_LINE -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_TRUST_NOT_REQUIRED -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_CANT_REVOKE -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_SELF_NOT_ALLOWED -> {}
+        AllowTrustResultCodeXdr.ALLOW_TRUST_LOW_RESERVE -> {}
+        else -> throw IllegalArgumentException("Unknown AllowTrustResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -48,4 +62,13 @@ sealed class AllowTrustResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
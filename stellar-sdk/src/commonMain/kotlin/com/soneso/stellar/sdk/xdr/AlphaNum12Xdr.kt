@@ -22,10 +22,35 @@ data class AlphaNum12Xdr(
       val issuer = AccountIDXdr.decode(reader)
       return AlphaNum12Xdr(assetCode, issuer)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetCode12Xdr.skip(reader)
+      AccountIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     assetCode.encode(writer)
     issuer.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += assetCode.encodedSize()
+    size += issuer.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is AlphaNum12Xdr) return false
+    return assetCode.contentEquals(other.assetCode) &&
+      issuer == other.issuer
+  }
+
+  override fun hashCode(): Int {
+    var result = assetCode.contentHashCode()
+    result = 31 * result + issuer.hashCode()
+    return result
+  }
 }
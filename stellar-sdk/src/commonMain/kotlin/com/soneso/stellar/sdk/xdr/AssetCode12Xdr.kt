@@ -15,9 +15,25 @@ value class AssetCode12Xdr(val value: ByteArray) {
       val value = reader.readFixedOpaque(12)
       return AssetCode12Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(12)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(value, 12)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(12)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun AssetCode12Xdr?.contentEquals(other: AssetCode12Xdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun AssetCode12Xdr?.contentHashCode(): Int = this?.value.contentHashCode()
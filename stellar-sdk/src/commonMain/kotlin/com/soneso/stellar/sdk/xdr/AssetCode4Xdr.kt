@@ -15,9 +15,25 @@ value class AssetCode4Xdr(val value: ByteArray) {
       val value = reader.readFixedOpaque(4)
       return AssetCode4Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(value, 4)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(4)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun AssetCode4Xdr?.contentEquals(other: AssetCode4Xdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun AssetCode4Xdr?.contentHashCode(): Int = this?.value.contentHashCode()
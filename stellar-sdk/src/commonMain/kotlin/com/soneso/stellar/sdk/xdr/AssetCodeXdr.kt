@@ -23,12 +23,28 @@ sealed class AssetCodeXdr {
     val value: AssetCode4Xdr
   ) : AssetCodeXdr() {
     override val discriminant: AssetTypeXdr = AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM4
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is AssetCode4) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class AssetCode12(
     val value: AssetCode12Xdr
   ) : AssetCodeXdr() {
     override val discriminant: AssetTypeXdr = AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM12
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is AssetCode12) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   companion object {
@@ -47,6 +63,15 @@ sealed class AssetCodeXdr {
         else -> throw IllegalArgumentException("Unknown AssetCodeXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AssetTypeXdr.decode(reader)
+      when (discriminant) {
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM4 -> AssetCode4Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM12 -> AssetCode12Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown AssetCodeXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -60,4 +85,18 @@ sealed class AssetCodeXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is AssetCode4 -> {
+        size += value.encodedSize()
+      }
+      is AssetCode12 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -26,9 +26,15 @@ enum class AssetTypeXdr(val value: Int) {
       return entries.find { it.value == value }
         ?: throw IllegalArgumentException("Unknown AssetTypeXdr value: $value")
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeInt(value)
   }
+
+  fun encodedSize(): Int = 4
 }
@@ -56,6 +56,16 @@ sealed class AssetXdr {
         else -> throw IllegalArgumentException("Unknown AssetXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AssetTypeXdr.decode(reader)
+      when (discriminant) {
+        AssetTypeXdr.ASSET_TYPE_NATIVE -> {}
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM4 -> AlphaNum4Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM12 -> AlphaNum12Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown AssetXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -70,4 +80,19 @@ sealed class AssetXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is AlphaNum4 -> {
+        size += value.encodedSize()
+      }
+      is AlphaNum12 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -0,0 +1,45 @@
+package com.soneso.stellar.sdk.xdr
+
+import com.soneso.stellar.sdk.decodeBase64
+
+/**
+ * [XdrSource] that decodes a Base64 string incrementally.
+ *
+ * Feeding an [XdrReader] from this source decodes large payloads, such as `LedgerCloseMeta`
+ * returned by `getLedgers`, without first materializing the whole binary encoding: the text
+ * is decoded [BASE64_SOURCE_CHUNK_LENGTH] characters at a time, each chunk through the
+ * platform codec (libsodium on Kotlin/Native).
+ *
+ * ```kotlin
+ * val meta = LedgerCloseMetaXdr.decode(XdrReader(Base64XdrSource(metadataXdr)))
+ * ```
+ *
+ * @param base64 Padded, standard-alphabet Base64 text
+ */
+class Base64XdrSource(private val base64: CharSequence) : XdrSource {
+    private var position = 0
+    // Bytes of the last decoded chunk not yet handed out
+    private var decoded = ByteArray(0)
+    private var decodedStart = 0
+
+    override fun read(buffer: ByteArray, offset: Int, length: Int): Int {
+        if (length == 0) return 0
+        if (decodedStart == decoded.size) {
+            if (position == base64.length) return -1
+            // Chunks are whole 4-character groups, so padding can only end the last one
+            val end = minOf(position + BASE64_SOURCE_CHUNK_LENGTH, base64.length)
+            decoded = decodeBase64(base64.substring(position, end))
+            decodedStart = 0
+            position = end
+        }
+        val count = minOf(length, decoded.size - decodedStart)
+        decoded.copyInto(buffer, offset, decodedStart, decodedStart + count)
+        decodedStart += count
+        return count
+    }
+}
+
+/**
+ * Number of Base64 characters a [Base64XdrSource] decodes at a time; a multiple of four.
+ */
+internal const val BASE64_SOURCE_CHUNK_LENGTH = 65536
@@ -19,9 +19,19 @@ data class BeginSponsoringFutureReservesOpXdr(
       val sponsoredId = AccountIDXdr.decode(reader)
       return BeginSponsoringFutureReservesOpXdr(sponsoredId)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     sponsoredId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sponsoredId.encodedSize()
+    return size
+  }
 }
@@ -31,9 +31,15 @@ enum class BeginSponsoringFutureReservesResultCodeXdr(val value: Int) {
       return entries.find { it.value == value }
         ?: throw IllegalArgumentException("Unknown BeginSponsoringFutureReservesResultCodeXdr value: $value")
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeInt(value)
   }
+
+  fun encodedSize(): Int = 4
 }
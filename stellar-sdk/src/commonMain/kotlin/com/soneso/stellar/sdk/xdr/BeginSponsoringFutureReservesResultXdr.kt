@@ -35,6 +35,17 @@ sealed class BeginSponsoringFutureReservesResultXdr {
         else -> throw IllegalArgumentException("Unknown BeginSponsoringFutureReservesResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = BeginSponsoringFutureReservesResultCodeXdr.decode(reader)
+      when (discriminant) {
+        BeginSponsoringFutureReservesResultCodeXdr.BEGIN_SPONSORING_FUTURE_RESERVES_SUCCESS -> {}
+        BeginSponsoringFutureReservesResultCodeXdr.BEGIN_SPONSORING_FUTURE_RESERVES_MALFORMED -> {}
+        BeginSponsoringFutureReservesResultCodeXdr.BEGIN_SPONSORING_FUTURE_RESERVES_ALREADY_SPONSORED -> {}
+        BeginSponsoringFutureReservesResultCodeXdr.BEGIN_SPONSORING_FUTURE_RESERVES_RECURSIVE -> {}
+        else -> throw IllegalArgumentException("Unknown BeginSponsoringFutureReservesResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -43,4 +54,13 @@ sealed class BeginSponsoringFutureReservesResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -21,10 +21,9 @@ sealed class BucketEntryXdr {
   abstract val discriminant: BucketEntryTypeXdr
 
   data class LiveEntry(
-    val value: LedgerEntryXdr
-  ) : BucketEntryXdr() {
+    val value: LedgerEntryXdr,
     override val discriminant: BucketEntryTypeXdr = BucketEntryTypeXdr.LIVEENTRY
-  }
+  ) : BucketEntryXdr()
 
   data class DeadEntry(
     val value: LedgerKeyXdr
@@ -45,11 +44,11 @@ sealed class BucketEntryXdr {
       return when (discriminant) {
         BucketEntryTypeXdr.LIVEENTRY -> {
           val value = LedgerEntryXdr.decode(reader)
-          LiveEntry(value)
+          LiveEntry(value, discriminant)
         }
         BucketEntryTypeXdr.INITENTRY -> {
           val value = LedgerEntryXdr.decode(reader)
-          LiveEntry(value)
+          LiveEntry(value, discriminant)
         }
         BucketEntryTypeXdr.DEADENTRY -> {
           val value = LedgerKeyXdr.decode(reader)
@@ -62,6 +61,17 @@ sealed class BucketEntryXdr {
         else -> throw IllegalArgumentException("Unknown BucketEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = BucketEntryTypeXdr.decode(reader)
+      when (discriminant) {
+        BucketEntryTypeXdr.LIVEENTRY -> LedgerEntryXdr.skip(reader)
+        BucketEntryTypeXdr.INITENTRY -> LedgerEntryXdr.skip(reader)
+        BucketEntryTypeXdr.DEADENTRY -> LedgerKeyXdr.skip(reader)
+        BucketEntryTypeXdr.METAENTRY -> BucketMetadataXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown BucketEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -78,4 +88,21 @@ sealed class BucketEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is LiveEntry -> {
+        size += value.encodedSize()
+      }
+      is DeadEntry -> {
+        size += value.encodedSize()
+      }
+      is MetaEntry -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
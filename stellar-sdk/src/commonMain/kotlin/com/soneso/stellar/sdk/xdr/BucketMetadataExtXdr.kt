@@ -39,6 +39,15 @@ sealed class BucketMetadataExtXdr {
         else -> throw IllegalArgumentException("Unknown BucketMetadataExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> BucketListTypeXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown BucketMetadataExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class BucketMetadataExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is BucketListType -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -33,10 +33,22 @@ data class BucketMetadataXdr(
       val ext = BucketMetadataExtXdr.decode(reader)
       return BucketMetadataXdr(ledgerVersion, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      BucketMetadataExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ledgerVersion.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerVersion.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
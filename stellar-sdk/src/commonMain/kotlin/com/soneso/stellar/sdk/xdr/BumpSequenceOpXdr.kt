@@ -19,9 +19,19 @@ data class BumpSequenceOpXdr(
       val bumpTo = SequenceNumberXdr.decode(reader)
       return BumpSequenceOpXdr(bumpTo)
     }
+
+    fun skip(reader: XdrReader) {
+      SequenceNumberXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     bumpTo.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += bumpTo.encodedSize()
+    return size
+  }
 }
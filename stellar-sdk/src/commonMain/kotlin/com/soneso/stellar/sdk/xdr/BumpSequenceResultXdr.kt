@@ -30,6 +30,15 @@ sealed class BumpSequenceResultXdr {
         else -> throw IllegalArgumentException("Unknown BumpSequenceResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = BumpSequenceResultCodeXdr.decode(reader)
+      when (discriminant) {
+        BumpSequenceResultCodeXdr.BUMP_SEQUENCE_SUCCESS -> {}
+        BumpSequenceResultCodeXdr.BUMP_SEQUENCE_BAD_SEQ -> {}
+        else -> throw IllegalArgumentException("Unknown BumpSequenceResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -38,4 +47,13 @@ sealed class BumpSequenceResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
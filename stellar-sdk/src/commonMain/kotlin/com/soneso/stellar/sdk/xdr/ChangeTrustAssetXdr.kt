@@ -69,6 +69,17 @@ sealed class ChangeTrustAssetXdr {
         else -> throw IllegalArgumentException("Unknown ChangeTrustAssetXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AssetTypeXdr.decode(reader)
+      when (discriminant) {
+        AssetTypeXdr.ASSET_TYPE_NATIVE -> {}
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM4 -> AlphaNum4Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM12 -> AlphaNum12Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_POOL_SHARE -> LiquidityPoolParametersXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ChangeTrustAssetXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -86,4 +97,22 @@ sealed class ChangeTrustAssetXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is AlphaNum4 -> {
+        size += value.encodedSize()
+      }
+      is AlphaNum12 -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPool -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
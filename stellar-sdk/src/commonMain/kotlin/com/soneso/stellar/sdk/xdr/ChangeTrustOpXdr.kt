@@ -25,10 +25,22 @@ data class ChangeTrustOpXdr(
       val limit = Int64Xdr.decode(reader)
       return ChangeTrustOpXdr(line, limit)
     }
+
+    fun skip(reader: XdrReader) {
+      ChangeTrustAssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     line.encode(writer)
     limit.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += line.encodedSize()
+    size += limit.encodedSize()
+    return size
+  }
 }
@@ -44,6 +44,22 @@ sealed class ChangeTrustResultXdr {
         else -> throw IllegalArgumentException("Unknown ChangeTrustResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ChangeTrustResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_SUCCESS -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_MALFORMED -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_NO_ISSUER -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_INVALID_LIMIT -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_LOW_RESERVE -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_SELF_NOT_ALLOWED -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_TRUST_LINE_MISSING -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_CANNOT_DELETE -> {}
+        ChangeTrustResultCodeXdr.CHANGE_TRUST_NOT_AUTH_MAINTAIN_LIABILITIES -> {}
+        else -> throw IllegalArgumentException("Unknown ChangeTrustResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -52,4 +68,13 @@ sealed class ChangeTrustResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -56,6 +56,16 @@ sealed class ClaimAtomXdr {
         else -> throw IllegalArgumentException("Unknown ClaimAtomXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClaimAtomTypeXdr.decode(reader)
+      when (discriminant) {
+        ClaimAtomTypeXdr.CLAIM_ATOM_TYPE_V0 -> ClaimOfferAtomV0Xdr.skip(reader)
+        ClaimAtomTypeXdr.CLAIM_ATOM_TYPE_ORDER_BOOK -> ClaimOfferAtomXdr.skip(reader)
+        ClaimAtomTypeXdr.CLAIM_ATOM_TYPE_LIQUIDITY_POOL -> ClaimLiquidityAtomXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ClaimAtomXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +82,21 @@ sealed class ClaimAtomXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+      is OrderBook -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPool -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
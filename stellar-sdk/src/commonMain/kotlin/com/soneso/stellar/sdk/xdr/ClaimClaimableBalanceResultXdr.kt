@@ -38,6 +38,19 @@ sealed class ClaimClaimableBalanceResultXdr {
         else -> throw IllegalArgumentException("Unknown ClaimClaimableBalanceResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClaimClaimableBalanceResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_SUCCESS -> {}
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_DOES_NOT_EXIST -> {}
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_CANNOT_CLAIM -> {}
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_LINE_FULL -> {}
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_NO_TRUST -> {}
+        ClaimClaimableBalanceResultCodeXdr.CLAIM_CLAIMABLE_BALANCE_NOT_AUTHORIZED -> {}
+        else -> throw IllegalArgumentException("Unknown ClaimClaimableBalanceResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +59,13 @@ sealed class ClaimClaimableBalanceResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -37,6 +37,14 @@ data class ClaimLiquidityAtomXdr(
       val amountBought = Int64Xdr.decode(reader)
       return ClaimLiquidityAtomXdr(liquidityPoolId, assetSold, amountSold, assetBought, amountBought)
     }
+
+    fun skip(reader: XdrReader) {
+      PoolIDXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +54,33 @@ data class ClaimLiquidityAtomXdr(
     assetBought.encode(writer)
     amountBought.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolId.encodedSize()
+    size += assetSold.encodedSize()
+    size += amountSold.encodedSize()
+    size += assetBought.encodedSize()
+    size += amountBought.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ClaimLiquidityAtomXdr) return false
+    return liquidityPoolId.contentEquals(other.liquidityPoolId) &&
+      assetSold == other.assetSold &&
+      amountSold == other.amountSold &&
+      assetBought == other.assetBought &&
+      amountBought == other.amountBought
+  }
+
+  override fun hashCode(): Int {
+    var result = liquidityPoolId.contentHashCode()
+    result = 31 * result + assetSold.hashCode()
+    result = 31 * result + amountSold.hashCode()
+    result = 31 * result + assetBought.hashCode()
+    result = 31 * result + amountBought.hashCode()
+    return result
+  }
 }
@@ -45,6 +45,15 @@ data class ClaimOfferAtomV0Xdr(
       val amountBought = Int64Xdr.decode(reader)
       return ClaimOfferAtomV0Xdr(sellerEd25519, offerId, assetSold, amountSold, assetBought, amountBought)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint256Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -55,4 +64,36 @@ data class ClaimOfferAtomV0Xdr(
     assetBought.encode(writer)
     amountBought.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sellerEd25519.encodedSize()
+    size += offerId.encodedSize()
+    size += assetSold.encodedSize()
+    size += amountSold.encodedSize()
+    size += assetBought.encodedSize()
+    size += amountBought.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ClaimOfferAtomV0Xdr) return false
+    return sellerEd25519.contentEquals(other.sellerEd25519) &&
+      offerId == other.offerId &&
+      assetSold == other.assetSold &&
+      amountSold == other.amountSold &&
+      assetBought == other.assetBought &&
+      amountBought == other.amountBought
+  }
+
+  override fun hashCode(): Int {
+    var result = sellerEd25519.contentHashCode()
+    result = 31 * result + offerId.hashCode()
+    result = 31 * result + assetSold.hashCode()
+    result = 31 * result + amountSold.hashCode()
+    result = 31 * result + assetBought.hashCode()
+    result = 31 * result + amountBought.hashCode()
+    return result
+  }
 }
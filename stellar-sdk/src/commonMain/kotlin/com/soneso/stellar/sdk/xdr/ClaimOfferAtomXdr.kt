@@ -45,6 +45,15 @@ data class ClaimOfferAtomXdr(
       val amountBought = Int64Xdr.decode(reader)
       return ClaimOfferAtomXdr(sellerId, offerId, assetSold, amountSold, assetBought, amountBought)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -55,4 +64,15 @@ data class ClaimOfferAtomXdr(
     assetBought.encode(writer)
     amountBought.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sellerId.encodedSize()
+    size += offerId.encodedSize()
+    size += assetSold.encodedSize()
+    size += amountSold.encodedSize()
+    size += assetBought.encodedSize()
+    size += amountBought.encodedSize()
+    return size
+  }
 }
@@ -88,6 +88,19 @@ sealed class ClaimPredicateXdr {
         else -> throw IllegalArgumentException("Unknown ClaimPredicateXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClaimPredicateTypeXdr.decode(reader)
+      when (discriminant) {
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_UNCONDITIONAL -> {}
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_AND -> repeat(reader.readInt()) { ClaimPredicateXdr.skip(reader) }
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_OR -> repeat(reader.readInt()) { ClaimPredicateXdr.skip(reader) }
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_NOT -> if (reader.readBoolean()) ClaimPredicateXdr.skip(reader)
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_BEFORE_ABSOLUTE_TIME -> Int64Xdr.skip(reader)
+        ClaimPredicateTypeXdr.CLAIM_PREDICATE_BEFORE_RELATIVE_TIME -> Int64Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ClaimPredicateXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -122,4 +135,39 @@ sealed class ClaimPredicateXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is AndPredicates -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is OrPredicates -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is NotPredicate -> {
+        if (value != null) {
+          size += 4
+          size += value.encodedSize()
+        } else {
+          size += 4
+        }
+      }
+      is AbsBefore -> {
+        size += value.encodedSize()
+      }
+      is RelBefore -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -29,10 +29,22 @@ data class ClaimableBalanceEntryExtensionV1Xdr(
       val flags = Uint32Xdr.decode(reader)
       return ClaimableBalanceEntryExtensionV1Xdr(ext, flags)
     }
+
+    fun skip(reader: XdrReader) {
+      ClaimableBalanceEntryExtensionV1ExtXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ext.encode(writer)
     flags.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += flags.encodedSize()
+    return size
+  }
 }
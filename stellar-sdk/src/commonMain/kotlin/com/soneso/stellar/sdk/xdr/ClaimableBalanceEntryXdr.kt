@@ -50,6 +50,14 @@ data class ClaimableBalanceEntryXdr(
       val ext = ClaimableBalanceEntryExtXdr.decode(reader)
       return ClaimableBalanceEntryXdr(balanceId, claimants, asset, amount, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      ClaimableBalanceIDXdr.skip(reader)
+      repeat(reader.readInt()) { ClaimantXdr.skip(reader) }
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      ClaimableBalanceEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -62,4 +70,17 @@ data class ClaimableBalanceEntryXdr(
     amount.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += balanceId.encodedSize()
+    size += 4
+    claimants.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += asset.encodedSize()
+    size += amount.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -18,6 +18,14 @@ sealed class ClaimableBalanceIDXdr {
     val value: HashXdr
   ) : ClaimableBalanceIDXdr() {
     override val discriminant: ClaimableBalanceIDTypeXdr = ClaimableBalanceIDTypeXdr.CLAIMABLE_BALANCE_ID_TYPE_V0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is V0) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   companion object {
@@ -32,6 +40,14 @@ sealed class ClaimableBalanceIDXdr {
         else -> throw IllegalArgumentException("Unknown ClaimableBalanceIDXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClaimableBalanceIDTypeXdr.decode(reader)
+      when (discriminant) {
+        ClaimableBalanceIDTypeXdr.CLAIMABLE_BALANCE_ID_TYPE_V0 -> HashXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ClaimableBalanceIDXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +58,15 @@ sealed class ClaimableBalanceIDXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
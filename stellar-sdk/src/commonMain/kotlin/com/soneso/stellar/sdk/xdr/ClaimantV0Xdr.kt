@@ -24,10 +24,22 @@ data class ClaimantV0Xdr(
       val predicate = ClaimPredicateXdr.decode(reader)
       return ClaimantV0Xdr(destination, predicate)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      ClaimPredicateXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     destination.encode(writer)
     predicate.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += destination.encodedSize()
+    size += predicate.encodedSize()
+    return size
+  }
 }
@@ -36,6 +36,14 @@ sealed class ClaimantXdr {
         else -> throw IllegalArgumentException("Unknown ClaimantXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClaimantTypeXdr.decode(reader)
+      when (discriminant) {
+        ClaimantTypeXdr.CLAIMANT_TYPE_V0 -> ClaimantV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ClaimantXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +54,15 @@ sealed class ClaimantXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
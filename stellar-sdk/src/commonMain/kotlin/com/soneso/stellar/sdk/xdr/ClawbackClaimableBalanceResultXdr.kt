@@ -35,6 +35,17 @@ sealed class ClawbackClaimableBalanceResultXdr {
         else -> throw IllegalArgumentException("Unknown ClawbackClaimableBalanceResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClawbackClaimableBalanceResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ClawbackClaimableBalanceResultCodeXdr.CLAWBACK_CLAIMABLE_BALANCE_SUCCESS -> {}
+        ClawbackClaimableBalanceResultCodeXdr.CLAWBACK_CLAIMABLE_BALANCE_DOES_NOT_EXIST -> {}
+        ClawbackClaimableBalanceResultCodeXdr.CLAWBACK_CLAIMABLE_BALANCE_NOT_ISSUER -> {}
+        ClawbackClaimableBalanceResultCodeXdr.CLAWBACK_CLAIMABLE_BALANCE_NOT_CLAWBACK_ENABLED -> {}
+        else -> throw IllegalArgumentException("Unknown ClawbackClaimableBalanceResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -43,4 +54,13 @@ sealed class ClawbackClaimableBalanceResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
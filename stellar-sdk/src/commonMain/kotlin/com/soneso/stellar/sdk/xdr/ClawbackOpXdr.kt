@@ -25,6 +25,12 @@ data class ClawbackOpXdr(
       val amount = Int64Xdr.decode(reader)
       return ClawbackOpXdr(asset, from, amount)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      MuxedAccountXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class ClawbackOpXdr(
     from.encode(writer)
     amount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += asset.encodedSize()
+    size += from.encodedSize()
+    size += amount.encodedSize()
+    return size
+  }
 }
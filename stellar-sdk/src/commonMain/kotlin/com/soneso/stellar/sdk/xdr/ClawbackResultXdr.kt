@@ -36,6 +36,18 @@ sealed class ClawbackResultXdr {
         else -> throw IllegalArgumentException("Unknown ClawbackResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ClawbackResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ClawbackResultCodeXdr.CLAWBACK_SUCCESS -> {}
+        ClawbackResultCodeXdr.CLAWBACK_MALFORMED -> {}
+        ClawbackResultCodeXdr.CLAWBACK_NOT_CLAWBACK_ENABLED -> {}
+        ClawbackResultCodeXdr.CLAWBACK_NO_TRUST -> {}
+        ClawbackResultCodeXdr.CLAWBACK_UNDERFUNDED -> {}
+        else -> throw IllegalArgumentException("Unknown ClawbackResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +56,13 @@ sealed class ClawbackResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
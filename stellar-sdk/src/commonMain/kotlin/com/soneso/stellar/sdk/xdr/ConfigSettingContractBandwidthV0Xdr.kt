@@ -32,6 +32,12 @@ data class ConfigSettingContractBandwidthV0Xdr(
       val feeTxSize1Kb = Int64Xdr.decode(reader)
       return ConfigSettingContractBandwidthV0Xdr(ledgerMaxTxsSizeBytes, txMaxSizeBytes, feeTxSize1Kb)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +45,12 @@ data class ConfigSettingContractBandwidthV0Xdr(
     txMaxSizeBytes.encode(writer)
     feeTxSize1Kb.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerMaxTxsSizeBytes.encodedSize()
+    size += txMaxSizeBytes.encodedSize()
+    size += feeTxSize1Kb.encodedSize()
+    return size
+  }
 }
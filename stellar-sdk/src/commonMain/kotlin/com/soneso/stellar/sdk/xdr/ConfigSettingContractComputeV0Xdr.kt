@@ -41,6 +41,13 @@ data class ConfigSettingContractComputeV0Xdr(
       val txMemoryLimit = Uint32Xdr.decode(reader)
       return ConfigSettingContractComputeV0Xdr(ledgerMaxInstructions, txMaxInstructions, feeRatePerInstructionsIncrement, txMemoryLimit)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -49,4 +56,13 @@ data class ConfigSettingContractComputeV0Xdr(
     feeRatePerInstructionsIncrement.encode(writer)
     txMemoryLimit.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerMaxInstructions.encodedSize()
+    size += txMaxInstructions.encodedSize()
+    size += feeRatePerInstructionsIncrement.encodedSize()
+    size += txMemoryLimit.encodedSize()
+    return size
+  }
 }
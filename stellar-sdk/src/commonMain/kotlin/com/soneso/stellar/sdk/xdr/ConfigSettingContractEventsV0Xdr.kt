@@ -26,10 +26,22 @@ data class ConfigSettingContractEventsV0Xdr(
       val feeContractEvents1Kb = Int64Xdr.decode(reader)
       return ConfigSettingContractEventsV0Xdr(txMaxContractEventsSizeBytes, feeContractEvents1Kb)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     txMaxContractEventsSizeBytes.encode(writer)
     feeContractEvents1Kb.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += txMaxContractEventsSizeBytes.encodedSize()
+    size += feeContractEvents1Kb.encodedSize()
+    return size
+  }
 }
@@ -21,9 +21,19 @@ data class ConfigSettingContractExecutionLanesV0Xdr(
       val ledgerMaxTxCount = Uint32Xdr.decode(reader)
       return ConfigSettingContractExecutionLanesV0Xdr(ledgerMaxTxCount)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ledgerMaxTxCount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerMaxTxCount.encodedSize()
+    return size
+  }
 }
@@ -20,9 +20,19 @@ data class ConfigSettingContractHistoricalDataV0Xdr(
       val feeHistorical1Kb = Int64Xdr.decode(reader)
       return ConfigSettingContractHistoricalDataV0Xdr(feeHistorical1Kb)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     feeHistorical1Kb.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += feeHistorical1Kb.encodedSize()
+    return size
+  }
 }
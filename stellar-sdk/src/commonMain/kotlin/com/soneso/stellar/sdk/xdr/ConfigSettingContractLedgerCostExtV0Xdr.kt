@@ -32,10 +32,22 @@ data class ConfigSettingContractLedgerCostExtV0Xdr(
       val feeWrite1Kb = Int64Xdr.decode(reader)
       return ConfigSettingContractLedgerCostExtV0Xdr(txMaxFootprintEntries, feeWrite1Kb)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     txMaxFootprintEntries.encode(writer)
     feeWrite1Kb.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += txMaxFootprintEntries.encodedSize()
+    size += feeWrite1Kb.encodedSize()
+    return size
+  }
 }
@@ -96,6 +96,24 @@ data class ConfigSettingContractLedgerCostV0Xdr(
       val sorobanStateRentFeeGrowthFactor = Uint32Xdr.decode(reader)
       return ConfigSettingContractLedgerCostV0Xdr(ledgerMaxDiskReadEntries, ledgerMaxDiskReadBytes, ledgerMaxWriteLedgerEntries, ledgerMaxWriteBytes, txMaxDiskReadEntries, txMaxDiskReadBytes, txMaxWriteLedgerEntries, txMaxWriteBytes, feeDiskReadLedgerEntry, feeWriteLedgerEntry, feeDiskRead1Kb, sorobanStateTargetSizeBytes, rentFee1KbSorobanStateSizeLow, rentFee1KbSorobanStateSizeHigh, sorobanStateRentFeeGrowthFactor)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -115,4 +133,24 @@ data class ConfigSettingContractLedgerCostV0Xdr(
     rentFee1KbSorobanStateSizeHigh.encode(writer)
     sorobanStateRentFeeGrowthFactor.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerMaxDiskReadEntries.encodedSize()
+    size += ledgerMaxDiskReadBytes.encodedSize()
+    size += ledgerMaxWriteLedgerEntries.encodedSize()
+    size += ledgerMaxWriteBytes.encodedSize()
+    size += txMaxDiskReadEntries.encodedSize()
+    size += txMaxDiskReadBytes.encodedSize()
+    size += txMaxWriteLedgerEntries.encodedSize()
+    size += txMaxWriteBytes.encodedSize()
+    size += feeDiskReadLedgerEntry.encodedSize()
+    size += feeWriteLedgerEntry.encodedSize()
+    size += feeDiskRead1Kb.encodedSize()
+    size += sorobanStateTargetSizeBytes.encodedSize()
+    size += rentFee1KbSorobanStateSizeLow.encodedSize()
+    size += rentFee1KbSorobanStateSizeHigh.encodedSize()
+    size += sorobanStateRentFeeGrowthFactor.encodedSize()
+    return size
+  }
 }
@@ -29,9 +29,19 @@ data class ConfigSettingContractParallelComputeV0Xdr(
       val ledgerMaxDependentTxClusters = Uint32Xdr.decode(reader)
       return ConfigSettingContractParallelComputeV0Xdr(ledgerMaxDependentTxClusters)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ledgerMaxDependentTxClusters.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerMaxDependentTxClusters.encodedSize()
+    return size
+  }
 }
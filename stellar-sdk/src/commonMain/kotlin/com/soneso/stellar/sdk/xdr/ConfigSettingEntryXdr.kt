@@ -224,6 +224,30 @@ sealed class ConfigSettingEntryXdr {
         else -> throw IllegalArgumentException("Unknown ConfigSettingEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ConfigSettingIDXdr.decode(reader)
+      when (discriminant) {
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_MAX_SIZE_BYTES -> Uint32Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_COMPUTE_V0 -> ConfigSettingContractComputeV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_LEDGER_COST_V0 -> ConfigSettingContractLedgerCostV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_HISTORICAL_DATA_V0 -> ConfigSettingContractHistoricalDataV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_EVENTS_V0 -> ConfigSettingContractEventsV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_BANDWIDTH_V0 -> ConfigSettingContractBandwidthV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_COST_PARAMS_CPU_INSTRUCTIONS -> ContractCostParamsXdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_COST_PARAMS_MEMORY_BYTES -> ContractCostParamsXdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_DATA_KEY_SIZE_BYTES -> Uint32Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_DATA_ENTRY_SIZE_BYTES -> Uint32Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_STATE_ARCHIVAL -> StateArchivalSettingsXdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_EXECUTION_LANES -> ConfigSettingContractExecutionLanesV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_LIVE_SOROBAN_STATE_SIZE_WINDOW -> repeat(reader.readInt()) { Uint64Xdr.skip(reader) }
+        ConfigSettingIDXdr.CONFIG_SETTING_EVICTION_ITERATOR -> EvictionIteratorXdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_PARALLEL_COMPUTE_V0 -> ConfigSettingContractParallelComputeV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_CONTRACT_LEDGER_COST_EXT_V0 -> ConfigSettingContractLedgerCostExtV0Xdr.skip(reader)
+        ConfigSettingIDXdr.CONFIG_SETTING_SCP_TIMING -> ConfigSettingSCPTimingXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ConfigSettingEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -285,4 +309,66 @@ sealed class ConfigSettingEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ContractMaxSizeBytes -> {
+        size += value.encodedSize()
+      }
+      is ContractCompute -> {
+        size += value.encodedSize()
+      }
+      is ContractLedgerCost -> {
+        size += value.encodedSize()
+      }
+      is ContractHistoricalData -> {
+        size += value.encodedSize()
+      }
+      is ContractEvents -> {
+        size += value.encodedSize()
+      }
+      is ContractBandwidth -> {
+        size += value.encodedSize()
+      }
+      is ContractCostParamsCpuInsns -> {
+        size += value.encodedSize()
+      }
+      is ContractCostParamsMemBytes -> {
+        size += value.encodedSize()
+      }
+      is ContractDataKeySizeBytes -> {
+        size += value.encodedSize()
+      }
+      is ContractDataEntrySizeBytes -> {
+        size += value.encodedSize()
+      }
+      is StateArchivalSettings -> {
+        size += value.encodedSize()
+      }
+      is ContractExecutionLanes -> {
+        size += value.encodedSize()
+      }
+      is LiveSorobanStateSizeWindow -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is EvictionIterator -> {
+        size += value.encodedSize()
+      }
+      is ContractParallelCompute -> {
+        size += value.encodedSize()
+      }
+      is ContractLedgerCostExt -> {
+        size += value.encodedSize()
+      }
+      is ContractSCPTiming -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -30,6 +30,14 @@ data class ConfigSettingSCPTimingXdr(
       val ballotTimeoutIncrementMilliseconds = Uint32Xdr.decode(reader)
       return ConfigSettingSCPTimingXdr(ledgerTargetCloseTimeMilliseconds, nominationTimeoutInitialMilliseconds, nominationTimeoutIncrementMilliseconds, ballotTimeoutInitialMilliseconds, ballotTimeoutIncrementMilliseconds)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +47,14 @@ data class ConfigSettingSCPTimingXdr(
     ballotTimeoutInitialMilliseconds.encode(writer)
     ballotTimeoutIncrementMilliseconds.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerTargetCloseTimeMilliseconds.encodedSize()
+    size += nominationTimeoutInitialMilliseconds.encodedSize()
+    size += nominationTimeoutIncrementMilliseconds.encodedSize()
+    size += ballotTimeoutInitialMilliseconds.encodedSize()
+    size += ballotTimeoutIncrementMilliseconds.encodedSize()
+    return size
+  }
 }
@@ -21,10 +21,35 @@ data class ConfigUpgradeSetKeyXdr(
       val contentHash = HashXdr.decode(reader)
       return ConfigUpgradeSetKeyXdr(contractId, contentHash)
     }
+
+    fun skip(reader: XdrReader) {
+      ContractIDXdr.skip(reader)
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     contractId.encode(writer)
     contentHash.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += contractId.encodedSize()
+    size += contentHash.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ConfigUpgradeSetKeyXdr) return false
+    return contractId.contentEquals(other.contractId) &&
+      contentHash.contentEquals(other.contentHash)
+  }
+
+  override fun hashCode(): Int {
+    var result = contractId.contentHashCode()
+    result = 31 * result + contentHash.contentHashCode()
+    return result
+  }
 }
@@ -18,6 +18,10 @@ data class ConfigUpgradeSetXdr(
       val updatedEntry = List(reader.readInt()) { ConfigSettingEntryXdr.decode(reader) }
       return ConfigUpgradeSetXdr(updatedEntry)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { ConfigSettingEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -26,4 +30,13 @@ data class ConfigUpgradeSetXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    updatedEntry.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -48,6 +48,20 @@ data class ContractCodeCostInputsXdr(
       val nDataSegmentBytes = Uint32Xdr.decode(reader)
       return ContractCodeCostInputsXdr(ext, nInstructions, nFunctions, nGlobals, nTableEntries, nTypes, nDataSegments, nElemSegments, nImports, nExports, nDataSegmentBytes)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -63,4 +77,20 @@ data class ContractCodeCostInputsXdr(
     nExports.encode(writer)
     nDataSegmentBytes.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += nInstructions.encodedSize()
+    size += nFunctions.encodedSize()
+    size += nGlobals.encodedSize()
+    size += nTableEntries.encodedSize()
+    size += nTypes.encodedSize()
+    size += nDataSegments.encodedSize()
+    size += nElemSegments.encodedSize()
+    size += nImports.encodedSize()
+    size += nExports.encodedSize()
+    size += nDataSegmentBytes.encodedSize()
+    return size
+  }
 }
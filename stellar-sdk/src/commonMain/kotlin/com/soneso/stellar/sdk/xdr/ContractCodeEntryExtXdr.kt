@@ -43,6 +43,15 @@ sealed class ContractCodeEntryExtXdr {
         else -> throw IllegalArgumentException("Unknown ContractCodeEntryExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> ContractCodeEntryV1Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ContractCodeEntryExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -54,4 +63,16 @@ sealed class ContractCodeEntryExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V1 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
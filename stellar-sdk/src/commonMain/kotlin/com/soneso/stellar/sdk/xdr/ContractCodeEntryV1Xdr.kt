@@ -22,10 +22,22 @@ data class ContractCodeEntryV1Xdr(
       val costInputs = ContractCodeCostInputsXdr.decode(reader)
       return ContractCodeEntryV1Xdr(ext, costInputs)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      ContractCodeCostInputsXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ext.encode(writer)
     costInputs.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += costInputs.encodedSize()
+    return size
+  }
 }
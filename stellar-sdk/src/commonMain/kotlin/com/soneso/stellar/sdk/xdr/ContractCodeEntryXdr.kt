@@ -35,6 +35,12 @@ data class ContractCodeEntryXdr(
       val code = reader.readVariableOpaque()
       return ContractCodeEntryXdr(ext, hash, code)
     }
+
+    fun skip(reader: XdrReader) {
+      ContractCodeEntryExtXdr.skip(reader)
+      HashXdr.skip(reader)
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +48,27 @@ data class ContractCodeEntryXdr(
     hash.encode(writer)
     writer.writeVariableOpaque(code)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += hash.encodedSize()
+    size += xdrVariableOpaqueSize(code)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ContractCodeEntryXdr) return false
+    return ext == other.ext &&
+      hash.contentEquals(other.hash) &&
+      code.contentEquals(other.code)
+  }
+
+  override fun hashCode(): Int {
+    var result = ext.hashCode()
+    result = 31 * result + hash.contentHashCode()
+    result = 31 * result + code.contentHashCode()
+    return result
+  }
 }
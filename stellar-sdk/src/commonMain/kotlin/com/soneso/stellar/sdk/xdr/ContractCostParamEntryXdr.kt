@@ -27,6 +27,12 @@ data class ContractCostParamEntryXdr(
       val linearTerm = Int64Xdr.decode(reader)
       return ContractCostParamEntryXdr(ext, constTerm, linearTerm)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +40,12 @@ data class ContractCostParamEntryXdr(
     constTerm.encode(writer)
     linearTerm.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += constTerm.encodedSize()
+    size += linearTerm.encodedSize()
+    return size
+  }
 }
@@ -15,6 +15,10 @@ value class ContractCostParamsXdr(val value: List<ContractCostParamEntryXdr>) {
       val value = List(reader.readInt()) { ContractCostParamEntryXdr.decode(reader) }
       return ContractCostParamsXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { ContractCostParamEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class ContractCostParamsXdr(val value: List<ContractCostParamEntryXdr>) {
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
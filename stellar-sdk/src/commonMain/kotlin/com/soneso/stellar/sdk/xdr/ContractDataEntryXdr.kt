@@ -31,6 +31,14 @@ data class ContractDataEntryXdr(
       val value = SCValXdr.decode(reader)
       return ContractDataEntryXdr(ext, contract, key, durability, value)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      SCAddressXdr.skip(reader)
+      SCValXdr.skip(reader)
+      ContractDataDurabilityXdr.skip(reader)
+      SCValXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -40,4 +48,14 @@ data class ContractDataEntryXdr(
     durability.encode(writer)
     `val`.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += contract.encodedSize()
+    size += key.encodedSize()
+    size += durability.encodedSize()
+    size += `val`.encodedSize()
+    return size
+  }
 }
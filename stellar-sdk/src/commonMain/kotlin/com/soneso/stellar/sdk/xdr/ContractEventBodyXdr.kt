@@ -36,6 +36,14 @@ sealed class ContractEventBodyXdr {
         else -> throw IllegalArgumentException("Unknown ContractEventBodyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> ContractEventV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ContractEventBodyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +54,15 @@ sealed class ContractEventBodyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class ContractEventV0Xdr(
       val data = SCValXdr.decode(reader)
       return ContractEventV0Xdr(topics, data)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SCValXdr.skip(reader) }
+      SCValXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class ContractEventV0Xdr(
     }
     data.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    topics.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += data.encodedSize()
+    return size
+  }
 }
@@ -45,6 +45,13 @@ data class ContractEventXdr(
       val body = ContractEventBodyXdr.decode(reader)
       return ContractEventXdr(ext, contractId, type, body)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      if (reader.readBoolean()) ContractIDXdr.skip(reader)
+      ContractEventTypeXdr.skip(reader)
+      ContractEventBodyXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -58,4 +65,35 @@ data class ContractEventXdr(
     type.encode(writer)
     body.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    if (contractId != null) {
+      size += 4
+      size += contractId.encodedSize()
+    } else {
+      size += 4
+    }
+    size += type.encodedSize()
+    size += body.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ContractEventXdr) return false
+    return ext == other.ext &&
+      contractId.contentEquals(other.contractId) &&
+      type == other.type &&
+      body == other.body
+  }
+
+  override fun hashCode(): Int {
+    var result = ext.hashCode()
+    result = 31 * result + contractId.contentHashCode()
+    result = 31 * result + type.hashCode()
+    result = 31 * result + body.hashCode()
+    return result
+  }
 }
@@ -20,6 +20,14 @@ sealed class ContractExecutableXdr {
     val value: HashXdr
   ) : ContractExecutableXdr() {
     override val discriminant: ContractExecutableTypeXdr = ContractExecutableTypeXdr.CONTRACT_EXECUTABLE_WASM
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is WasmHash) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data object Void : ContractExecutableXdr() {
@@ -39,6 +47,15 @@ sealed class ContractExecutableXdr {
         else -> throw IllegalArgumentException("Unknown ContractExecutableXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ContractExecutableTypeXdr.decode(reader)
+      when (discriminant) {
+        ContractExecutableTypeXdr.CONTRACT_EXECUTABLE_WASM -> HashXdr.skip(reader)
+        ContractExecutableTypeXdr.CONTRACT_EXECUTABLE_STELLAR_ASSET -> {}
+        else -> throw IllegalArgumentException("Unknown ContractExecutableXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +67,16 @@ sealed class ContractExecutableXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is WasmHash -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -22,10 +22,35 @@ data class ContractIDPreimageFromAddressXdr(
       val salt = Uint256Xdr.decode(reader)
       return ContractIDPreimageFromAddressXdr(address, salt)
     }
+
+    fun skip(reader: XdrReader) {
+      SCAddressXdr.skip(reader)
+      Uint256Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     address.encode(writer)
     salt.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += address.encodedSize()
+    size += salt.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ContractIDPreimageFromAddressXdr) return false
+    return address == other.address &&
+      salt.contentEquals(other.salt)
+  }
+
+  override fun hashCode(): Int {
+    var result = address.hashCode()
+    result = 31 * result + salt.contentHashCode()
+    return result
+  }
 }
@@ -48,6 +48,15 @@ sealed class ContractIDPreimageXdr {
         else -> throw IllegalArgumentException("Unknown ContractIDPreimageXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ContractIDPreimageTypeXdr.decode(reader)
+      when (discriminant) {
+        ContractIDPreimageTypeXdr.CONTRACT_ID_PREIMAGE_FROM_ADDRESS -> ContractIDPreimageFromAddressXdr.skip(reader)
+        ContractIDPreimageTypeXdr.CONTRACT_ID_PREIMAGE_FROM_ASSET -> AssetXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown ContractIDPreimageXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -61,4 +70,18 @@ sealed class ContractIDPreimageXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is FromAddress -> {
+        size += value.encodedSize()
+      }
+      is FromAsset -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -15,9 +15,25 @@ value class ContractIDXdr(val value: HashXdr) {
       val value = HashXdr.decode(reader)
       return ContractIDXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += value.encodedSize()
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun ContractIDXdr?.contentEquals(other: ContractIDXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun ContractIDXdr?.contentHashCode(): Int = this?.value.contentHashCode()
@@ -24,10 +24,22 @@ data class CreateAccountOpXdr(
       val startingBalance = Int64Xdr.decode(reader)
       return CreateAccountOpXdr(destination, startingBalance)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     destination.encode(writer)
     startingBalance.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += destination.encodedSize()
+    size += startingBalance.encodedSize()
+    return size
+  }
 }
@@ -36,6 +36,18 @@ sealed class CreateAccountResultXdr {
         else -> throw IllegalArgumentException("Unknown CreateAccountResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = CreateAccountResultCodeXdr.decode(reader)
+      when (discriminant) {
+        CreateAccountResultCodeXdr.CREATE_ACCOUNT_SUCCESS -> {}
+        CreateAccountResultCodeXdr.CREATE_ACCOUNT_MALFORMED -> {}
+        CreateAccountResultCodeXdr.CREATE_ACCOUNT_UNDERFUNDED -> {}
+        CreateAccountResultCodeXdr.CREATE_ACCOUNT_LOW_RESERVE -> {}
+        CreateAccountResultCodeXdr.CREATE_ACCOUNT_ALREADY_EXIST -> {}
+        else -> throw IllegalArgumentException("Unknown CreateAccountResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +56,13 @@ sealed class CreateAccountResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -25,6 +25,12 @@ data class CreateClaimableBalanceOpXdr(
       val claimants = List(reader.readInt()) { ClaimantXdr.decode(reader) }
       return CreateClaimableBalanceOpXdr(asset, amount, claimants)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      repeat(reader.readInt()) { ClaimantXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +41,15 @@ data class CreateClaimableBalanceOpXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += asset.encodedSize()
+    size += amount.encodedSize()
+    size += 4
+    claimants.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
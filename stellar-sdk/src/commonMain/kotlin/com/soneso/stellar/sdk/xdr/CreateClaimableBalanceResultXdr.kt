@@ -48,6 +48,19 @@ sealed class CreateClaimableBalanceResultXdr {
         else -> throw IllegalArgumentException("Unknown CreateClaimableBalanceResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = CreateClaimableBalanceResultCodeXdr.decode(reader)
+      when (discriminant) {
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_SUCCESS -> ClaimableBalanceIDXdr.skip(reader)
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_MALFORMED -> {}
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_LOW_RESERVE -> {}
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_NO_TRUST -> {}
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_NOT_AUTHORIZED -> {}
+        CreateClaimableBalanceResultCodeXdr.CREATE_CLAIMABLE_BALANCE_UNDERFUNDED -> {}
+        else -> throw IllegalArgumentException("Unknown CreateClaimableBalanceResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -59,4 +72,16 @@ sealed class CreateClaimableBalanceResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is BalanceID -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -26,6 +26,12 @@ data class CreateContractArgsV2Xdr(
       val constructorArgs = List(reader.readInt()) { SCValXdr.decode(reader) }
       return CreateContractArgsV2Xdr(contractIdPreimage, executable, constructorArgs)
     }
+
+    fun skip(reader: XdrReader) {
+      ContractIDPreimageXdr.skip(reader)
+      ContractExecutableXdr.skip(reader)
+      repeat(reader.readInt()) { SCValXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -36,4 +42,15 @@ data class CreateContractArgsV2Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += contractIdPreimage.encodedSize()
+    size += executable.encodedSize()
+    size += 4
+    constructorArgs.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
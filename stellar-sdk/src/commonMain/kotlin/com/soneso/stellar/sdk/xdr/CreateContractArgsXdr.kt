@@ -22,10 +22,22 @@ data class CreateContractArgsXdr(
       val executable = ContractExecutableXdr.decode(reader)
       return CreateContractArgsXdr(contractIdPreimage, executable)
     }
+
+    fun skip(reader: XdrReader) {
+      ContractIDPreimageXdr.skip(reader)
+      ContractExecutableXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     contractIdPreimage.encode(writer)
     executable.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += contractIdPreimage.encodedSize()
+    size += executable.encodedSize()
+    return size
+  }
 }
@@ -32,6 +32,13 @@ data class CreatePassiveSellOfferOpXdr(
       val price = PriceXdr.decode(reader)
       return CreatePassiveSellOfferOpXdr(selling, buying, amount, price)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      PriceXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -40,4 +47,13 @@ data class CreatePassiveSellOfferOpXdr(
     amount.encode(writer)
     price.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += selling.encodedSize()
+    size += buying.encodedSize()
+    size += amount.encodedSize()
+    size += price.encodedSize()
+    return size
+  }
 }
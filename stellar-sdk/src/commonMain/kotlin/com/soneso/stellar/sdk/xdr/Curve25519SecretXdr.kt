@@ -19,9 +19,27 @@ data class Curve25519SecretXdr(
       val key = reader.readFixedOpaque(32)
       return Curve25519SecretXdr(key)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(32)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(key, 32)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(32)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is Curve25519SecretXdr) return false
+    return key.contentEquals(other.key)
+  }
+
+  override fun hashCode(): Int = key.contentHashCode()
 }
@@ -27,6 +27,14 @@ sealed class DataEntryExtXdr {
         else -> throw IllegalArgumentException("Unknown DataEntryExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        else -> throw IllegalArgumentException("Unknown DataEntryExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +43,13 @@ sealed class DataEntryExtXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -36,6 +36,13 @@ data class DataEntryXdr(
       val ext = DataEntryExtXdr.decode(reader)
       return DataEntryXdr(accountId, dataName, dataValue, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      String64Xdr.skip(reader)
+      DataValueXdr.skip(reader)
+      DataEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +51,30 @@ data class DataEntryXdr(
     dataValue.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += dataName.encodedSize()
+    size += dataValue.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is DataEntryXdr) return false
+    return accountId == other.accountId &&
+      dataName == other.dataName &&
+      dataValue.contentEquals(other.dataValue) &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = accountId.hashCode()
+    result = 31 * result + dataName.hashCode()
+    result = 31 * result + dataValue.contentHashCode()
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
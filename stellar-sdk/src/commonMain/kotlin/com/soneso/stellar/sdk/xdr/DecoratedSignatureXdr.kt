@@ -24,10 +24,35 @@ data class DecoratedSignatureXdr(
       val signature = SignatureXdr.decode(reader)
       return DecoratedSignatureXdr(hint, signature)
     }
+
+    fun skip(reader: XdrReader) {
+      SignatureHintXdr.skip(reader)
+      SignatureXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     hint.encode(writer)
     signature.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hint.encodedSize()
+    size += signature.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is DecoratedSignatureXdr) return false
+    return hint.contentEquals(other.hint) &&
+      signature.contentEquals(other.signature)
+  }
+
+  override fun hashCode(): Int {
+    var result = hint.contentHashCode()
+    result = 31 * result + signature.contentHashCode()
+    return result
+  }
 }
@@ -15,6 +15,10 @@ value class DependentTxClusterXdr(val value: List<TransactionEnvelopeXdr>) {
       val value = List(reader.readInt()) { TransactionEnvelopeXdr.decode(reader) }
       return DependentTxClusterXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { TransactionEnvelopeXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class DependentTxClusterXdr(val value: List<TransactionEnvelopeXdr>) {
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class DiagnosticEventXdr(
       val event = ContractEventXdr.decode(reader)
       return DiagnosticEventXdr(inSuccessfulContractCall, event)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+      ContractEventXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeBoolean(inSuccessfulContractCall)
     event.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    size += event.encodedSize()
+    return size
+  }
 }
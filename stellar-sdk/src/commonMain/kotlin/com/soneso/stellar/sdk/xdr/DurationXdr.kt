@@ -15,9 +15,19 @@ value class DurationXdr(val value: Uint64Xdr) {
       val value = Uint64Xdr.decode(reader)
       return DurationXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += value.encodedSize()
+    return size
+  }
 }
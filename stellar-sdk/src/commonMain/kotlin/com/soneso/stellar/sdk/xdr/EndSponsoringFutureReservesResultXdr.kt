@@ -31,6 +31,15 @@ sealed class EndSponsoringFutureReservesResultXdr {
         else -> throw IllegalArgumentException("Unknown EndSponsoringFutureReservesResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = EndSponsoringFutureReservesResultCodeXdr.decode(reader)
+      when (discriminant) {
+        EndSponsoringFutureReservesResultCodeXdr.END_SPONSORING_FUTURE_RESERVES_SUCCESS -> {}
+        EndSponsoringFutureReservesResultCodeXdr.END_SPONSORING_FUTURE_RESERVES_NOT_SPONSORED -> {}
+        else -> throw IllegalArgumentException("Unknown EndSponsoringFutureReservesResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +48,13 @@ sealed class EndSponsoringFutureReservesResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -24,6 +24,12 @@ data class EvictionIteratorXdr(
       val bucketFileOffset = Uint64Xdr.decode(reader)
       return EvictionIteratorXdr(bucketListLevel, isCurrBucket, bucketFileOffset)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      reader.skip(4)
+      Uint64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +37,12 @@ data class EvictionIteratorXdr(
     writer.writeBoolean(isCurrBucket)
     bucketFileOffset.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += bucketListLevel.encodedSize()
+    size += 4
+    size += bucketFileOffset.encodedSize()
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class ExtendFootprintTTLOpXdr(
       val extendTo = Uint32Xdr.decode(reader)
       return ExtendFootprintTTLOpXdr(ext, extendTo)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ext.encode(writer)
     extendTo.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += extendTo.encodedSize()
+    return size
+  }
 }
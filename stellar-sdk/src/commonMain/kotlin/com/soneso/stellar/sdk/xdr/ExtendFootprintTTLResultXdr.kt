@@ -34,6 +34,17 @@ sealed class ExtendFootprintTTLResultXdr {
         else -> throw IllegalArgumentException("Unknown ExtendFootprintTTLResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ExtendFootprintTTLResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ExtendFootprintTTLResultCodeXdr.EXTEND_FOOTPRINT_TTL_SUCCESS -> {}
+        ExtendFootprintTTLResultCodeXdr.EXTEND_FOOTPRINT_TTL_MALFORMED -> {}
+        ExtendFootprintTTLResultCodeXdr.EXTEND_FOOTPRINT_TTL_RESOURCE_LIMIT_EXCEEDED -> {}
+        ExtendFootprintTTLResultCodeXdr.EXTEND_FOOTPRINT_TTL_INSUFFICIENT_REFUNDABLE_FEE -> {}
+        else -> throw IllegalArgumentException("Unknown ExtendFootprintTTLResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +53,13 @@ sealed class ExtendFootprintTTLResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -27,6 +27,14 @@ sealed class ExtensionPointXdr {
         else -> throw IllegalArgumentException("Unknown ExtensionPointXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        else -> throw IllegalArgumentException("Unknown ExtensionPointXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +43,13 @@ sealed class ExtensionPointXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
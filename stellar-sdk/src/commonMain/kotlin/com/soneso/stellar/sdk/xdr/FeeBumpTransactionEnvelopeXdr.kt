@@ -24,6 +24,11 @@ data class FeeBumpTransactionEnvelopeXdr(
       val signatures = List(reader.readInt()) { DecoratedSignatureXdr.decode(reader) }
       return FeeBumpTransactionEnvelopeXdr(tx, signatures)
     }
+
+    fun skip(reader: XdrReader) {
+      FeeBumpTransactionXdr.skip(reader)
+      repeat(reader.readInt()) { DecoratedSignatureXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -33,4 +38,14 @@ data class FeeBumpTransactionEnvelopeXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += tx.encodedSize()
+    size += 4
+    signatures.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
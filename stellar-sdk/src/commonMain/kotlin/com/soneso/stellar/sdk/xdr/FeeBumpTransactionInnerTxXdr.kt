@@ -32,6 +32,14 @@ sealed class FeeBumpTransactionInnerTxXdr {
         else -> throw IllegalArgumentException("Unknown FeeBumpTransactionInnerTxXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = EnvelopeTypeXdr.decode(reader)
+      when (discriminant) {
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX -> TransactionV1EnvelopeXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown FeeBumpTransactionInnerTxXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +50,15 @@ sealed class FeeBumpTransactionInnerTxXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V1 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -38,6 +38,13 @@ data class FeeBumpTransactionXdr(
       val ext = FeeBumpTransactionExtXdr.decode(reader)
       return FeeBumpTransactionXdr(feeSource, fee, innerTx, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      MuxedAccountXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      FeeBumpTransactionInnerTxXdr.skip(reader)
+      FeeBumpTransactionExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +53,13 @@ data class FeeBumpTransactionXdr(
     innerTx.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += feeSource.encodedSize()
+    size += fee.encodedSize()
+    size += innerTx.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
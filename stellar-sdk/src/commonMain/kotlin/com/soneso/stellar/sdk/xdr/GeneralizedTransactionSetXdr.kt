@@ -34,6 +34,14 @@ sealed class GeneralizedTransactionSetXdr {
         else -> throw IllegalArgumentException("Unknown GeneralizedTransactionSetXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        1 -> TransactionSetV1Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown GeneralizedTransactionSetXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +52,15 @@ sealed class GeneralizedTransactionSetXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is V1TxSet -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,10 +22,35 @@ data class HashIDPreimageContractIDXdr(
       val contractIdPreimage = ContractIDPreimageXdr.decode(reader)
       return HashIDPreimageContractIDXdr(networkId, contractIdPreimage)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      ContractIDPreimageXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     networkId.encode(writer)
     contractIdPreimage.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += networkId.encodedSize()
+    size += contractIdPreimage.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is HashIDPreimageContractIDXdr) return false
+    return networkId.contentEquals(other.networkId) &&
+      contractIdPreimage == other.contractIdPreimage
+  }
+
+  override fun hashCode(): Int {
+    var result = networkId.contentHashCode()
+    result = 31 * result + contractIdPreimage.hashCode()
+    return result
+  }
 }
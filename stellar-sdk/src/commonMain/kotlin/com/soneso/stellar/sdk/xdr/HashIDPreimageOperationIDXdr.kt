@@ -25,6 +25,12 @@ data class HashIDPreimageOperationIDXdr(
       val opNum = Uint32Xdr.decode(reader)
       return HashIDPreimageOperationIDXdr(sourceAccount, seqNum, opNum)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      SequenceNumberXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class HashIDPreimageOperationIDXdr(
     seqNum.encode(writer)
     opNum.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sourceAccount.encodedSize()
+    size += seqNum.encodedSize()
+    size += opNum.encodedSize()
+    return size
+  }
 }
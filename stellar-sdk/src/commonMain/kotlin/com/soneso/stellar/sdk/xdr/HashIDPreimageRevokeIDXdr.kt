@@ -31,6 +31,14 @@ data class HashIDPreimageRevokeIDXdr(
       val asset = AssetXdr.decode(reader)
       return HashIDPreimageRevokeIDXdr(sourceAccount, seqNum, opNum, liquidityPoolId, asset)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      SequenceNumberXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      PoolIDXdr.skip(reader)
+      AssetXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -40,4 +48,33 @@ data class HashIDPreimageRevokeIDXdr(
     liquidityPoolId.encode(writer)
     asset.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sourceAccount.encodedSize()
+    size += seqNum.encodedSize()
+    size += opNum.encodedSize()
+    size += liquidityPoolId.encodedSize()
+    size += asset.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is HashIDPreimageRevokeIDXdr) return false
+    return sourceAccount == other.sourceAccount &&
+      seqNum == other.seqNum &&
+      opNum == other.opNum &&
+      liquidityPoolId.contentEquals(other.liquidityPoolId) &&
+      asset == other.asset
+  }
+
+  override fun hashCode(): Int {
+    var result = sourceAccount.hashCode()
+    result = 31 * result + seqNum.hashCode()
+    result = 31 * result + opNum.hashCode()
+    result = 31 * result + liquidityPoolId.contentHashCode()
+    result = 31 * result + asset.hashCode()
+    return result
+  }
 }
@@ -28,6 +28,13 @@ data class HashIDPreimageSorobanAuthorizationXdr(
       val invocation = SorobanAuthorizedInvocationXdr.decode(reader)
       return HashIDPreimageSorobanAuthorizationXdr(networkId, nonce, signatureExpirationLedger, invocation)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      SorobanAuthorizedInvocationXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -36,4 +43,30 @@ data class HashIDPreimageSorobanAuthorizationXdr(
     signatureExpirationLedger.encode(writer)
     invocation.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += networkId.encodedSize()
+    size += nonce.encodedSize()
+    size += signatureExpirationLedger.encodedSize()
+    size += invocation.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is HashIDPreimageSorobanAuthorizationXdr) return false
+    return networkId.contentEquals(other.networkId) &&
+      nonce == other.nonce &&
+      signatureExpirationLedger == other.signatureExpirationLedger &&
+      invocation == other.invocation
+  }
+
+  override fun hashCode(): Int {
+    var result = networkId.contentHashCode()
+    result = 31 * result + nonce.hashCode()
+    result = 31 * result + signatureExpirationLedger.hashCode()
+    result = 31 * result + invocation.hashCode()
+    return result
+  }
 }
@@ -90,6 +90,17 @@ sealed class HashIDPreimageXdr {
         else -> throw IllegalArgumentException("Unknown HashIDPreimageXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = EnvelopeTypeXdr.decode(reader)
+      when (discriminant) {
+        EnvelopeTypeXdr.ENVELOPE_TYPE_OP_ID -> HashIDPreimageOperationIDXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_POOL_REVOKE_OP_ID -> HashIDPreimageRevokeIDXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_CONTRACT_ID -> HashIDPreimageContractIDXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_SOROBAN_AUTHORIZATION -> HashIDPreimageSorobanAuthorizationXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown HashIDPreimageXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -109,4 +120,24 @@ sealed class HashIDPreimageXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is OperationID -> {
+        size += value.encodedSize()
+      }
+      is RevokeID -> {
+        size += value.encodedSize()
+      }
+      is ContractID -> {
+        size += value.encodedSize()
+      }
+      is SorobanAuthorization -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -15,9 +15,25 @@ value class HashXdr(val value: ByteArray) {
       val value = reader.readFixedOpaque(32)
       return HashXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(32)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(value, 32)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(32)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun HashXdr?.contentEquals(other: HashXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun HashXdr?.contentHashCode(): Int = this?.value.contentHashCode()
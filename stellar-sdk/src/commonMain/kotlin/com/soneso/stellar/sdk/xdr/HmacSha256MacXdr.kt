@@ -19,9 +19,27 @@ data class HmacSha256MacXdr(
       val mac = reader.readFixedOpaque(32)
       return HmacSha256MacXdr(mac)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(32)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(mac, 32)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(32)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is HmacSha256MacXdr) return false
+    return mac.contentEquals(other.mac)
+  }
+
+  override fun hashCode(): Int = mac.contentHashCode()
 }
@@ -36,6 +36,14 @@ sealed class HostFunctionXdr {
     val value: ByteArray
   ) : HostFunctionXdr() {
     override val discriminant: HostFunctionTypeXdr = HostFunctionTypeXdr.HOST_FUNCTION_TYPE_UPLOAD_CONTRACT_WASM
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Wasm) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class CreateContractV2(
@@ -68,6 +76,17 @@ sealed class HostFunctionXdr {
         else -> throw IllegalArgumentException("Unknown HostFunctionXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = HostFunctionTypeXdr.decode(reader)
+      when (discriminant) {
+        HostFunctionTypeXdr.HOST_FUNCTION_TYPE_INVOKE_CONTRACT -> InvokeContractArgsXdr.skip(reader)
+        HostFunctionTypeXdr.HOST_FUNCTION_TYPE_CREATE_CONTRACT -> CreateContractArgsXdr.skip(reader)
+        HostFunctionTypeXdr.HOST_FUNCTION_TYPE_UPLOAD_CONTRACT_WASM -> reader.skipVariableOpaque()
+        HostFunctionTypeXdr.HOST_FUNCTION_TYPE_CREATE_CONTRACT_V2 -> CreateContractArgsV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown HostFunctionXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -87,4 +106,24 @@ sealed class HostFunctionXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is InvokeContract -> {
+        size += value.encodedSize()
+      }
+      is CreateContract -> {
+        size += value.encodedSize()
+      }
+      is Wasm -> {
+        size += xdrVariableOpaqueSize(value)
+      }
+      is CreateContractV2 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -57,6 +57,16 @@ sealed class HotArchiveBucketEntryXdr {
         else -> throw IllegalArgumentException("Unknown HotArchiveBucketEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = HotArchiveBucketEntryTypeXdr.decode(reader)
+      when (discriminant) {
+        HotArchiveBucketEntryTypeXdr.HOT_ARCHIVE_ARCHIVED -> LedgerEntryXdr.skip(reader)
+        HotArchiveBucketEntryTypeXdr.HOT_ARCHIVE_LIVE -> LedgerKeyXdr.skip(reader)
+        HotArchiveBucketEntryTypeXdr.HOT_ARCHIVE_METAENTRY -> BucketMetadataXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown HotArchiveBucketEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -73,4 +83,21 @@ sealed class HotArchiveBucketEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ArchivedEntry -> {
+        size += value.encodedSize()
+      }
+      is Key -> {
+        size += value.encodedSize()
+      }
+      is MetaEntry -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class InflationPayoutXdr(
       val amount = Int64Xdr.decode(reader)
       return InflationPayoutXdr(destination, amount)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     destination.encode(writer)
     amount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += destination.encodedSize()
+    size += amount.encodedSize()
+    return size
+  }
 }
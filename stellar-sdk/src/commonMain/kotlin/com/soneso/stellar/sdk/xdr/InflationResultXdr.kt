@@ -39,6 +39,15 @@ sealed class InflationResultXdr {
         else -> throw IllegalArgumentException("Unknown InflationResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = InflationResultCodeXdr.decode(reader)
+      when (discriminant) {
+        InflationResultCodeXdr.INFLATION_SUCCESS -> repeat(reader.readInt()) { InflationPayoutXdr.skip(reader) }
+        InflationResultCodeXdr.INFLATION_NOT_TIME -> {}
+        else -> throw IllegalArgumentException("Unknown InflationResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -53,4 +62,19 @@ sealed class InflationResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Payouts -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
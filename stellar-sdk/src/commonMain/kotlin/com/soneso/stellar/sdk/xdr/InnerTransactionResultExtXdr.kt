@@ -27,6 +27,14 @@ sealed class InnerTransactionResultExtXdr {
         else -> throw IllegalArgumentException("Unknown InnerTransactionResultExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        else -> throw IllegalArgumentException("Unknown InnerTransactionResultExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +43,13 @@ sealed class InnerTransactionResultExtXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
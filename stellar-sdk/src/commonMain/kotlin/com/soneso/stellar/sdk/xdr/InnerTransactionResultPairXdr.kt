@@ -24,10 +24,35 @@ data class InnerTransactionResultPairXdr(
       val result = InnerTransactionResultXdr.decode(reader)
       return InnerTransactionResultPairXdr(transactionHash, result)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      InnerTransactionResultXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     transactionHash.encode(writer)
     result.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += transactionHash.encodedSize()
+    size += result.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is InnerTransactionResultPairXdr) return false
+    return transactionHash.contentEquals(other.transactionHash) &&
+      result == other.result
+  }
+
+  override fun hashCode(): Int {
+    var result = transactionHash.contentHashCode()
+    result = 31 * result + this.result.hashCode()
+    return result
+  }
 }
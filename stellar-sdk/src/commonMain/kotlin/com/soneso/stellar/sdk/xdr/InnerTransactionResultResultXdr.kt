@@ -35,10 +35,9 @@ sealed class InnerTransactionResultResultXdr {
 
   /** txFEE_BUMP_INNER_SUCCESS is not included */
   data class Results(
-    val value: List<OperationResultXdr>
-  ) : InnerTransactionResultResultXdr() {
+    val value: List<OperationResultXdr>,
     override val discriminant: TransactionResultCodeXdr = TransactionResultCodeXdr.txSUCCESS
-  }
+  ) : InnerTransactionResultResultXdr()
 
   /** txFEE_BUMP_INNER_FAILED is not included */
   data class Void(
@@ -52,11 +51,11 @@ sealed class InnerTransactionResultResultXdr {
       return when (discriminant) {
         TransactionResultCodeXdr.txSUCCESS -> {
           val value = List(reader.readInt()) { OperationResultXdr.decode(reader) }
-          Results(value)
+          Results(value, discriminant)
         }
         TransactionResultCodeXdr.txFAILED -> {
           val value = List(reader.readInt()) { OperationResultXdr.decode(reader) }
-          Results(value)
+          Results(value, discriminant)
         }
         TransactionResultCodeXdr.txTOO_EARLY -> Void(discriminant)
         TransactionResultCodeXdr.txTOO_LATE -> Void(discriminant)
@@ -76,6 +75,30 @@ sealed class InnerTransactionResultResultXdr {
         else -> throw IllegalArgumentException("Unknown InnerTransactionResultResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = TransactionResultCodeXdr.decode(reader)
+      when (discriminant) {
+        TransactionResultCodeXdr.txSUCCESS -> repeat(reader.readInt()) { OperationResultXdr.skip(reader) }
+        TransactionResultCodeXdr.txFAILED -> repeat(reader.readInt()) { OperationResultXdr.skip(reader) }
+        TransactionResultCodeXdr.txTOO_EARLY -> {}
+        TransactionResultCodeXdr.txTOO_LATE -> {}
+        TransactionResultCodeXdr.txMISSING_OPERATION -> {}
+        TransactionResultCodeXdr.txBAD_SEQ -> {}
+        TransactionResultCodeXdr.txBAD_AUTH -> {}
+        TransactionResultCodeXdr.txINSUFFICIENT_BALANCE -> {}
+        TransactionResultCodeXdr.txNO_ACCOUNT -> {}
+        TransactionResultCodeXdr.txINSUFFICIENT_FEE -> {}
+        TransactionResultCodeXdr.txBAD_AUTH_EXTRA -> {}
+        TransactionResultCodeXdr.txINTERNAL_ERROR -> {}
+        TransactionResultCodeXdr.txNOT_SUPPORTED -> {}
+        TransactionResultCodeXdr.txBAD_SPONSORSHIP -> {}
+        TransactionResultCodeXdr.txBAD_MIN_SEQ_AGE_OR_GAP -> {}
+        TransactionResultCodeXdr.txMALFORMED -> {}
+        TransactionResultCodeXdr.txSOROBAN_INVALID -> {}
+        else -> throw IllegalArgumentException("Unknown InnerTransactionResultResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -90,4 +113,19 @@ sealed class InnerTransactionResultResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Results -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -59,6 +59,12 @@ data class InnerTransactionResultXdr(
       val ext = InnerTransactionResultExtXdr.decode(reader)
       return InnerTransactionResultXdr(feeCharged, result, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+      InnerTransactionResultResultXdr.skip(reader)
+      InnerTransactionResultExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -66,4 +72,12 @@ data class InnerTransactionResultXdr(
     result.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += feeCharged.encodedSize()
+    size += result.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
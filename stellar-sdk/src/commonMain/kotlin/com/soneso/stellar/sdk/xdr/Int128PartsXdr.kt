@@ -21,10 +21,22 @@ data class Int128PartsXdr(
       val lo = Uint64Xdr.decode(reader)
       return Int128PartsXdr(hi, lo)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+      Uint64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     hi.encode(writer)
     lo.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hi.encodedSize()
+    size += lo.encodedSize()
+    return size
+  }
 }
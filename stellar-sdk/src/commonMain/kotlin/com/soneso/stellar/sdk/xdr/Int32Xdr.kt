@@ -15,9 +15,19 @@ value class Int32Xdr(val value: Int) {
       val value = reader.readInt()
       return Int32Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeInt(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    return size
+  }
 }
@@ -15,9 +15,19 @@ value class Int64Xdr(val value: Long) {
       val value = reader.readLong()
       return Int64Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(8)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeLong(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 8
+    return size
+  }
 }
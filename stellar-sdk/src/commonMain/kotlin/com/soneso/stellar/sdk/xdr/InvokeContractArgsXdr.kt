@@ -24,6 +24,12 @@ data class InvokeContractArgsXdr(
       val args = List(reader.readInt()) { SCValXdr.decode(reader) }
       return InvokeContractArgsXdr(contractAddress, functionName, args)
     }
+
+    fun skip(reader: XdrReader) {
+      SCAddressXdr.skip(reader)
+      SCSymbolXdr.skip(reader)
+      repeat(reader.readInt()) { SCValXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +40,15 @@ data class InvokeContractArgsXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += contractAddress.encodedSize()
+    size += functionName.encodedSize()
+    size += 4
+    args.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -25,6 +25,11 @@ data class InvokeHostFunctionOpXdr(
       val auth = List(reader.readInt()) { SorobanAuthorizationEntryXdr.decode(reader) }
       return InvokeHostFunctionOpXdr(hostFunction, auth)
     }
+
+    fun skip(reader: XdrReader) {
+      HostFunctionXdr.skip(reader)
+      repeat(reader.readInt()) { SorobanAuthorizationEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +39,14 @@ data class InvokeHostFunctionOpXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hostFunction.encodedSize()
+    size += 4
+    auth.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -24,6 +24,14 @@ sealed class InvokeHostFunctionResultXdr {
     val value: HashXdr
   ) : InvokeHostFunctionResultXdr() {
     override val discriminant: InvokeHostFunctionResultCodeXdr = InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_SUCCESS
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Success) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class Void(
@@ -47,6 +55,19 @@ sealed class InvokeHostFunctionResultXdr {
         else -> throw IllegalArgumentException("Unknown InvokeHostFunctionResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = InvokeHostFunctionResultCodeXdr.decode(reader)
+      when (discriminant) {
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_SUCCESS -> HashXdr.skip(reader)
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_MALFORMED -> {}
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_TRAPPED -> {}
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_RESOURCE_LIMIT_EXCEEDED -> {}
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_ENTRY_ARCHIVED -> {}
+        InvokeHostFunctionResultCodeXdr.INVOKE_HOST_FUNCTION_INSUFFICIENT_REFUNDABLE_FEE -> {}
+        else -> throw IllegalArgumentException("Unknown InvokeHostFunctionResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -58,4 +79,16 @@ sealed class InvokeHostFunctionResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Success -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class InvokeHostFunctionSuccessPreImageXdr(
       val events = List(reader.readInt()) { ContractEventXdr.decode(reader) }
       return InvokeHostFunctionSuccessPreImageXdr(returnValue, events)
     }
+
+    fun skip(reader: XdrReader) {
+      SCValXdr.skip(reader)
+      repeat(reader.readInt()) { ContractEventXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class InvokeHostFunctionSuccessPreImageXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += returnValue.encodedSize()
+    size += 4
+    events.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
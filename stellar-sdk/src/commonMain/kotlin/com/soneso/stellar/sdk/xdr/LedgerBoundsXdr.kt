@@ -23,10 +23,22 @@ data class LedgerBoundsXdr(
       val maxLedger = Uint32Xdr.decode(reader)
       return LedgerBoundsXdr(minLedger, maxLedger)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     minLedger.encode(writer)
     maxLedger.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += minLedger.encodedSize()
+    size += maxLedger.encodedSize()
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class LedgerCloseMetaExtV1Xdr(
       val sorobanFeeWrite1Kb = Int64Xdr.decode(reader)
       return LedgerCloseMetaExtV1Xdr(ext, sorobanFeeWrite1Kb)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ext.encode(writer)
     sorobanFeeWrite1Kb.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += sorobanFeeWrite1Kb.encodedSize()
+    return size
+  }
 }
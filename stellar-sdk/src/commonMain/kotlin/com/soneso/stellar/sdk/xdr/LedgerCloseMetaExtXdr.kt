@@ -39,6 +39,15 @@ sealed class LedgerCloseMetaExtXdr {
         else -> throw IllegalArgumentException("Unknown LedgerCloseMetaExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> LedgerCloseMetaExtV1Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerCloseMetaExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class LedgerCloseMetaExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V1 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
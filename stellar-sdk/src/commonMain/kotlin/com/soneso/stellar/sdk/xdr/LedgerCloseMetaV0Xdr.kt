@@ -41,6 +41,14 @@ data class LedgerCloseMetaV0Xdr(
       val scpInfo = List(reader.readInt()) { SCPHistoryEntryXdr.decode(reader) }
       return LedgerCloseMetaV0Xdr(ledgerHeader, txSet, txProcessing, upgradesProcessing, scpInfo)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerHeaderHistoryEntryXdr.skip(reader)
+      TransactionSetXdr.skip(reader)
+      repeat(reader.readInt()) { TransactionResultMetaXdr.skip(reader) }
+      repeat(reader.readInt()) { UpgradeEntryMetaXdr.skip(reader) }
+      repeat(reader.readInt()) { SCPHistoryEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -59,4 +67,23 @@ data class LedgerCloseMetaV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerHeader.encodedSize()
+    size += txSet.encodedSize()
+    size += 4
+    txProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    upgradesProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    scpInfo.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
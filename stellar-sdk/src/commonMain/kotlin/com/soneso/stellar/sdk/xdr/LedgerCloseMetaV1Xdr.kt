@@ -64,6 +64,18 @@ data class LedgerCloseMetaV1Xdr(
       val unused = List(reader.readInt()) { LedgerEntryXdr.decode(reader) }
       return LedgerCloseMetaV1Xdr(ext, ledgerHeader, txSet, txProcessing, upgradesProcessing, scpInfo, totalByteSizeOfLiveSorobanState, evictedKeys, unused)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerCloseMetaExtXdr.skip(reader)
+      LedgerHeaderHistoryEntryXdr.skip(reader)
+      GeneralizedTransactionSetXdr.skip(reader)
+      repeat(reader.readInt()) { TransactionResultMetaXdr.skip(reader) }
+      repeat(reader.readInt()) { UpgradeEntryMetaXdr.skip(reader) }
+      repeat(reader.readInt()) { SCPHistoryEntryXdr.skip(reader) }
+      Uint64Xdr.skip(reader)
+      repeat(reader.readInt()) { LedgerKeyXdr.skip(reader) }
+      repeat(reader.readInt()) { LedgerEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -92,4 +104,33 @@ data class LedgerCloseMetaV1Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += ledgerHeader.encodedSize()
+    size += txSet.encodedSize()
+    size += 4
+    txProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    upgradesProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    scpInfo.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += totalByteSizeOfLiveSorobanState.encodedSize()
+    size += 4
+    evictedKeys.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    unused.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
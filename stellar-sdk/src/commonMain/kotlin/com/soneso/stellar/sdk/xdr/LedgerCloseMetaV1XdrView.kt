@@ -0,0 +1,75 @@
+// Automatically generated by xdrgen
+// DO NOT EDIT or your changes may be overwritten
+
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only view of a [LedgerCloseMetaV1Xdr] encoded in [buffer] at [offset].
+ *
+ * Members are decoded from the buffer each time they are accessed, and members of
+ * view types are returned as views themselves, so an untouched view allocates nothing.
+ * A list of views is kept once created, since it finds its element offsets only once.
+ * Views are not thread-safe; the buffer must not be modified while they are in use.
+ */
+class LedgerCloseMetaV1XdrView(val buffer: ByteArray, val offset: Int) {
+  private var memberOffsets: IntArray? = null
+  private var knownOffsets = 1
+
+  val ext: LedgerCloseMetaExtXdr
+    get() = decodeXdrAt(buffer, memberOffset(0)) { reader -> LedgerCloseMetaExtXdr.decode(reader) }
+
+  val ledgerHeader: LedgerHeaderHistoryEntryXdr
+    get() = decodeXdrAt(buffer, memberOffset(1)) { reader -> LedgerHeaderHistoryEntryXdr.decode(reader) }
+
+  val txSet: GeneralizedTransactionSetXdr
+    get() = decodeXdrAt(buffer, memberOffset(2)) { reader -> GeneralizedTransactionSetXdr.decode(reader) }
+
+  private var txProcessingList: XdrViewList<TransactionResultMetaXdrView>? = null
+
+  val txProcessing: XdrViewList<TransactionResultMetaXdrView>
+    get() = txProcessingList ?: XdrViewList(buffer, memberOffset(3), { reader -> TransactionResultMetaXdr.skip(reader) }, ::TransactionResultMetaXdrView).also { txProcessingList = it }
+
+  val upgradesProcessing: List<UpgradeEntryMetaXdr>
+    get() = decodeXdrAt(buffer, memberOffset(4)) { reader -> List(reader.readInt()) { UpgradeEntryMetaXdr.decode(reader) } }
+
+  val scpInfo: List<SCPHistoryEntryXdr>
+    get() = decodeXdrAt(buffer, memberOffset(5)) { reader -> List(reader.readInt()) { SCPHistoryEntryXdr.decode(reader) } }
+
+  val totalByteSizeOfLiveSorobanState: Uint64Xdr
+    get() = decodeXdrAt(buffer, memberOffset(6)) { reader -> Uint64Xdr.decode(reader) }
+
+  val evictedKeys: List<LedgerKeyXdr>
+    get() = decodeXdrAt(buffer, memberOffset(7)) { reader -> List(reader.readInt()) { LedgerKeyXdr.decode(reader) } }
+
+  val unused: List<LedgerEntryXdr>
+    get() = decodeXdrAt(buffer, memberOffset(8)) { reader -> List(reader.readInt()) { LedgerEntryXdr.decode(reader) } }
+
+  /** Offset of the first byte after the encoded value. */
+  val endOffset: Int
+    get() = memberOffset(9)
+
+  /** Decodes the complete value. */
+  fun decode(): LedgerCloseMetaV1Xdr = decodeXdrAt(buffer, offset) { reader -> LedgerCloseMetaV1Xdr.decode(reader) }
+
+  private fun memberOffset(index: Int): Int {
+    if (index == 0) return offset
+    val offsets = memberOffsets ?: IntArray(10).also { it[0] = offset; memberOffsets = it }
+    if (index < knownOffsets) return offsets[index]
+    val reader = xdrReaderAt(buffer, offsets[knownOffsets - 1])
+    while (knownOffsets <= index) {
+      when (knownOffsets - 1) {
+        0 -> LedgerCloseMetaExtXdr.skip(reader)
+        1 -> LedgerHeaderHistoryEntryXdr.skip(reader)
+        2 -> GeneralizedTransactionSetXdr.skip(reader)
+        3 -> repeat(reader.readInt()) { TransactionResultMetaXdr.skip(reader) }
+        4 -> repeat(reader.readInt()) { UpgradeEntryMetaXdr.skip(reader) }
+        5 -> repeat(reader.readInt()) { SCPHistoryEntryXdr.skip(reader) }
+        6 -> Uint64Xdr.skip(reader)
+        7 -> repeat(reader.readInt()) { LedgerKeyXdr.skip(reader) }
+        8 -> repeat(reader.readInt()) { LedgerEntryXdr.skip(reader) }
+      }
+      offsets[knownOffsets++] = reader.position
+    }
+    return offsets[index]
+  }
+}
@@ -59,6 +59,17 @@ data class LedgerCloseMetaV2Xdr(
       val evictedKeys = List(reader.readInt()) { LedgerKeyXdr.decode(reader) }
       return LedgerCloseMetaV2Xdr(ext, ledgerHeader, txSet, txProcessing, upgradesProcessing, scpInfo, totalByteSizeOfLiveSorobanState, evictedKeys)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerCloseMetaExtXdr.skip(reader)
+      LedgerHeaderHistoryEntryXdr.skip(reader)
+      GeneralizedTransactionSetXdr.skip(reader)
+      repeat(reader.readInt()) { TransactionResultMetaV1Xdr.skip(reader) }
+      repeat(reader.readInt()) { UpgradeEntryMetaXdr.skip(reader) }
+      repeat(reader.readInt()) { SCPHistoryEntryXdr.skip(reader) }
+      Uint64Xdr.skip(reader)
+      repeat(reader.readInt()) { LedgerKeyXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -83,4 +94,29 @@ data class LedgerCloseMetaV2Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += ledgerHeader.encodedSize()
+    size += txSet.encodedSize()
+    size += 4
+    txProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    upgradesProcessing.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    scpInfo.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += totalByteSizeOfLiveSorobanState.encodedSize()
+    size += 4
+    evictedKeys.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -56,6 +56,16 @@ sealed class LedgerCloseMetaXdr {
         else -> throw IllegalArgumentException("Unknown LedgerCloseMetaXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> LedgerCloseMetaV0Xdr.skip(reader)
+        1 -> LedgerCloseMetaV1Xdr.skip(reader)
+        2 -> LedgerCloseMetaV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerCloseMetaXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +82,21 @@ sealed class LedgerCloseMetaXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+      is V1 -> {
+        size += value.encodedSize()
+      }
+      is V2 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -0,0 +1,45 @@
+// Automatically generated by xdrgen
+// DO NOT EDIT or your changes may be overwritten
+
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only view of a [LedgerCloseMetaXdr] encoded in [buffer] at [offset].
+ *
+ * Members are decoded from the buffer each time they are accessed, and members of
+ * view types are returned as views themselves, so an untouched view allocates nothing.
+ * A list of views is kept once created, since it finds its element offsets only once.
+ * Views are not thread-safe; the buffer must not be modified while they are in use.
+ */
+class LedgerCloseMetaXdrView(val buffer: ByteArray, val offset: Int) {
+  val discriminant: Int
+    get() = decodeXdrAt(buffer, offset) { reader -> reader.readInt() }
+
+  /** The v0 arm, or null if [discriminant] selects another arm. */
+  val v0: LedgerCloseMetaV0XdrView?
+    get() = when (discriminant) {
+      0 -> LedgerCloseMetaV0XdrView(buffer, offset + 4)
+      else -> null
+    }
+
+  /** The v1 arm, or null if [discriminant] selects another arm. */
+  val v1: LedgerCloseMetaV1XdrView?
+    get() = when (discriminant) {
+      1 -> LedgerCloseMetaV1XdrView(buffer, offset + 4)
+      else -> null
+    }
+
+  /** The v2 arm, or null if [discriminant] selects another arm. */
+  val v2: LedgerCloseMetaV2XdrView?
+    get() = when (discriminant) {
+      2 -> LedgerCloseMetaV2XdrView(buffer, offset + 4)
+      else -> null
+    }
+
+  /** Offset of the first byte after the encoded value. */
+  val endOffset: Int
+    get() = xdrReaderAt(buffer, offset).also { reader -> LedgerCloseMetaXdr.skip(reader) }.position
+
+  /** Decodes the complete value. */
+  fun decode(): LedgerCloseMetaXdr = decodeXdrAt(buffer, offset) { reader -> LedgerCloseMetaXdr.decode(reader) }
+}
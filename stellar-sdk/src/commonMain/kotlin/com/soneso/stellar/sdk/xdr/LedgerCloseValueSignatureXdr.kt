@@ -24,10 +24,35 @@ data class LedgerCloseValueSignatureXdr(
       val signature = SignatureXdr.decode(reader)
       return LedgerCloseValueSignatureXdr(nodeId, signature)
     }
+
+    fun skip(reader: XdrReader) {
+      NodeIDXdr.skip(reader)
+      SignatureXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     nodeId.encode(writer)
     signature.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += nodeId.encodedSize()
+    size += signature.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerCloseValueSignatureXdr) return false
+    return nodeId == other.nodeId &&
+      signature.contentEquals(other.signature)
+  }
+
+  override fun hashCode(): Int {
+    var result = nodeId.hashCode()
+    result = 31 * result + signature.contentHashCode()
+    return result
+  }
 }
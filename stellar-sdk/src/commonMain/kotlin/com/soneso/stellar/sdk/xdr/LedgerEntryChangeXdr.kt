@@ -80,6 +80,18 @@ sealed class LedgerEntryChangeXdr {
         else -> throw IllegalArgumentException("Unknown LedgerEntryChangeXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LedgerEntryChangeTypeXdr.decode(reader)
+      when (discriminant) {
+        LedgerEntryChangeTypeXdr.LEDGER_ENTRY_CREATED -> LedgerEntryXdr.skip(reader)
+        LedgerEntryChangeTypeXdr.LEDGER_ENTRY_UPDATED -> LedgerEntryXdr.skip(reader)
+        LedgerEntryChangeTypeXdr.LEDGER_ENTRY_REMOVED -> LedgerKeyXdr.skip(reader)
+        LedgerEntryChangeTypeXdr.LEDGER_ENTRY_STATE -> LedgerEntryXdr.skip(reader)
+        LedgerEntryChangeTypeXdr.LEDGER_ENTRY_RESTORED -> LedgerEntryXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerEntryChangeXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -102,4 +114,27 @@ sealed class LedgerEntryChangeXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Created -> {
+        size += value.encodedSize()
+      }
+      is Updated -> {
+        size += value.encodedSize()
+      }
+      is Removed -> {
+        size += value.encodedSize()
+      }
+      is State -> {
+        size += value.encodedSize()
+      }
+      is Restored -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
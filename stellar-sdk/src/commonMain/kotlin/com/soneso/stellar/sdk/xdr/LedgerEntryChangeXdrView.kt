@@ -0,0 +1,59 @@
+// Automatically generated by xdrgen
+// DO NOT EDIT or your changes may be overwritten
+
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only view of a [LedgerEntryChangeXdr] encoded in [buffer] at [offset].
+ *
+ * Members are decoded from the buffer each time they are accessed, and members of
+ * view types are returned as views themselves, so an untouched view allocates nothing.
+ * A list of views is kept once created, since it finds its element offsets only once.
+ * Views are not thread-safe; the buffer must not be modified while they are in use.
+ */
+class LedgerEntryChangeXdrView(val buffer: ByteArray, val offset: Int) {
+  val discriminant: LedgerEntryChangeTypeXdr
+    get() = decodeXdrAt(buffer, offset) { reader -> LedgerEntryChangeTypeXdr.decode(reader) }
+
+  /** The created arm, or null if [discriminant] selects another arm. */
+  val created: LedgerEntryXdr?
+    get() = when (discriminant) {
+      LedgerEntryChangeTypeXdr.LEDGER_ENTRY_CREATED -> decodeXdrAt(buffer, offset + 4) { reader -> LedgerEntryXdr.decode(reader) }
+      else -> null
+    }
+
+  /** The updated arm, or null if [discriminant] selects another arm. */
+  val updated: LedgerEntryXdr?
+    get() = when (discriminant) {
+      LedgerEntryChangeTypeXdr.LEDGER_ENTRY_UPDATED -> decodeXdrAt(buffer, offset + 4) { reader -> LedgerEntryXdr.decode(reader) }
+      else -> null
+    }
+
+  /** The removed arm, or null if [discriminant] selects another arm. */
+  val removed: LedgerKeyXdr?
+    get() = when (discriminant) {
+      LedgerEntryChangeTypeXdr.LEDGER_ENTRY_REMOVED -> decodeXdrAt(buffer, offset + 4) { reader -> LedgerKeyXdr.decode(reader) }
+      else -> null
+    }
+
+  /** The state arm, or null if [discriminant] selects another arm. */
+  val state: LedgerEntryXdr?
+    get() = when (discriminant) {
+      LedgerEntryChangeTypeXdr.LEDGER_ENTRY_STATE -> decodeXdrAt(buffer, offset + 4) { reader -> LedgerEntryXdr.decode(reader) }
+      else -> null
+    }
+
+  /** The restored arm, or null if [discriminant] selects another arm. */
+  val restored: LedgerEntryXdr?
+    get() = when (discriminant) {
+      LedgerEntryChangeTypeXdr.LEDGER_ENTRY_RESTORED -> decodeXdrAt(buffer, offset + 4) { reader -> LedgerEntryXdr.decode(reader) }
+      else -> null
+    }
+
+  /** Offset of the first byte after the encoded value. */
+  val endOffset: Int
+    get() = xdrReaderAt(buffer, offset).also { reader -> LedgerEntryChangeXdr.skip(reader) }.position
+
+  /** Decodes the complete value. */
+  fun decode(): LedgerEntryChangeXdr = decodeXdrAt(buffer, offset) { reader -> LedgerEntryChangeXdr.decode(reader) }
+}
@@ -15,6 +15,10 @@ value class LedgerEntryChangesXdr(val value: List<LedgerEntryChangeXdr>) {
       val value = List(reader.readInt()) { LedgerEntryChangeXdr.decode(reader) }
       return LedgerEntryChangesXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { LedgerEntryChangeXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class LedgerEntryChangesXdr(val value: List<LedgerEntryChangeXdr>) {
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -140,6 +140,23 @@ sealed class LedgerEntryDataXdr {
         else -> throw IllegalArgumentException("Unknown LedgerEntryDataXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LedgerEntryTypeXdr.decode(reader)
+      when (discriminant) {
+        LedgerEntryTypeXdr.ACCOUNT -> AccountEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.TRUSTLINE -> TrustLineEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.OFFER -> OfferEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.DATA -> DataEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.CLAIMABLE_BALANCE -> ClaimableBalanceEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.LIQUIDITY_POOL -> LiquidityPoolEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.CONTRACT_DATA -> ContractDataEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.CONTRACT_CODE -> ContractCodeEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.CONFIG_SETTING -> ConfigSettingEntryXdr.skip(reader)
+        LedgerEntryTypeXdr.TTL -> TTLEntryXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerEntryDataXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -177,4 +194,42 @@ sealed class LedgerEntryDataXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Account -> {
+        size += value.encodedSize()
+      }
+      is TrustLine -> {
+        size += value.encodedSize()
+      }
+      is Offer -> {
+        size += value.encodedSize()
+      }
+      is Data -> {
+        size += value.encodedSize()
+      }
+      is ClaimableBalance -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPool -> {
+        size += value.encodedSize()
+      }
+      is ContractData -> {
+        size += value.encodedSize()
+      }
+      is ContractCode -> {
+        size += value.encodedSize()
+      }
+      is ConfigSetting -> {
+        size += value.encodedSize()
+      }
+      is Ttl -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -28,10 +28,22 @@ data class LedgerEntryExtensionV1Xdr(
       val ext = LedgerEntryExtensionV1ExtXdr.decode(reader)
       return LedgerEntryExtensionV1Xdr(sponsoringId, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      SponsorshipDescriptorXdr.skip(reader)
+      LedgerEntryExtensionV1ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     sponsoringId.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sponsoringId.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
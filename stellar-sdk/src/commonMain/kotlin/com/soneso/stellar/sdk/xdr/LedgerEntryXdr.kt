@@ -59,6 +59,12 @@ data class LedgerEntryXdr(
       val ext = LedgerEntryExtXdr.decode(reader)
       return LedgerEntryXdr(lastModifiedLedgerSeq, data, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      LedgerEntryDataXdr.skip(reader)
+      LedgerEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -66,4 +72,12 @@ data class LedgerEntryXdr(
     data.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += lastModifiedLedgerSeq.encodedSize()
+    size += data.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class LedgerFootprintXdr(
       val readWrite = List(reader.readInt()) { LedgerKeyXdr.decode(reader) }
       return LedgerFootprintXdr(readOnly, readWrite)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { LedgerKeyXdr.skip(reader) }
+      repeat(reader.readInt()) { LedgerKeyXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +39,17 @@ data class LedgerFootprintXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    readOnly.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    readWrite.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -29,10 +29,22 @@ data class LedgerHeaderExtensionV1Xdr(
       val ext = LedgerHeaderExtensionV1ExtXdr.decode(reader)
       return LedgerHeaderExtensionV1Xdr(flags, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      LedgerHeaderExtensionV1ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     flags.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += flags.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
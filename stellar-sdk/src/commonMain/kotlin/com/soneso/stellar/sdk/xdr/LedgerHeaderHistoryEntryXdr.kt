@@ -32,6 +32,12 @@ data class LedgerHeaderHistoryEntryXdr(
       val ext = LedgerHeaderHistoryEntryExtXdr.decode(reader)
       return LedgerHeaderHistoryEntryXdr(hash, header, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      LedgerHeaderXdr.skip(reader)
+      LedgerHeaderHistoryEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +45,27 @@ data class LedgerHeaderHistoryEntryXdr(
     header.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hash.encodedSize()
+    size += header.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerHeaderHistoryEntryXdr) return false
+    return hash.contentEquals(other.hash) &&
+      header == other.header &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = hash.contentHashCode()
+    result = 31 * result + header.hashCode()
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
@@ -98,6 +98,24 @@ data class LedgerHeaderXdr(
       val ext = LedgerHeaderExtXdr.decode(reader)
       return LedgerHeaderXdr(ledgerVersion, previousLedgerHash, scpValue, txSetResultHash, bucketListHash, ledgerSeq, totalCoins, feePool, inflationSeq, idPool, baseFee, baseReserve, maxTxSetSize, skipList, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      HashXdr.skip(reader)
+      StellarValueXdr.skip(reader)
+      HashXdr.skip(reader)
+      HashXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      repeat(4) { HashXdr.skip(reader) }
+      LedgerHeaderExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -119,4 +137,65 @@ data class LedgerHeaderXdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerVersion.encodedSize()
+    size += previousLedgerHash.encodedSize()
+    size += scpValue.encodedSize()
+    size += txSetResultHash.encodedSize()
+    size += bucketListHash.encodedSize()
+    size += ledgerSeq.encodedSize()
+    size += totalCoins.encodedSize()
+    size += feePool.encodedSize()
+    size += inflationSeq.encodedSize()
+    size += idPool.encodedSize()
+    size += baseFee.encodedSize()
+    size += baseReserve.encodedSize()
+    size += maxTxSetSize.encodedSize()
+    skipList.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerHeaderXdr) return false
+    return ledgerVersion == other.ledgerVersion &&
+      previousLedgerHash.contentEquals(other.previousLedgerHash) &&
+      scpValue == other.scpValue &&
+      txSetResultHash.contentEquals(other.txSetResultHash) &&
+      bucketListHash.contentEquals(other.bucketListHash) &&
+      ledgerSeq == other.ledgerSeq &&
+      totalCoins == other.totalCoins &&
+      feePool == other.feePool &&
+      inflationSeq == other.inflationSeq &&
+      idPool == other.idPool &&
+      baseFee == other.baseFee &&
+      baseReserve == other.baseReserve &&
+      maxTxSetSize == other.maxTxSetSize &&
+      skipList.size == other.skipList.size && skipList.indices.all { skipList[it].contentEquals(other.skipList[it]) } &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = ledgerVersion.hashCode()
+    result = 31 * result + previousLedgerHash.contentHashCode()
+    result = 31 * result + scpValue.hashCode()
+    result = 31 * result + txSetResultHash.contentHashCode()
+    result = 31 * result + bucketListHash.contentHashCode()
+    result = 31 * result + ledgerSeq.hashCode()
+    result = 31 * result + totalCoins.hashCode()
+    result = 31 * result + feePool.hashCode()
+    result = 31 * result + inflationSeq.hashCode()
+    result = 31 * result + idPool.hashCode()
+    result = 31 * result + baseFee.hashCode()
+    result = 31 * result + baseReserve.hashCode()
+    result = 31 * result + maxTxSetSize.hashCode()
+    result = 31 * result + skipList.fold(1) { hash, item -> 31 * hash + item.contentHashCode() }
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
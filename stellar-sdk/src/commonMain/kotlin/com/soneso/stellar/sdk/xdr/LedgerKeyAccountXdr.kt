@@ -19,9 +19,19 @@ data class LedgerKeyAccountXdr(
       val accountId = AccountIDXdr.decode(reader)
       return LedgerKeyAccountXdr(accountId)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     accountId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class LedgerKeyClaimableBalanceXdr(
       val balanceId = ClaimableBalanceIDXdr.decode(reader)
       return LedgerKeyClaimableBalanceXdr(balanceId)
     }
+
+    fun skip(reader: XdrReader) {
+      ClaimableBalanceIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     balanceId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += balanceId.encodedSize()
+    return size
+  }
 }
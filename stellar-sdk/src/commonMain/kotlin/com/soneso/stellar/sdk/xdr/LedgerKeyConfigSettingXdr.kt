@@ -19,9 +19,19 @@ data class LedgerKeyConfigSettingXdr(
       val configSettingId = ConfigSettingIDXdr.decode(reader)
       return LedgerKeyConfigSettingXdr(configSettingId)
     }
+
+    fun skip(reader: XdrReader) {
+      ConfigSettingIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     configSettingId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += configSettingId.encodedSize()
+    return size
+  }
 }
@@ -19,9 +19,27 @@ data class LedgerKeyContractCodeXdr(
       val hash = HashXdr.decode(reader)
       return LedgerKeyContractCodeXdr(hash)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     hash.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hash.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerKeyContractCodeXdr) return false
+    return hash.contentEquals(other.hash)
+  }
+
+  override fun hashCode(): Int = hash.contentHashCode()
 }
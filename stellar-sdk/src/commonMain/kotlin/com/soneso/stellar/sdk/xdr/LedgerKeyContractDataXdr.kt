@@ -25,6 +25,12 @@ data class LedgerKeyContractDataXdr(
       val durability = ContractDataDurabilityXdr.decode(reader)
       return LedgerKeyContractDataXdr(contract, key, durability)
     }
+
+    fun skip(reader: XdrReader) {
+      SCAddressXdr.skip(reader)
+      SCValXdr.skip(reader)
+      ContractDataDurabilityXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class LedgerKeyContractDataXdr(
     key.encode(writer)
     durability.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += contract.encodedSize()
+    size += key.encodedSize()
+    size += durability.encodedSize()
+    return size
+  }
 }
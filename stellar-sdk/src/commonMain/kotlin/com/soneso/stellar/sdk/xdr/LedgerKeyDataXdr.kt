@@ -22,10 +22,22 @@ data class LedgerKeyDataXdr(
       val dataName = String64Xdr.decode(reader)
       return LedgerKeyDataXdr(accountId, dataName)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      String64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     accountId.encode(writer)
     dataName.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += dataName.encodedSize()
+    return size
+  }
 }
@@ -19,9 +19,27 @@ data class LedgerKeyLiquidityPoolXdr(
       val liquidityPoolId = PoolIDXdr.decode(reader)
       return LedgerKeyLiquidityPoolXdr(liquidityPoolId)
     }
+
+    fun skip(reader: XdrReader) {
+      PoolIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     liquidityPoolId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolId.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerKeyLiquidityPoolXdr) return false
+    return liquidityPoolId.contentEquals(other.liquidityPoolId)
+  }
+
+  override fun hashCode(): Int = liquidityPoolId.contentHashCode()
 }
@@ -22,10 +22,22 @@ data class LedgerKeyOfferXdr(
       val offerId = Int64Xdr.decode(reader)
       return LedgerKeyOfferXdr(sellerId, offerId)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     sellerId.encode(writer)
     offerId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sellerId.encodedSize()
+    size += offerId.encodedSize()
+    return size
+  }
 }
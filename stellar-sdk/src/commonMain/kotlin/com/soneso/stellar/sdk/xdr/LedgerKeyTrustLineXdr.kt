@@ -22,10 +22,22 @@ data class LedgerKeyTrustLineXdr(
       val asset = TrustLineAssetXdr.decode(reader)
       return LedgerKeyTrustLineXdr(accountId, asset)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      TrustLineAssetXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     accountId.encode(writer)
     asset.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += asset.encodedSize()
+    return size
+  }
 }
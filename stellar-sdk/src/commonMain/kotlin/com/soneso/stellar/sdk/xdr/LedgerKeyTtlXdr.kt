@@ -21,9 +21,27 @@ data class LedgerKeyTtlXdr(
       val keyHash = HashXdr.decode(reader)
       return LedgerKeyTtlXdr(keyHash)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     keyHash.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += keyHash.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LedgerKeyTtlXdr) return false
+    return keyHash.contentEquals(other.keyHash)
+  }
+
+  override fun hashCode(): Int = keyHash.contentHashCode()
 }
@@ -77,60 +77,190 @@ sealed class LedgerKeyXdr {
     val value: LedgerKeyAccountXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.ACCOUNT
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Account || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class TrustLine(
     val value: LedgerKeyTrustLineXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.TRUSTLINE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is TrustLine || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Offer(
     val value: LedgerKeyOfferXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.OFFER
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Offer || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Data(
     val value: LedgerKeyDataXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.DATA
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Data || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ClaimableBalance(
     val value: LedgerKeyClaimableBalanceXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.CLAIMABLE_BALANCE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ClaimableBalance || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class LiquidityPool(
     val value: LedgerKeyLiquidityPoolXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.LIQUIDITY_POOL
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is LiquidityPool || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ContractData(
     val value: LedgerKeyContractDataXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.CONTRACT_DATA
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ContractData || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ContractCode(
     val value: LedgerKeyContractCodeXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.CONTRACT_CODE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ContractCode || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ConfigSetting(
     val value: LedgerKeyConfigSettingXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.CONFIG_SETTING
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ConfigSetting || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Ttl(
     val value: LedgerKeyTtlXdr
   ) : LedgerKeyXdr() {
     override val discriminant: LedgerEntryTypeXdr = LedgerEntryTypeXdr.TTL
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Ttl || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   companion object {
@@ -181,6 +311,23 @@ sealed class LedgerKeyXdr {
         else -> throw IllegalArgumentException("Unknown LedgerKeyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LedgerEntryTypeXdr.decode(reader)
+      when (discriminant) {
+        LedgerEntryTypeXdr.ACCOUNT -> LedgerKeyAccountXdr.skip(reader)
+        LedgerEntryTypeXdr.TRUSTLINE -> LedgerKeyTrustLineXdr.skip(reader)
+        LedgerEntryTypeXdr.OFFER -> LedgerKeyOfferXdr.skip(reader)
+        LedgerEntryTypeXdr.DATA -> LedgerKeyDataXdr.skip(reader)
+        LedgerEntryTypeXdr.CLAIMABLE_BALANCE -> LedgerKeyClaimableBalanceXdr.skip(reader)
+        LedgerEntryTypeXdr.LIQUIDITY_POOL -> LedgerKeyLiquidityPoolXdr.skip(reader)
+        LedgerEntryTypeXdr.CONTRACT_DATA -> LedgerKeyContractDataXdr.skip(reader)
+        LedgerEntryTypeXdr.CONTRACT_CODE -> LedgerKeyContractCodeXdr.skip(reader)
+        LedgerEntryTypeXdr.CONFIG_SETTING -> LedgerKeyConfigSettingXdr.skip(reader)
+        LedgerEntryTypeXdr.TTL -> LedgerKeyTtlXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerKeyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -218,4 +365,42 @@ sealed class LedgerKeyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Account -> {
+        size += value.encodedSize()
+      }
+      is TrustLine -> {
+        size += value.encodedSize()
+      }
+      is Offer -> {
+        size += value.encodedSize()
+      }
+      is Data -> {
+        size += value.encodedSize()
+      }
+      is ClaimableBalance -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPool -> {
+        size += value.encodedSize()
+      }
+      is ContractData -> {
+        size += value.encodedSize()
+      }
+      is ContractCode -> {
+        size += value.encodedSize()
+      }
+      is ConfigSetting -> {
+        size += value.encodedSize()
+      }
+      is Ttl -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
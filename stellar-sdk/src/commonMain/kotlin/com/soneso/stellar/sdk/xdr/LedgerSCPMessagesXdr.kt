@@ -22,6 +22,11 @@ data class LedgerSCPMessagesXdr(
       val messages = List(reader.readInt()) { SCPEnvelopeXdr.decode(reader) }
       return LedgerSCPMessagesXdr(ledgerSeq, messages)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      repeat(reader.readInt()) { SCPEnvelopeXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class LedgerSCPMessagesXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerSeq.encodedSize()
+    size += 4
+    messages.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
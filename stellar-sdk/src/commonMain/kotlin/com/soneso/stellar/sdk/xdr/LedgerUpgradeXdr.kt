@@ -109,6 +109,20 @@ sealed class LedgerUpgradeXdr {
         else -> throw IllegalArgumentException("Unknown LedgerUpgradeXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LedgerUpgradeTypeXdr.decode(reader)
+      when (discriminant) {
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_VERSION -> Uint32Xdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_BASE_FEE -> Uint32Xdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_MAX_TX_SET_SIZE -> Uint32Xdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_BASE_RESERVE -> Uint32Xdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_FLAGS -> Uint32Xdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_CONFIG -> ConfigUpgradeSetKeyXdr.skip(reader)
+        LedgerUpgradeTypeXdr.LEDGER_UPGRADE_MAX_SOROBAN_TX_SET_SIZE -> Uint32Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LedgerUpgradeXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -137,4 +151,33 @@ sealed class LedgerUpgradeXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is NewLedgerVersion -> {
+        size += value.encodedSize()
+      }
+      is NewBaseFee -> {
+        size += value.encodedSize()
+      }
+      is NewMaxTxSetSize -> {
+        size += value.encodedSize()
+      }
+      is NewBaseReserve -> {
+        size += value.encodedSize()
+      }
+      is NewFlags -> {
+        size += value.encodedSize()
+      }
+      is NewConfig -> {
+        size += value.encodedSize()
+      }
+      is NewMaxSorobanTxSetSize -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class LiabilitiesXdr(
       val selling = Int64Xdr.decode(reader)
       return LiabilitiesXdr(buying, selling)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     buying.encode(writer)
     selling.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += buying.encodedSize()
+    size += selling.encodedSize()
+    return size
+  }
 }
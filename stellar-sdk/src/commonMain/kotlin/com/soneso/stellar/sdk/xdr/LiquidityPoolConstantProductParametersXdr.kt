@@ -27,6 +27,12 @@ data class LiquidityPoolConstantProductParametersXdr(
       val fee = Int32Xdr.decode(reader)
       return LiquidityPoolConstantProductParametersXdr(assetA, assetB, fee)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +40,12 @@ data class LiquidityPoolConstantProductParametersXdr(
     assetB.encode(writer)
     fee.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += assetA.encodedSize()
+    size += assetB.encodedSize()
+    size += fee.encodedSize()
+    return size
+  }
 }
@@ -35,6 +35,14 @@ data class LiquidityPoolDepositOpXdr(
       val maxPrice = PriceXdr.decode(reader)
       return LiquidityPoolDepositOpXdr(liquidityPoolId, maxAmountA, maxAmountB, minPrice, maxPrice)
     }
+
+    fun skip(reader: XdrReader) {
+      PoolIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      PriceXdr.skip(reader)
+      PriceXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +52,33 @@ data class LiquidityPoolDepositOpXdr(
     minPrice.encode(writer)
     maxPrice.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolId.encodedSize()
+    size += maxAmountA.encodedSize()
+    size += maxAmountB.encodedSize()
+    size += minPrice.encodedSize()
+    size += maxPrice.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LiquidityPoolDepositOpXdr) return false
+    return liquidityPoolId.contentEquals(other.liquidityPoolId) &&
+      maxAmountA == other.maxAmountA &&
+      maxAmountB == other.maxAmountB &&
+      minPrice == other.minPrice &&
+      maxPrice == other.maxPrice
+  }
+
+  override fun hashCode(): Int {
+    var result = liquidityPoolId.contentHashCode()
+    result = 31 * result + maxAmountA.hashCode()
+    result = 31 * result + maxAmountB.hashCode()
+    result = 31 * result + minPrice.hashCode()
+    result = 31 * result + maxPrice.hashCode()
+    return result
+  }
 }
@@ -42,6 +42,21 @@ sealed class LiquidityPoolDepositResultXdr {
         else -> throw IllegalArgumentException("Unknown LiquidityPoolDepositResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LiquidityPoolDepositResultCodeXdr.decode(reader)
+      when (discriminant) {
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_SUCCESS -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_MALFORMED -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_NO_TRUST -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_NOT_AUTHORIZED -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_UNDERFUNDED -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_LINE_FULL -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_BAD_PRICE -> {}
+        LiquidityPoolDepositResultCodeXdr.LIQUIDITY_POOL_DEPOSIT_POOL_FULL -> {}
+        else -> throw IllegalArgumentException("Unknown LiquidityPoolDepositResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +65,13 @@ sealed class LiquidityPoolDepositResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
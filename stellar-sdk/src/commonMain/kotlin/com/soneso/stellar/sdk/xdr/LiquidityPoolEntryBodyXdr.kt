@@ -41,6 +41,14 @@ sealed class LiquidityPoolEntryBodyXdr {
         else -> throw IllegalArgumentException("Unknown LiquidityPoolEntryBodyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LiquidityPoolTypeXdr.decode(reader)
+      when (discriminant) {
+        LiquidityPoolTypeXdr.LIQUIDITY_POOL_CONSTANT_PRODUCT -> LiquidityPoolEntryConstantProductXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LiquidityPoolEntryBodyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -51,4 +59,15 @@ sealed class LiquidityPoolEntryBodyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ConstantProduct -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -37,6 +37,14 @@ data class LiquidityPoolEntryConstantProductXdr(
       val poolSharesTrustLineCount = Int64Xdr.decode(reader)
       return LiquidityPoolEntryConstantProductXdr(params, reserveA, reserveB, totalPoolShares, poolSharesTrustLineCount)
     }
+
+    fun skip(reader: XdrReader) {
+      LiquidityPoolConstantProductParametersXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +54,14 @@ data class LiquidityPoolEntryConstantProductXdr(
     totalPoolShares.encode(writer)
     poolSharesTrustLineCount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += params.encodedSize()
+    size += reserveA.encodedSize()
+    size += reserveB.encodedSize()
+    size += totalPoolShares.encodedSize()
+    size += poolSharesTrustLineCount.encodedSize()
+    return size
+  }
 }
@@ -37,10 +37,35 @@ data class LiquidityPoolEntryXdr(
       val body = LiquidityPoolEntryBodyXdr.decode(reader)
       return LiquidityPoolEntryXdr(liquidityPoolId, body)
     }
+
+    fun skip(reader: XdrReader) {
+      PoolIDXdr.skip(reader)
+      LiquidityPoolEntryBodyXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     liquidityPoolId.encode(writer)
     body.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolId.encodedSize()
+    size += body.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LiquidityPoolEntryXdr) return false
+    return liquidityPoolId.contentEquals(other.liquidityPoolId) &&
+      body == other.body
+  }
+
+  override fun hashCode(): Int {
+    var result = liquidityPoolId.contentHashCode()
+    result = 31 * result + body.hashCode()
+    return result
+  }
 }
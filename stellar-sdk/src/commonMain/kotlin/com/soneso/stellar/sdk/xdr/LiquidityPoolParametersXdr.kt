@@ -32,6 +32,14 @@ sealed class LiquidityPoolParametersXdr {
         else -> throw IllegalArgumentException("Unknown LiquidityPoolParametersXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LiquidityPoolTypeXdr.decode(reader)
+      when (discriminant) {
+        LiquidityPoolTypeXdr.LIQUIDITY_POOL_CONSTANT_PRODUCT -> LiquidityPoolConstantProductParametersXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown LiquidityPoolParametersXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +50,15 @@ sealed class LiquidityPoolParametersXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ConstantProduct -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -31,6 +31,13 @@ data class LiquidityPoolWithdrawOpXdr(
       val minAmountB = Int64Xdr.decode(reader)
       return LiquidityPoolWithdrawOpXdr(liquidityPoolId, amount, minAmountA, minAmountB)
     }
+
+    fun skip(reader: XdrReader) {
+      PoolIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +46,30 @@ data class LiquidityPoolWithdrawOpXdr(
     minAmountA.encode(writer)
     minAmountB.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolId.encodedSize()
+    size += amount.encodedSize()
+    size += minAmountA.encodedSize()
+    size += minAmountB.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is LiquidityPoolWithdrawOpXdr) return false
+    return liquidityPoolId.contentEquals(other.liquidityPoolId) &&
+      amount == other.amount &&
+      minAmountA == other.minAmountA &&
+      minAmountB == other.minAmountB
+  }
+
+  override fun hashCode(): Int {
+    var result = liquidityPoolId.contentHashCode()
+    result = 31 * result + amount.hashCode()
+    result = 31 * result + minAmountA.hashCode()
+    result = 31 * result + minAmountB.hashCode()
+    return result
+  }
 }
@@ -38,6 +38,19 @@ sealed class LiquidityPoolWithdrawResultXdr {
         else -> throw IllegalArgumentException("Unknown LiquidityPoolWithdrawResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = LiquidityPoolWithdrawResultCodeXdr.decode(reader)
+      when (discriminant) {
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_SUCCESS -> {}
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_MALFORMED -> {}
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_NO_TRUST -> {}
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_UNDERFUNDED -> {}
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_LINE_FULL -> {}
+        LiquidityPoolWithdrawResultCodeXdr.LIQUIDITY_POOL_WITHDRAW_UNDER_MINIMUM -> {}
+        else -> throw IllegalArgumentException("Unknown LiquidityPoolWithdrawResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +59,13 @@ sealed class LiquidityPoolWithdrawResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
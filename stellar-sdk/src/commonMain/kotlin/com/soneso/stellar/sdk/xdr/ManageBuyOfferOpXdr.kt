@@ -40,6 +40,14 @@ data class ManageBuyOfferOpXdr(
       val offerId = Int64Xdr.decode(reader)
       return ManageBuyOfferOpXdr(selling, buying, buyAmount, price, offerId)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      PriceXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -49,4 +57,14 @@ data class ManageBuyOfferOpXdr(
     price.encode(writer)
     offerId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += selling.encodedSize()
+    size += buying.encodedSize()
+    size += buyAmount.encodedSize()
+    size += price.encodedSize()
+    size += offerId.encodedSize()
+    return size
+  }
 }
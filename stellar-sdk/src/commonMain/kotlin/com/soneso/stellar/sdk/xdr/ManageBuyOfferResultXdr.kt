@@ -61,6 +61,26 @@ sealed class ManageBuyOfferResultXdr {
         else -> throw IllegalArgumentException("Unknown ManageBuyOfferResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ManageBuyOfferResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_SUCCESS -> ManageOfferSuccessResultXdr.skip(reader)
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_MALFORMED -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_SELL_NO_TRUST -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_BUY_NO_TRUST -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_SELL_NOT_AUTHORIZED -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_BUY_NOT_AUTHORIZED -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_LINE_FULL -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_UNDERFUNDED -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_CROSS_SELF -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_SELL_NO_ISSUER -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_BUY_NO_ISSUER -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_NOT_FOUND -> {}
+        ManageBuyOfferResultCodeXdr.MANAGE_BUY_OFFER_LOW_RESERVE -> {}
+        else -> throw IllegalArgumentException("Unknown ManageBuyOfferResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +92,16 @@ sealed class ManageBuyOfferResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Success -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -23,6 +23,11 @@ data class ManageDataOpXdr(
       val dataValue = if (reader.readBoolean()) DataValueXdr.decode(reader) else null
       return ManageDataOpXdr(dataName, dataValue)
     }
+
+    fun skip(reader: XdrReader) {
+      String64Xdr.skip(reader)
+      if (reader.readBoolean()) DataValueXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +39,29 @@ data class ManageDataOpXdr(
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += dataName.encodedSize()
+    if (dataValue != null) {
+      size += 4
+      size += dataValue.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ManageDataOpXdr) return false
+    return dataName == other.dataName &&
+      dataValue.contentEquals(other.dataValue)
+  }
+
+  override fun hashCode(): Int {
+    var result = dataName.hashCode()
+    result = 31 * result + dataValue.contentHashCode()
+    return result
+  }
 }
@@ -36,6 +36,18 @@ sealed class ManageDataResultXdr {
         else -> throw IllegalArgumentException("Unknown ManageDataResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ManageDataResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ManageDataResultCodeXdr.MANAGE_DATA_SUCCESS -> {}
+        ManageDataResultCodeXdr.MANAGE_DATA_NOT_SUPPORTED_YET -> {}
+        ManageDataResultCodeXdr.MANAGE_DATA_NAME_NOT_FOUND -> {}
+        ManageDataResultCodeXdr.MANAGE_DATA_LOW_RESERVE -> {}
+        ManageDataResultCodeXdr.MANAGE_DATA_INVALID_NAME -> {}
+        else -> throw IllegalArgumentException("Unknown ManageDataResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -44,4 +56,13 @@ sealed class ManageDataResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -18,10 +18,9 @@ sealed class ManageOfferSuccessResultOfferXdr {
   abstract val discriminant: ManageOfferEffectXdr
 
   data class Offer(
-    val value: OfferEntryXdr
-  ) : ManageOfferSuccessResultOfferXdr() {
+    val value: OfferEntryXdr,
     override val discriminant: ManageOfferEffectXdr = ManageOfferEffectXdr.MANAGE_OFFER_CREATED
-  }
+  ) : ManageOfferSuccessResultOfferXdr()
 
   data object Void : ManageOfferSuccessResultOfferXdr() {
     override val discriminant: ManageOfferEffectXdr = ManageOfferEffectXdr.MANAGE_OFFER_DELETED
@@ -34,16 +33,26 @@ sealed class ManageOfferSuccessResultOfferXdr {
       return when (discriminant) {
         ManageOfferEffectXdr.MANAGE_OFFER_CREATED -> {
           val value = OfferEntryXdr.decode(reader)
-          Offer(value)
+          Offer(value, discriminant)
         }
         ManageOfferEffectXdr.MANAGE_OFFER_UPDATED -> {
           val value = OfferEntryXdr.decode(reader)
-          Offer(value)
+          Offer(value, discriminant)
         }
         ManageOfferEffectXdr.MANAGE_OFFER_DELETED -> Void
         else -> throw IllegalArgumentException("Unknown ManageOfferSuccessResultOfferXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ManageOfferEffectXdr.decode(reader)
+      when (discriminant) {
+        ManageOfferEffectXdr.MANAGE_OFFER_CREATED -> OfferEntryXdr.skip(reader)
+        ManageOfferEffectXdr.MANAGE_OFFER_UPDATED -> OfferEntryXdr.skip(reader)
+        ManageOfferEffectXdr.MANAGE_OFFER_DELETED -> {}
+        else -> throw IllegalArgumentException("Unknown ManageOfferSuccessResultOfferXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -55,4 +64,16 @@ sealed class ManageOfferSuccessResultOfferXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Offer -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
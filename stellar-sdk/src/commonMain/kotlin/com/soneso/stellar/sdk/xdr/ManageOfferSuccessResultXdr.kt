@@ -32,6 +32,11 @@ data class ManageOfferSuccessResultXdr(
       val offer = ManageOfferSuccessResultOfferXdr.decode(reader)
       return ManageOfferSuccessResultXdr(offersClaimed, offer)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { ClaimAtomXdr.skip(reader) }
+      ManageOfferSuccessResultOfferXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -41,4 +46,14 @@ data class ManageOfferSuccessResultXdr(
     }
     offer.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    offersClaimed.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += offer.encodedSize()
+    return size
+  }
 }
@@ -36,6 +36,14 @@ data class ManageSellOfferOpXdr(
       val offerId = Int64Xdr.decode(reader)
       return ManageSellOfferOpXdr(selling, buying, amount, price, offerId)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      PriceXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -45,4 +53,14 @@ data class ManageSellOfferOpXdr(
     price.encode(writer)
     offerId.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += selling.encodedSize()
+    size += buying.encodedSize()
+    size += amount.encodedSize()
+    size += price.encodedSize()
+    size += offerId.encodedSize()
+    return size
+  }
 }
@@ -61,6 +61,26 @@ sealed class ManageSellOfferResultXdr {
         else -> throw IllegalArgumentException("Unknown ManageSellOfferResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = ManageSellOfferResultCodeXdr.decode(reader)
+      when (discriminant) {
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_SUCCESS -> ManageOfferSuccessResultXdr.skip(reader)
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_MALFORMED -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_SELL_NO_TRUST -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_BUY_NO_TRUST -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_SELL_NOT_AUTHORIZED -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_BUY_NOT_AUTHORIZED -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_LINE_FULL -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_UNDERFUNDED -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_CROSS_SELF -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_SELL_NO_ISSUER -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_BUY_NO_ISSUER -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_NOT_FOUND -> {}
+        ManageSellOfferResultCodeXdr.MANAGE_SELL_OFFER_LOW_RESERVE -> {}
+        else -> throw IllegalArgumentException("Unknown ManageSellOfferResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +92,16 @@ sealed class ManageSellOfferResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Success -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
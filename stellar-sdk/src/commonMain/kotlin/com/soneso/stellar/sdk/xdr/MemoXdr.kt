@@ -38,12 +38,28 @@ sealed class MemoXdr {
     val value: HashXdr
   ) : MemoXdr() {
     override val discriminant: MemoTypeXdr = MemoTypeXdr.MEMO_HASH
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Hash) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class RetHash(
     val value: HashXdr
   ) : MemoXdr() {
     override val discriminant: MemoTypeXdr = MemoTypeXdr.MEMO_RETURN
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is RetHash) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data object Void : MemoXdr() {
@@ -75,6 +91,18 @@ sealed class MemoXdr {
         else -> throw IllegalArgumentException("Unknown MemoXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = MemoTypeXdr.decode(reader)
+      when (discriminant) {
+        MemoTypeXdr.MEMO_NONE -> {}
+        MemoTypeXdr.MEMO_TEXT -> reader.skipVariableOpaque()
+        MemoTypeXdr.MEMO_ID -> Uint64Xdr.skip(reader)
+        MemoTypeXdr.MEMO_HASH -> HashXdr.skip(reader)
+        MemoTypeXdr.MEMO_RETURN -> HashXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown MemoXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -95,4 +123,25 @@ sealed class MemoXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is Text -> {
+        size += xdrStringSize(value)
+      }
+      is Id -> {
+        size += value.encodedSize()
+      }
+      is Hash -> {
+        size += value.encodedSize()
+      }
+      is RetHash -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,10 +22,35 @@ data class MuxedAccountMed25519Xdr(
       val ed25519 = Uint256Xdr.decode(reader)
       return MuxedAccountMed25519Xdr(id, ed25519)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint64Xdr.skip(reader)
+      Uint256Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     id.encode(writer)
     ed25519.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += id.encodedSize()
+    size += ed25519.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is MuxedAccountMed25519Xdr) return false
+    return id == other.id &&
+      ed25519.contentEquals(other.ed25519)
+  }
+
+  override fun hashCode(): Int {
+    var result = id.hashCode()
+    result = 31 * result + ed25519.contentHashCode()
+    return result
+  }
 }
@@ -24,6 +24,14 @@ sealed class MuxedAccountXdr {
     val value: Uint256Xdr
   ) : MuxedAccountXdr() {
     override val discriminant: CryptoKeyTypeXdr = CryptoKeyTypeXdr.KEY_TYPE_ED25519
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Ed25519) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class Med25519(
@@ -48,6 +56,15 @@ sealed class MuxedAccountXdr {
         else -> throw IllegalArgumentException("Unknown MuxedAccountXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = CryptoKeyTypeXdr.decode(reader)
+      when (discriminant) {
+        CryptoKeyTypeXdr.KEY_TYPE_ED25519 -> Uint256Xdr.skip(reader)
+        CryptoKeyTypeXdr.KEY_TYPE_MUXED_ED25519 -> MuxedAccountMed25519Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown MuxedAccountXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -61,4 +78,18 @@ sealed class MuxedAccountXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Ed25519 -> {
+        size += value.encodedSize()
+      }
+      is Med25519 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
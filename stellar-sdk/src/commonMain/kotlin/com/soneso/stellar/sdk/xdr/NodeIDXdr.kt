@@ -15,9 +15,19 @@ value class NodeIDXdr(val value: PublicKeyXdr) {
       val value = PublicKeyXdr.decode(reader)
       return NodeIDXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      PublicKeyXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += value.encodedSize()
+    return size
+  }
 }
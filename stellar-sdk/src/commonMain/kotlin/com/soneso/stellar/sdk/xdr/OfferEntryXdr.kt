@@ -57,6 +57,17 @@ data class OfferEntryXdr(
       val ext = OfferEntryExtXdr.decode(reader)
       return OfferEntryXdr(sellerId, offerId, selling, buying, amount, price, flags, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      AssetXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      PriceXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      OfferEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -69,4 +80,17 @@ data class OfferEntryXdr(
     flags.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sellerId.encodedSize()
+    size += offerId.encodedSize()
+    size += selling.encodedSize()
+    size += buying.encodedSize()
+    size += amount.encodedSize()
+    size += price.encodedSize()
+    size += flags.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
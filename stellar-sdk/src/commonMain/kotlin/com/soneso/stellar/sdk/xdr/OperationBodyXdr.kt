@@ -330,6 +330,40 @@ sealed class OperationBodyXdr {
         else -> throw IllegalArgumentException("Unknown OperationBodyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = OperationTypeXdr.decode(reader)
+      when (discriminant) {
+        OperationTypeXdr.CREATE_ACCOUNT -> CreateAccountOpXdr.skip(reader)
+        OperationTypeXdr.PAYMENT -> PaymentOpXdr.skip(reader)
+        OperationTypeXdr.PATH_PAYMENT_STRICT_RECEIVE -> PathPaymentStrictReceiveOpXdr.skip(reader)
+        OperationTypeXdr.MANAGE_SELL_OFFER -> ManageSellOfferOpXdr.skip(reader)
+        OperationTypeXdr.CREATE_PASSIVE_SELL_OFFER -> CreatePassiveSellOfferOpXdr.skip(reader)
+        OperationTypeXdr.SET_OPTIONS -> SetOptionsOpXdr.skip(reader)
+        OperationTypeXdr.CHANGE_TRUST -> ChangeTrustOpXdr.skip(reader)
+        OperationTypeXdr.ALLOW_TRUST -> AllowTrustOpXdr.skip(reader)
+        OperationTypeXdr.ACCOUNT_MERGE -> MuxedAccountXdr.skip(reader)
+        OperationTypeXdr.INFLATION -> {}
+        OperationTypeXdr.MANAGE_DATA -> ManageDataOpXdr.skip(reader)
+        OperationTypeXdr.BUMP_SEQUENCE -> BumpSequenceOpXdr.skip(reader)
+        OperationTypeXdr.MANAGE_BUY_OFFER -> ManageBuyOfferOpXdr.skip(reader)
+        OperationTypeXdr.PATH_PAYMENT_STRICT_SEND -> PathPaymentStrictSendOpXdr.skip(reader)
+        OperationTypeXdr.CREATE_CLAIMABLE_BALANCE -> CreateClaimableBalanceOpXdr.skip(reader)
+        OperationTypeXdr.CLAIM_CLAIMABLE_BALANCE -> ClaimClaimableBalanceOpXdr.skip(reader)
+        OperationTypeXdr.BEGIN_SPONSORING_FUTURE_RESERVES -> BeginSponsoringFutureReservesOpXdr.skip(reader)
+        OperationTypeXdr.END_SPONSORING_FUTURE_RESERVES -> {}
+        OperationTypeXdr.REVOKE_SPONSORSHIP -> RevokeSponsorshipOpXdr.skip(reader)
+        OperationTypeXdr.CLAWBACK -> ClawbackOpXdr.skip(reader)
+        OperationTypeXdr.CLAWBACK_CLAIMABLE_BALANCE -> ClawbackClaimableBalanceOpXdr.skip(reader)
+        OperationTypeXdr.SET_TRUST_LINE_FLAGS -> SetTrustLineFlagsOpXdr.skip(reader)
+        OperationTypeXdr.LIQUIDITY_POOL_DEPOSIT -> LiquidityPoolDepositOpXdr.skip(reader)
+        OperationTypeXdr.LIQUIDITY_POOL_WITHDRAW -> LiquidityPoolWithdrawOpXdr.skip(reader)
+        OperationTypeXdr.INVOKE_HOST_FUNCTION -> InvokeHostFunctionOpXdr.skip(reader)
+        OperationTypeXdr.EXTEND_FOOTPRINT_TTL -> ExtendFootprintTTLOpXdr.skip(reader)
+        OperationTypeXdr.RESTORE_FOOTPRINT -> RestoreFootprintOpXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown OperationBodyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -413,4 +447,88 @@ sealed class OperationBodyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is CreateAccountOp -> {
+        size += value.encodedSize()
+      }
+      is PaymentOp -> {
+        size += value.encodedSize()
+      }
+      is PathPaymentStrictReceiveOp -> {
+        size += value.encodedSize()
+      }
+      is ManageSellOfferOp -> {
+        size += value.encodedSize()
+      }
+      is CreatePassiveSellOfferOp -> {
+        size += value.encodedSize()
+      }
+      is SetOptionsOp -> {
+        size += value.encodedSize()
+      }
+      is ChangeTrustOp -> {
+        size += value.encodedSize()
+      }
+      is AllowTrustOp -> {
+        size += value.encodedSize()
+      }
+      is Destination -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+      is ManageDataOp -> {
+        size += value.encodedSize()
+      }
+      is BumpSequenceOp -> {
+        size += value.encodedSize()
+      }
+      is ManageBuyOfferOp -> {
+        size += value.encodedSize()
+      }
+      is PathPaymentStrictSendOp -> {
+        size += value.encodedSize()
+      }
+      is CreateClaimableBalanceOp -> {
+        size += value.encodedSize()
+      }
+      is ClaimClaimableBalanceOp -> {
+        size += value.encodedSize()
+      }
+      is BeginSponsoringFutureReservesOp -> {
+        size += value.encodedSize()
+      }
+      is RevokeSponsorshipOp -> {
+        size += value.encodedSize()
+      }
+      is ClawbackOp -> {
+        size += value.encodedSize()
+      }
+      is ClawbackClaimableBalanceOp -> {
+        size += value.encodedSize()
+      }
+      is SetTrustLineFlagsOp -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolDepositOp -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolWithdrawOp -> {
+        size += value.encodedSize()
+      }
+      is InvokeHostFunctionOp -> {
+        size += value.encodedSize()
+      }
+      is ExtendFootprintTTLOp -> {
+        size += value.encodedSize()
+      }
+      is RestoreFootprintOp -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -27,6 +27,12 @@ data class OperationMetaV2Xdr(
       val events = List(reader.readInt()) { ContractEventXdr.decode(reader) }
       return OperationMetaV2Xdr(ext, changes, events)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+      repeat(reader.readInt()) { ContractEventXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -37,4 +43,15 @@ data class OperationMetaV2Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += changes.encodedSize()
+    size += 4
+    events.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class OperationMetaXdr(
       val changes = LedgerEntryChangesXdr.decode(reader)
       return OperationMetaXdr(changes)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerEntryChangesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     changes.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += changes.encodedSize()
+    return size
+  }
 }
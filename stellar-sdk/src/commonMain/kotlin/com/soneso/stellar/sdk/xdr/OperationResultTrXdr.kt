@@ -344,6 +344,40 @@ sealed class OperationResultTrXdr {
         else -> throw IllegalArgumentException("Unknown OperationResultTrXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = OperationTypeXdr.decode(reader)
+      when (discriminant) {
+        OperationTypeXdr.CREATE_ACCOUNT -> CreateAccountResultXdr.skip(reader)
+        OperationTypeXdr.PAYMENT -> PaymentResultXdr.skip(reader)
+        OperationTypeXdr.PATH_PAYMENT_STRICT_RECEIVE -> PathPaymentStrictReceiveResultXdr.skip(reader)
+        OperationTypeXdr.MANAGE_SELL_OFFER -> ManageSellOfferResultXdr.skip(reader)
+        OperationTypeXdr.CREATE_PASSIVE_SELL_OFFER -> ManageSellOfferResultXdr.skip(reader)
+        OperationTypeXdr.SET_OPTIONS -> SetOptionsResultXdr.skip(reader)
+        OperationTypeXdr.CHANGE_TRUST -> ChangeTrustResultXdr.skip(reader)
+        OperationTypeXdr.ALLOW_TRUST -> AllowTrustResultXdr.skip(reader)
+        OperationTypeXdr.ACCOUNT_MERGE -> AccountMergeResultXdr.skip(reader)
+        OperationTypeXdr.INFLATION -> InflationResultXdr.skip(reader)
+        OperationTypeXdr.MANAGE_DATA -> ManageDataResultXdr.skip(reader)
+        OperationTypeXdr.BUMP_SEQUENCE -> BumpSequenceResultXdr.skip(reader)
+        OperationTypeXdr.MANAGE_BUY_OFFER -> ManageBuyOfferResultXdr.skip(reader)
+        OperationTypeXdr.PATH_PAYMENT_STRICT_SEND -> PathPaymentStrictSendResultXdr.skip(reader)
+        OperationTypeXdr.CREATE_CLAIMABLE_BALANCE -> CreateClaimableBalanceResultXdr.skip(reader)
+        OperationTypeXdr.CLAIM_CLAIMABLE_BALANCE -> ClaimClaimableBalanceResultXdr.skip(reader)
+        OperationTypeXdr.BEGIN_SPONSORING_FUTURE_RESERVES -> BeginSponsoringFutureReservesResultXdr.skip(reader)
+        OperationTypeXdr.END_SPONSORING_FUTURE_RESERVES -> EndSponsoringFutureReservesResultXdr.skip(reader)
+        OperationTypeXdr.REVOKE_SPONSORSHIP -> RevokeSponsorshipResultXdr.skip(reader)
+        OperationTypeXdr.CLAWBACK -> ClawbackResultXdr.skip(reader)
+        OperationTypeXdr.CLAWBACK_CLAIMABLE_BALANCE -> ClawbackClaimableBalanceResultXdr.skip(reader)
+        OperationTypeXdr.SET_TRUST_LINE_FLAGS -> SetTrustLineFlagsResultXdr.skip(reader)
+        OperationTypeXdr.LIQUIDITY_POOL_DEPOSIT -> LiquidityPoolDepositResultXdr.skip(reader)
+        OperationTypeXdr.LIQUIDITY_POOL_WITHDRAW -> LiquidityPoolWithdrawResultXdr.skip(reader)
+        OperationTypeXdr.INVOKE_HOST_FUNCTION -> InvokeHostFunctionResultXdr.skip(reader)
+        OperationTypeXdr.EXTEND_FOOTPRINT_TTL -> ExtendFootprintTTLResultXdr.skip(reader)
+        OperationTypeXdr.RESTORE_FOOTPRINT -> RestoreFootprintResultXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown OperationResultTrXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -432,4 +466,93 @@ sealed class OperationResultTrXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is CreateAccountResult -> {
+        size += value.encodedSize()
+      }
+      is PaymentResult -> {
+        size += value.encodedSize()
+      }
+      is PathPaymentStrictReceiveResult -> {
+        size += value.encodedSize()
+      }
+      is ManageSellOfferResult -> {
+        size += value.encodedSize()
+      }
+      is CreatePassiveSellOfferResult -> {
+        size += value.encodedSize()
+      }
+      is SetOptionsResult -> {
+        size += value.encodedSize()
+      }
+      is ChangeTrustResult -> {
+        size += value.encodedSize()
+      }
+      is AllowTrustResult -> {
+        size += value.encodedSize()
+      }
+      is AccountMergeResult -> {
+        size += value.encodedSize()
+      }
+      is InflationResult -> {
+        size += value.encodedSize()
+      }
+      is ManageDataResult -> {
+        size += value.encodedSize()
+      }
+      is BumpSeqResult -> {
+        size += value.encodedSize()
+      }
+      is ManageBuyOfferResult -> {
+        size += value.encodedSize()
+      }
+      is PathPaymentStrictSendResult -> {
+        size += value.encodedSize()
+      }
+      is CreateClaimableBalanceResult -> {
+        size += value.encodedSize()
+      }
+      is ClaimClaimableBalanceResult -> {
+        size += value.encodedSize()
+      }
+      is BeginSponsoringFutureReservesResult -> {
+        size += value.encodedSize()
+      }
+      is EndSponsoringFutureReservesResult -> {
+        size += value.encodedSize()
+      }
+      is RevokeSponsorshipResult -> {
+        size += value.encodedSize()
+      }
+      is ClawbackResult -> {
+        size += value.encodedSize()
+      }
+      is ClawbackClaimableBalanceResult -> {
+        size += value.encodedSize()
+      }
+      is SetTrustLineFlagsResult -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolDepositResult -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolWithdrawResult -> {
+        size += value.encodedSize()
+      }
+      is InvokeHostFunctionResult -> {
+        size += value.encodedSize()
+      }
+      is ExtendFootprintTTLResult -> {
+        size += value.encodedSize()
+      }
+      is RestoreFootprintResult -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -106,6 +106,20 @@ sealed class OperationResultXdr {
         else -> throw IllegalArgumentException("Unknown OperationResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = OperationResultCodeXdr.decode(reader)
+      when (discriminant) {
+        OperationResultCodeXdr.opINNER -> OperationResultTrXdr.skip(reader)
+        OperationResultCodeXdr.opBAD_AUTH -> {}
+        OperationResultCodeXdr.opNO_ACCOUNT -> {}
+        OperationResultCodeXdr.opNOT_SUPPORTED -> {}
+        OperationResultCodeXdr.opTOO_MANY_SUBENTRIES -> {}
+        OperationResultCodeXdr.opEXCEEDED_WORK_LIMIT -> {}
+        OperationResultCodeXdr.opTOO_MANY_SPONSORING -> {}
+        else -> throw IllegalArgumentException("Unknown OperationResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -117,4 +131,16 @@ sealed class OperationResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Tr -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -88,6 +88,11 @@ data class OperationXdr(
       val body = OperationBodyXdr.decode(reader)
       return OperationXdr(sourceAccount, body)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) MuxedAccountXdr.skip(reader)
+      OperationBodyXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -99,4 +104,16 @@ data class OperationXdr(
     }
     body.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (sourceAccount != null) {
+      size += 4
+      size += sourceAccount.encodedSize()
+    } else {
+      size += 4
+    }
+    size += body.encodedSize()
+    return size
+  }
 }
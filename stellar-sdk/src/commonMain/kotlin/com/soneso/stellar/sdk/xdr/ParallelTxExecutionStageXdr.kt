@@ -15,6 +15,10 @@ value class ParallelTxExecutionStageXdr(val value: List<DependentTxClusterXdr>)
       val value = List(reader.readInt()) { DependentTxClusterXdr.decode(reader) }
       return ParallelTxExecutionStageXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { DependentTxClusterXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class ParallelTxExecutionStageXdr(val value: List<DependentTxClusterXdr>)
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
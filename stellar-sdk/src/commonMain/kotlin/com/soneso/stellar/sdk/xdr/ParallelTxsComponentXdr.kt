@@ -25,6 +25,11 @@ data class ParallelTxsComponentXdr(
       val executionStages = List(reader.readInt()) { ParallelTxExecutionStageXdr.decode(reader) }
       return ParallelTxsComponentXdr(baseFee, executionStages)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) Int64Xdr.skip(reader)
+      repeat(reader.readInt()) { ParallelTxExecutionStageXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +44,19 @@ data class ParallelTxsComponentXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (baseFee != null) {
+      size += 4
+      size += baseFee.encodedSize()
+    } else {
+      size += 4
+    }
+    size += 4
+    executionStages.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
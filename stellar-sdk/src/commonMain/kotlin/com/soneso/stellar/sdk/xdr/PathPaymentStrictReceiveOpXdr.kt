@@ -47,6 +47,15 @@ data class PathPaymentStrictReceiveOpXdr(
       val path = List(reader.readInt()) { AssetXdr.decode(reader) }
       return PathPaymentStrictReceiveOpXdr(sendAsset, sendMax, destination, destAsset, destAmount, path)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      MuxedAccountXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      repeat(reader.readInt()) { AssetXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -60,4 +69,18 @@ data class PathPaymentStrictReceiveOpXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sendAsset.encodedSize()
+    size += sendMax.encodedSize()
+    size += destination.encodedSize()
+    size += destAsset.encodedSize()
+    size += destAmount.encodedSize()
+    size += 4
+    path.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -77,6 +77,26 @@ sealed class PathPaymentStrictReceiveResultXdr {
         else -> throw IllegalArgumentException("Unknown PathPaymentStrictReceiveResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = PathPaymentStrictReceiveResultCodeXdr.decode(reader)
+      when (discriminant) {
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_SUCCESS -> PathPaymentStrictReceiveResultSuccessXdr.skip(reader)
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_MALFORMED -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_UNDERFUNDED -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_SRC_NO_TRUST -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_SRC_NOT_AUTHORIZED -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_NO_DESTINATION -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_NO_TRUST -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_NOT_AUTHORIZED -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_LINE_FULL -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_NO_ISSUER -> AssetXdr.skip(reader)
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_TOO_FEW_OFFERS -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_OFFER_CROSS_SELF -> {}
+        PathPaymentStrictReceiveResultCodeXdr.PATH_PAYMENT_STRICT_RECEIVE_OVER_SENDMAX -> {}
+        else -> throw IllegalArgumentException("Unknown PathPaymentStrictReceiveResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -91,4 +111,19 @@ sealed class PathPaymentStrictReceiveResultXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Success -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+      is NoIssuer -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
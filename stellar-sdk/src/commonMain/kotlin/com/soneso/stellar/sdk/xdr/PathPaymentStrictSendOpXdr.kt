@@ -43,6 +43,15 @@ data class PathPaymentStrictSendOpXdr(
       val path = List(reader.readInt()) { AssetXdr.decode(reader) }
       return PathPaymentStrictSendOpXdr(sendAsset, sendAmount, destination, destAsset, destMin, path)
     }
+
+    fun skip(reader: XdrReader) {
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      MuxedAccountXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      repeat(reader.readInt()) { AssetXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -56,4 +65,18 @@ data class PathPaymentStrictSendOpXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sendAsset.encodedSize()
+    size += sendAmount.encodedSize()
+    size += destination.encodedSize()
+    size += destAsset.encodedSize()
+    size += destMin.encodedSize()
+    size += 4
+    path.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class PathPaymentStrictSendResultSuccessXdr(
       val last = SimplePaymentResultXdr.decode(reader)
       return PathPaymentStrictSendResultSuccessXdr(offers, last)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { ClaimAtomXdr.skip(reader) }
+      SimplePaymentResultXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class PathPaymentStrictSendResultSuccessXdr(
     }
     last.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    offers.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += last.encodedSize()
+    return size
+  }
 }
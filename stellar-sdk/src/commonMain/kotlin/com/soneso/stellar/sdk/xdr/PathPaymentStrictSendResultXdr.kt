@@ -76,6 +76,26 @@ sealed class PathPaymentStrictSendResultXdr {
         else -> throw IllegalArgumentException("Unknown PathPaymentStrictSendResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = PathPaymentStrictSendResultCodeXdr.decode(reader)
+      when (discriminant) {
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_SUCCESS -> PathPaymentStrictSendResultSuccessXdr.skip(reader)
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_MALFORMED -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_UNDERFUNDED -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_SRC_NO_TRUST -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_SRC_NOT_AUTHORIZED -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_NO_DESTINATION -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_NO_TRUST -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_NOT_AUTHORIZED -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_LINE_FULL -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_NO_ISSUER -> AssetXdr.skip(reader)
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_TOO_FEW_OFFERS -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_OFFER_CROSS_SELF -> {}
+        PathPaymentStrictSendResultCodeXdr.PATH_PAYMENT_STRICT_SEND_UNDER_DESTMIN -> {}
+        else -> throw IllegalArgumentException("Unknown PathPaymentStrictSendResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -90,4 +110,19 @@ sealed class PathPaymentStrictSendResultXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Success -> {
+        size += value.encodedSize()
+      }
+      is Void -> {}
+      is NoIssuer -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -28,6 +28,12 @@ data class PaymentOpXdr(
       val amount = Int64Xdr.decode(reader)
       return PaymentOpXdr(destination, asset, amount)
     }
+
+    fun skip(reader: XdrReader) {
+      MuxedAccountXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +41,12 @@ data class PaymentOpXdr(
     asset.encode(writer)
     amount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += destination.encodedSize()
+    size += asset.encodedSize()
+    size += amount.encodedSize()
+    return size
+  }
 }
@@ -46,6 +46,23 @@ sealed class PaymentResultXdr {
         else -> throw IllegalArgumentException("Unknown PaymentResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = PaymentResultCodeXdr.decode(reader)
+      when (discriminant) {
+        PaymentResultCodeXdr.PAYMENT_SUCCESS -> {}
+        PaymentResultCodeXdr.PAYMENT_MALFORMED -> {}
+        PaymentResultCodeXdr.PAYMENT_UNDERFUNDED -> {}
+        PaymentResultCodeXdr.PAYMENT_SRC_NO_TRUST -> {}
+        PaymentResultCodeXdr.PAYMENT_SRC_NOT_AUTHORIZED -> {}
+        PaymentResultCodeXdr.PAYMENT_NO_DESTINATION -> {}
+        PaymentResultCodeXdr.PAYMENT_NO_TRUST -> {}
+        PaymentResultCodeXdr.PAYMENT_NOT_AUTHORIZED -> {}
+        PaymentResultCodeXdr.PAYMENT_LINE_FULL -> {}
+        PaymentResultCodeXdr.PAYMENT_NO_ISSUER -> {}
+        else -> throw IllegalArgumentException("Unknown PaymentResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -54,4 +71,13 @@ sealed class PaymentResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -15,9 +15,25 @@ value class PoolIDXdr(val value: HashXdr) {
       val value = HashXdr.decode(reader)
       return PoolIDXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += value.encodedSize()
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun PoolIDXdr?.contentEquals(other: PoolIDXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun PoolIDXdr?.contentHashCode(): Int = this?.value.contentHashCode()
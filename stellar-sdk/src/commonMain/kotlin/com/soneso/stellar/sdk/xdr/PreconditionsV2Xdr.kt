@@ -79,6 +79,15 @@ data class PreconditionsV2Xdr(
       val extraSigners = List(reader.readInt()) { SignerKeyXdr.decode(reader) }
       return PreconditionsV2Xdr(timeBounds, ledgerBounds, minSeqNum, minSeqAge, minSeqLedgerGap, extraSigners)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) TimeBoundsXdr.skip(reader)
+      if (reader.readBoolean()) LedgerBoundsXdr.skip(reader)
+      if (reader.readBoolean()) SequenceNumberXdr.skip(reader)
+      DurationXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      repeat(reader.readInt()) { SignerKeyXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -107,4 +116,33 @@ data class PreconditionsV2Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (timeBounds != null) {
+      size += 4
+      size += timeBounds.encodedSize()
+    } else {
+      size += 4
+    }
+    if (ledgerBounds != null) {
+      size += 4
+      size += ledgerBounds.encodedSize()
+    } else {
+      size += 4
+    }
+    if (minSeqNum != null) {
+      size += 4
+      size += minSeqNum.encodedSize()
+    } else {
+      size += 4
+    }
+    size += minSeqAge.encodedSize()
+    size += minSeqLedgerGap.encodedSize()
+    size += 4
+    extraSigners.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
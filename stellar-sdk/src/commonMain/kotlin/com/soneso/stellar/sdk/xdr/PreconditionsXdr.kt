@@ -51,6 +51,16 @@ sealed class PreconditionsXdr {
         else -> throw IllegalArgumentException("Unknown PreconditionsXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = PreconditionTypeXdr.decode(reader)
+      when (discriminant) {
+        PreconditionTypeXdr.PRECOND_NONE -> {}
+        PreconditionTypeXdr.PRECOND_TIME -> TimeBoundsXdr.skip(reader)
+        PreconditionTypeXdr.PRECOND_V2 -> PreconditionsV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown PreconditionsXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -65,4 +75,19 @@ sealed class PreconditionsXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is TimeBounds -> {
+        size += value.encodedSize()
+      }
+      is V2 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
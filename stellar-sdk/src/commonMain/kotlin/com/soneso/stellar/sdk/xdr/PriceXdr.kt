@@ -24,10 +24,22 @@ data class PriceXdr(
       val d = Int32Xdr.decode(reader)
       return PriceXdr(n, d)
     }
+
+    fun skip(reader: XdrReader) {
+      Int32Xdr.skip(reader)
+      Int32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     n.encode(writer)
     d.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += n.encodedSize()
+    size += d.encodedSize()
+    return size
+  }
 }
@@ -18,6 +18,14 @@ sealed class PublicKeyXdr {
     val value: Uint256Xdr
   ) : PublicKeyXdr() {
     override val discriminant: PublicKeyTypeXdr = PublicKeyTypeXdr.PUBLIC_KEY_TYPE_ED25519
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Ed25519) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   companion object {
@@ -32,6 +40,14 @@ sealed class PublicKeyXdr {
         else -> throw IllegalArgumentException("Unknown PublicKeyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = PublicKeyTypeXdr.decode(reader)
+      when (discriminant) {
+        PublicKeyTypeXdr.PUBLIC_KEY_TYPE_ED25519 -> Uint256Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown PublicKeyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +58,15 @@ sealed class PublicKeyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Ed25519 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
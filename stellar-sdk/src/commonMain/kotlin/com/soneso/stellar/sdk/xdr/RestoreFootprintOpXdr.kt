@@ -19,9 +19,19 @@ data class RestoreFootprintOpXdr(
       val ext = ExtensionPointXdr.decode(reader)
       return RestoreFootprintOpXdr(ext)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -34,6 +34,17 @@ sealed class RestoreFootprintResultXdr {
         else -> throw IllegalArgumentException("Unknown RestoreFootprintResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = RestoreFootprintResultCodeXdr.decode(reader)
+      when (discriminant) {
+        RestoreFootprintResultCodeXdr.RESTORE_FOOTPRINT_SUCCESS -> {}
+        RestoreFootprintResultCodeXdr.RESTORE_FOOTPRINT_MALFORMED -> {}
+        RestoreFootprintResultCodeXdr.RESTORE_FOOTPRINT_RESOURCE_LIMIT_EXCEEDED -> {}
+        RestoreFootprintResultCodeXdr.RESTORE_FOOTPRINT_INSUFFICIENT_REFUNDABLE_FEE -> {}
+        else -> throw IllegalArgumentException("Unknown RestoreFootprintResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +53,13 @@ sealed class RestoreFootprintResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
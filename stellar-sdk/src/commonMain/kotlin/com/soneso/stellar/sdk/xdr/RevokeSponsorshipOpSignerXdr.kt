@@ -22,10 +22,22 @@ data class RevokeSponsorshipOpSignerXdr(
       val signerKey = SignerKeyXdr.decode(reader)
       return RevokeSponsorshipOpSignerXdr(accountId, signerKey)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      SignerKeyXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     accountId.encode(writer)
     signerKey.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += signerKey.encodedSize()
+    return size
+  }
 }
@@ -48,6 +48,15 @@ sealed class RevokeSponsorshipOpXdr {
         else -> throw IllegalArgumentException("Unknown RevokeSponsorshipOpXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = RevokeSponsorshipTypeXdr.decode(reader)
+      when (discriminant) {
+        RevokeSponsorshipTypeXdr.REVOKE_SPONSORSHIP_LEDGER_ENTRY -> LedgerKeyXdr.skip(reader)
+        RevokeSponsorshipTypeXdr.REVOKE_SPONSORSHIP_SIGNER -> RevokeSponsorshipOpSignerXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown RevokeSponsorshipOpXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -61,4 +70,18 @@ sealed class RevokeSponsorshipOpXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is LedgerKey -> {
+        size += value.encodedSize()
+      }
+      is Signer -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
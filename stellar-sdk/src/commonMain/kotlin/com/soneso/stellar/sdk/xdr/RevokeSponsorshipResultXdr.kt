@@ -38,6 +38,19 @@ sealed class RevokeSponsorshipResultXdr {
         else -> throw IllegalArgumentException("Unknown RevokeSponsorshipResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = RevokeSponsorshipResultCodeXdr.decode(reader)
+      when (discriminant) {
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_SUCCESS -> {}
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_DOES_NOT_EXIST -> {}
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_NOT_SPONSOR -> {}
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_LOW_RESERVE -> {}
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_ONLY_TRANSFERABLE -> {}
+        RevokeSponsorshipResultCodeXdr.REVOKE_SPONSORSHIP_MALFORMED -> {}
+        else -> throw IllegalArgumentException("Unknown RevokeSponsorshipResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +59,13 @@ sealed class RevokeSponsorshipResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -26,30 +26,95 @@ sealed class SCAddressXdr {
     val value: AccountIDXdr
   ) : SCAddressXdr() {
     override val discriminant: SCAddressTypeXdr = SCAddressTypeXdr.SC_ADDRESS_TYPE_ACCOUNT
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is AccountId || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ContractId(
     val value: ContractIDXdr
   ) : SCAddressXdr() {
     override val discriminant: SCAddressTypeXdr = SCAddressTypeXdr.SC_ADDRESS_TYPE_CONTRACT
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ContractId || hashCode() != other.hashCode()) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.contentHashCode()
+      return cachedHashCode
+    }
   }
 
   data class MuxedAccount(
     val value: MuxedEd25519AccountXdr
   ) : SCAddressXdr() {
     override val discriminant: SCAddressTypeXdr = SCAddressTypeXdr.SC_ADDRESS_TYPE_MUXED_ACCOUNT
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is MuxedAccount || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class ClaimableBalanceId(
     val value: ClaimableBalanceIDXdr
   ) : SCAddressXdr() {
     override val discriminant: SCAddressTypeXdr = SCAddressTypeXdr.SC_ADDRESS_TYPE_CLAIMABLE_BALANCE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is ClaimableBalanceId || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class LiquidityPoolId(
     val value: PoolIDXdr
   ) : SCAddressXdr() {
     override val discriminant: SCAddressTypeXdr = SCAddressTypeXdr.SC_ADDRESS_TYPE_LIQUIDITY_POOL
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is LiquidityPoolId || hashCode() != other.hashCode()) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.contentHashCode()
+      return cachedHashCode
+    }
   }
 
   companion object {
@@ -80,6 +145,18 @@ sealed class SCAddressXdr {
         else -> throw IllegalArgumentException("Unknown SCAddressXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCAddressTypeXdr.decode(reader)
+      when (discriminant) {
+        SCAddressTypeXdr.SC_ADDRESS_TYPE_ACCOUNT -> AccountIDXdr.skip(reader)
+        SCAddressTypeXdr.SC_ADDRESS_TYPE_CONTRACT -> ContractIDXdr.skip(reader)
+        SCAddressTypeXdr.SC_ADDRESS_TYPE_MUXED_ACCOUNT -> MuxedEd25519AccountXdr.skip(reader)
+        SCAddressTypeXdr.SC_ADDRESS_TYPE_CLAIMABLE_BALANCE -> ClaimableBalanceIDXdr.skip(reader)
+        SCAddressTypeXdr.SC_ADDRESS_TYPE_LIQUIDITY_POOL -> PoolIDXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCAddressXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -102,4 +179,27 @@ sealed class SCAddressXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is AccountId -> {
+        size += value.encodedSize()
+      }
+      is ContractId -> {
+        size += value.encodedSize()
+      }
+      is MuxedAccount -> {
+        size += value.encodedSize()
+      }
+      is ClaimableBalanceId -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolId -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
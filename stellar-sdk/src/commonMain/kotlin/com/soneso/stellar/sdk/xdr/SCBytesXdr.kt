@@ -15,9 +15,25 @@ value class SCBytesXdr(val value: ByteArray) {
       val value = reader.readVariableOpaque()
       return SCBytesXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeVariableOpaque(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrVariableOpaqueSize(value)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun SCBytesXdr?.contentEquals(other: SCBytesXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun SCBytesXdr?.contentHashCode(): Int = this?.value.contentHashCode()
@@ -21,6 +21,11 @@ data class SCContractInstanceXdr(
       val storage = if (reader.readBoolean()) SCMapXdr.decode(reader) else null
       return SCContractInstanceXdr(executable, storage)
     }
+
+    fun skip(reader: XdrReader) {
+      ContractExecutableXdr.skip(reader)
+      if (reader.readBoolean()) SCMapXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +37,16 @@ data class SCContractInstanceXdr(
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += executable.encodedSize()
+    if (storage != null) {
+      size += 4
+      size += storage.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
 }
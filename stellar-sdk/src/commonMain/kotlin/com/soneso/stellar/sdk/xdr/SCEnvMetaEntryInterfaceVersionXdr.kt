@@ -21,10 +21,22 @@ data class SCEnvMetaEntryInterfaceVersionXdr(
       val preRelease = Uint32Xdr.decode(reader)
       return SCEnvMetaEntryInterfaceVersionXdr(protocol, preRelease)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     protocol.encode(writer)
     preRelease.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += protocol.encodedSize()
+    size += preRelease.encodedSize()
+    return size
+  }
 }
@@ -35,6 +35,14 @@ sealed class SCEnvMetaEntryXdr {
         else -> throw IllegalArgumentException("Unknown SCEnvMetaEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCEnvMetaKindXdr.decode(reader)
+      when (discriminant) {
+        SCEnvMetaKindXdr.SC_ENV_META_KIND_INTERFACE_VERSION -> SCEnvMetaEntryInterfaceVersionXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCEnvMetaEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -45,4 +53,15 @@ sealed class SCEnvMetaEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is InterfaceVersion -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
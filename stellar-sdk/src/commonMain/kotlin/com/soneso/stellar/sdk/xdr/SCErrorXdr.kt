@@ -31,10 +31,9 @@ sealed class SCErrorXdr {
   }
 
   data class Code(
-    val value: SCErrorCodeXdr
-  ) : SCErrorXdr() {
+    val value: SCErrorCodeXdr,
     override val discriminant: SCErrorTypeXdr = SCErrorTypeXdr.SCE_WASM_VM
-  }
+  ) : SCErrorXdr()
 
   companion object {
 
@@ -47,43 +46,60 @@ sealed class SCErrorXdr {
         }
         SCErrorTypeXdr.SCE_WASM_VM -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_CONTEXT -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_STORAGE -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_OBJECT -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_CRYPTO -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_EVENTS -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_BUDGET -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_VALUE -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         SCErrorTypeXdr.SCE_AUTH -> {
           val value = SCErrorCodeXdr.decode(reader)
-          Code(value)
+          Code(value, discriminant)
         }
         else -> throw IllegalArgumentException("Unknown SCErrorXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCErrorTypeXdr.decode(reader)
+      when (discriminant) {
+        SCErrorTypeXdr.SCE_CONTRACT -> Uint32Xdr.skip(reader)
+        SCErrorTypeXdr.SCE_WASM_VM -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_CONTEXT -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_STORAGE -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_OBJECT -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_CRYPTO -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_EVENTS -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_BUDGET -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_VALUE -> SCErrorCodeXdr.skip(reader)
+        SCErrorTypeXdr.SCE_AUTH -> SCErrorCodeXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCErrorXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -97,4 +113,18 @@ sealed class SCErrorXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ContractCode -> {
+        size += value.encodedSize()
+      }
+      is Code -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class SCMapEntryXdr(
       val value = SCValXdr.decode(reader)
       return SCMapEntryXdr(key, value)
     }
+
+    fun skip(reader: XdrReader) {
+      SCValXdr.skip(reader)
+      SCValXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     key.encode(writer)
     `val`.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += key.encodedSize()
+    size += `val`.encodedSize()
+    return size
+  }
 }
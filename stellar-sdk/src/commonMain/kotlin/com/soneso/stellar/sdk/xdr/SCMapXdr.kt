@@ -15,6 +15,10 @@ value class SCMapXdr(val value: List<SCMapEntryXdr>) {
       val value = List(reader.readInt()) { SCMapEntryXdr.decode(reader) }
       return SCMapXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SCMapEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class SCMapXdr(val value: List<SCMapEntryXdr>) {
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
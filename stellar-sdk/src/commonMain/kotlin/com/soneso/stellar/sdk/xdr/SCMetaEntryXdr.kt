@@ -32,6 +32,14 @@ sealed class SCMetaEntryXdr {
         else -> throw IllegalArgumentException("Unknown SCMetaEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCMetaKindXdr.decode(reader)
+      when (discriminant) {
+        SCMetaKindXdr.SC_META_V0 -> SCMetaV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCMetaEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +50,15 @@ sealed class SCMetaEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
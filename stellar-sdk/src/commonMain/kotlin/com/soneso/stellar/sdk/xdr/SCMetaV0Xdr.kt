@@ -22,10 +22,22 @@ data class SCMetaV0Xdr(
       val value = reader.readString()
       return SCMetaV0Xdr(key, value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeString(key)
     writer.writeString(`val`)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(key)
+    size += xdrStringSize(`val`)
+    return size
+  }
 }
@@ -18,9 +18,19 @@ data class SCNonceKeyXdr(
       val nonce = Int64Xdr.decode(reader)
       return SCNonceKeyXdr(nonce)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     nonce.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += nonce.encodedSize()
+    return size
+  }
 }
@@ -24,10 +24,35 @@ data class SCPBallotXdr(
       val value = ValueXdr.decode(reader)
       return SCPBallotXdr(counter, value)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      ValueXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     counter.encode(writer)
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += counter.encodedSize()
+    size += value.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPBallotXdr) return false
+    return counter == other.counter &&
+      value.contentEquals(other.value)
+  }
+
+  override fun hashCode(): Int {
+    var result = counter.hashCode()
+    result = 31 * result + value.contentHashCode()
+    return result
+  }
 }
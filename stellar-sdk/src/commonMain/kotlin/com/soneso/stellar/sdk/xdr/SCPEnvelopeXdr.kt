@@ -22,10 +22,35 @@ data class SCPEnvelopeXdr(
       val signature = SignatureXdr.decode(reader)
       return SCPEnvelopeXdr(statement, signature)
     }
+
+    fun skip(reader: XdrReader) {
+      SCPStatementXdr.skip(reader)
+      SignatureXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     statement.encode(writer)
     signature.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += statement.encodedSize()
+    size += signature.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPEnvelopeXdr) return false
+    return statement == other.statement &&
+      signature.contentEquals(other.signature)
+  }
+
+  override fun hashCode(): Int {
+    var result = statement.hashCode()
+    result = 31 * result + signature.contentHashCode()
+    return result
+  }
 }
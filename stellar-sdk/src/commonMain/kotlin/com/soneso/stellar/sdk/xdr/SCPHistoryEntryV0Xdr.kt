@@ -22,6 +22,11 @@ data class SCPHistoryEntryV0Xdr(
       val ledgerMessages = LedgerSCPMessagesXdr.decode(reader)
       return SCPHistoryEntryV0Xdr(quorumSets, ledgerMessages)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SCPQuorumSetXdr.skip(reader) }
+      LedgerSCPMessagesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class SCPHistoryEntryV0Xdr(
     }
     ledgerMessages.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    quorumSets.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ledgerMessages.encodedSize()
+    return size
+  }
 }
@@ -32,6 +32,14 @@ sealed class SCPHistoryEntryXdr {
         else -> throw IllegalArgumentException("Unknown SCPHistoryEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> SCPHistoryEntryV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCPHistoryEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +50,15 @@ sealed class SCPHistoryEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -26,6 +26,12 @@ data class SCPNominationXdr(
       val accepted = List(reader.readInt()) { ValueXdr.decode(reader) }
       return SCPNominationXdr(quorumSetHash, votes, accepted)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      repeat(reader.readInt()) { ValueXdr.skip(reader) }
+      repeat(reader.readInt()) { ValueXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +45,33 @@ data class SCPNominationXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += quorumSetHash.encodedSize()
+    size += 4
+    votes.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    accepted.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPNominationXdr) return false
+    return quorumSetHash.contentEquals(other.quorumSetHash) &&
+      votes.size == other.votes.size && votes.indices.all { votes[it].contentEquals(other.votes[it]) } &&
+      accepted.size == other.accepted.size && accepted.indices.all { accepted[it].contentEquals(other.accepted[it]) }
+  }
+
+  override fun hashCode(): Int {
+    var result = quorumSetHash.contentHashCode()
+    result = 31 * result + votes.fold(1) { hash, item -> 31 * hash + item.contentHashCode() }
+    result = 31 * result + accepted.fold(1) { hash, item -> 31 * hash + item.contentHashCode() }
+    return result
+  }
 }
@@ -25,6 +25,12 @@ data class SCPQuorumSetXdr(
       val innerSets = List(reader.readInt()) { SCPQuorumSetXdr.decode(reader) }
       return SCPQuorumSetXdr(threshold, validators, innerSets)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      repeat(reader.readInt()) { NodeIDXdr.skip(reader) }
+      repeat(reader.readInt()) { SCPQuorumSetXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -38,4 +44,18 @@ data class SCPQuorumSetXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += threshold.encodedSize()
+    size += 4
+    validators.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    innerSets.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
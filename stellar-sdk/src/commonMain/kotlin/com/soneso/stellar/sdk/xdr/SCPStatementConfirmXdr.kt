@@ -36,6 +36,14 @@ data class SCPStatementConfirmXdr(
       val quorumSetHash = HashXdr.decode(reader)
       return SCPStatementConfirmXdr(ballot, nPrepared, nCommit, nH, quorumSetHash)
     }
+
+    fun skip(reader: XdrReader) {
+      SCPBallotXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -45,4 +53,33 @@ data class SCPStatementConfirmXdr(
     nH.encode(writer)
     quorumSetHash.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ballot.encodedSize()
+    size += nPrepared.encodedSize()
+    size += nCommit.encodedSize()
+    size += nH.encodedSize()
+    size += quorumSetHash.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPStatementConfirmXdr) return false
+    return ballot == other.ballot &&
+      nPrepared == other.nPrepared &&
+      nCommit == other.nCommit &&
+      nH == other.nH &&
+      quorumSetHash.contentEquals(other.quorumSetHash)
+  }
+
+  override fun hashCode(): Int {
+    var result = ballot.hashCode()
+    result = 31 * result + nPrepared.hashCode()
+    result = 31 * result + nCommit.hashCode()
+    result = 31 * result + nH.hashCode()
+    result = 31 * result + quorumSetHash.contentHashCode()
+    return result
+  }
 }
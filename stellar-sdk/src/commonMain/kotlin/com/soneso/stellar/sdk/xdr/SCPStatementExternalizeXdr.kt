@@ -28,6 +28,12 @@ data class SCPStatementExternalizeXdr(
       val commitQuorumSetHash = HashXdr.decode(reader)
       return SCPStatementExternalizeXdr(commit, nH, commitQuorumSetHash)
     }
+
+    fun skip(reader: XdrReader) {
+      SCPBallotXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      HashXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +41,27 @@ data class SCPStatementExternalizeXdr(
     nH.encode(writer)
     commitQuorumSetHash.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += commit.encodedSize()
+    size += nH.encodedSize()
+    size += commitQuorumSetHash.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPStatementExternalizeXdr) return false
+    return commit == other.commit &&
+      nH == other.nH &&
+      commitQuorumSetHash.contentEquals(other.commitQuorumSetHash)
+  }
+
+  override fun hashCode(): Int {
+    var result = commit.hashCode()
+    result = 31 * result + nH.hashCode()
+    result = 31 * result + commitQuorumSetHash.contentHashCode()
+    return result
+  }
 }
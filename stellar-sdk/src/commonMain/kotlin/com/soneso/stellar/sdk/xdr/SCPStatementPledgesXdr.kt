@@ -88,6 +88,17 @@ sealed class SCPStatementPledgesXdr {
         else -> throw IllegalArgumentException("Unknown SCPStatementPledgesXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCPStatementTypeXdr.decode(reader)
+      when (discriminant) {
+        SCPStatementTypeXdr.SCP_ST_PREPARE -> SCPStatementPrepareXdr.skip(reader)
+        SCPStatementTypeXdr.SCP_ST_CONFIRM -> SCPStatementConfirmXdr.skip(reader)
+        SCPStatementTypeXdr.SCP_ST_EXTERNALIZE -> SCPStatementExternalizeXdr.skip(reader)
+        SCPStatementTypeXdr.SCP_ST_NOMINATE -> SCPNominationXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCPStatementPledgesXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -107,4 +118,24 @@ sealed class SCPStatementPledgesXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Prepare -> {
+        size += value.encodedSize()
+      }
+      is Confirm -> {
+        size += value.encodedSize()
+      }
+      is Externalize -> {
+        size += value.encodedSize()
+      }
+      is Nominate -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -40,6 +40,15 @@ data class SCPStatementPrepareXdr(
       val nH = Uint32Xdr.decode(reader)
       return SCPStatementPrepareXdr(quorumSetHash, ballot, prepared, preparedPrime, nC, nH)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      SCPBallotXdr.skip(reader)
+      if (reader.readBoolean()) SCPBallotXdr.skip(reader)
+      if (reader.readBoolean()) SCPBallotXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -60,4 +69,46 @@ data class SCPStatementPrepareXdr(
     nC.encode(writer)
     nH.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += quorumSetHash.encodedSize()
+    size += ballot.encodedSize()
+    if (prepared != null) {
+      size += 4
+      size += prepared.encodedSize()
+    } else {
+      size += 4
+    }
+    if (preparedPrime != null) {
+      size += 4
+      size += preparedPrime.encodedSize()
+    } else {
+      size += 4
+    }
+    size += nC.encodedSize()
+    size += nH.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SCPStatementPrepareXdr) return false
+    return quorumSetHash.contentEquals(other.quorumSetHash) &&
+      ballot == other.ballot &&
+      prepared == other.prepared &&
+      preparedPrime == other.preparedPrime &&
+      nC == other.nC &&
+      nH == other.nH
+  }
+
+  override fun hashCode(): Int {
+    var result = quorumSetHash.contentHashCode()
+    result = 31 * result + ballot.hashCode()
+    result = 31 * result + prepared.hashCode()
+    result = 31 * result + preparedPrime.hashCode()
+    result = 31 * result + nC.hashCode()
+    result = 31 * result + nH.hashCode()
+    return result
+  }
 }
@@ -59,6 +59,12 @@ data class SCPStatementXdr(
       val pledges = SCPStatementPledgesXdr.decode(reader)
       return SCPStatementXdr(nodeId, slotIndex, pledges)
     }
+
+    fun skip(reader: XdrReader) {
+      NodeIDXdr.skip(reader)
+      Uint64Xdr.skip(reader)
+      SCPStatementPledgesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -66,4 +72,12 @@ data class SCPStatementXdr(
     slotIndex.encode(writer)
     pledges.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += nodeId.encodedSize()
+    size += slotIndex.encodedSize()
+    size += pledges.encodedSize()
+    return size
+  }
 }
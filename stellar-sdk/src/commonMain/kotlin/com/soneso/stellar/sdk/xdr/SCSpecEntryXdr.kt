@@ -92,6 +92,19 @@ sealed class SCSpecEntryXdr {
         else -> throw IllegalArgumentException("Unknown SCSpecEntryXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCSpecEntryKindXdr.decode(reader)
+      when (discriminant) {
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_FUNCTION_V0 -> SCSpecFunctionV0Xdr.skip(reader)
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_UDT_STRUCT_V0 -> SCSpecUDTStructV0Xdr.skip(reader)
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_UDT_UNION_V0 -> SCSpecUDTUnionV0Xdr.skip(reader)
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_UDT_ENUM_V0 -> SCSpecUDTEnumV0Xdr.skip(reader)
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_UDT_ERROR_ENUM_V0 -> SCSpecUDTErrorEnumV0Xdr.skip(reader)
+        SCSpecEntryKindXdr.SC_SPEC_ENTRY_EVENT_V0 -> SCSpecEventV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCSpecEntryXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -117,4 +130,30 @@ sealed class SCSpecEntryXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is FunctionV0 -> {
+        size += value.encodedSize()
+      }
+      is UdtStructV0 -> {
+        size += value.encodedSize()
+      }
+      is UdtUnionV0 -> {
+        size += value.encodedSize()
+      }
+      is UdtEnumV0 -> {
+        size += value.encodedSize()
+      }
+      is UdtErrorEnumV0 -> {
+        size += value.encodedSize()
+      }
+      is EventV0 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
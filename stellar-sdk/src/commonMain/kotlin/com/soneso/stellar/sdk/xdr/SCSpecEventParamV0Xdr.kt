@@ -28,6 +28,13 @@ data class SCSpecEventParamV0Xdr(
       val location = SCSpecEventParamLocationV0Xdr.decode(reader)
       return SCSpecEventParamV0Xdr(doc, name, type, location)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      SCSpecTypeDefXdr.skip(reader)
+      SCSpecEventParamLocationV0Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -36,4 +43,13 @@ data class SCSpecEventParamV0Xdr(
     type.encode(writer)
     location.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(name)
+    size += type.encodedSize()
+    size += location.encodedSize()
+    return size
+  }
 }
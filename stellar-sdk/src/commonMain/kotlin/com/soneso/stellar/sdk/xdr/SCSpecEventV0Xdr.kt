@@ -34,6 +34,15 @@ data class SCSpecEventV0Xdr(
       val dataFormat = SCSpecEventDataFormatXdr.decode(reader)
       return SCSpecEventV0Xdr(doc, lib, name, prefixTopics, params, dataFormat)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      SCSymbolXdr.skip(reader)
+      repeat(reader.readInt()) { SCSymbolXdr.skip(reader) }
+      repeat(reader.readInt()) { SCSpecEventParamV0Xdr.skip(reader) }
+      SCSpecEventDataFormatXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,21 @@ data class SCSpecEventV0Xdr(
     }
     dataFormat.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(lib)
+    size += name.encodedSize()
+    size += 4
+    prefixTopics.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    params.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += dataFormat.encodedSize()
+    return size
+  }
 }
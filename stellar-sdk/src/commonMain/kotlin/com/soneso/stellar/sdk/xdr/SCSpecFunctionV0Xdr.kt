@@ -28,6 +28,13 @@ data class SCSpecFunctionV0Xdr(
       val outputs = List(reader.readInt()) { SCSpecTypeDefXdr.decode(reader) }
       return SCSpecFunctionV0Xdr(doc, name, inputs, outputs)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      SCSymbolXdr.skip(reader)
+      repeat(reader.readInt()) { SCSpecFunctionInputV0Xdr.skip(reader) }
+      repeat(reader.readInt()) { SCSpecTypeDefXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +49,19 @@ data class SCSpecFunctionV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += name.encodedSize()
+    size += 4
+    inputs.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    outputs.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class SCSpecTypeBytesNXdr(
       val n = Uint32Xdr.decode(reader)
       return SCSpecTypeBytesNXdr(n)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     n.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += n.encodedSize()
+    return size
+  }
 }
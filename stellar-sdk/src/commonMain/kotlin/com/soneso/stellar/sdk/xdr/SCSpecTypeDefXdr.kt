@@ -147,6 +147,39 @@ sealed class SCSpecTypeDefXdr {
         else -> throw IllegalArgumentException("Unknown SCSpecTypeDefXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCSpecTypeXdr.decode(reader)
+      when (discriminant) {
+        SCSpecTypeXdr.SC_SPEC_TYPE_VAL -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_BOOL -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_VOID -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_ERROR -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_U32 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_I32 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_U64 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_I64 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_TIMEPOINT -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_DURATION -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_U128 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_I128 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_U256 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_I256 -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_BYTES -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_STRING -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_SYMBOL -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_ADDRESS -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_MUXED_ADDRESS -> {}
+        SCSpecTypeXdr.SC_SPEC_TYPE_OPTION -> SCSpecTypeOptionXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_RESULT -> SCSpecTypeResultXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_VEC -> SCSpecTypeVecXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_MAP -> SCSpecTypeMapXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_TUPLE -> SCSpecTypeTupleXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_BYTES_N -> SCSpecTypeBytesNXdr.skip(reader)
+        SCSpecTypeXdr.SC_SPEC_TYPE_UDT -> SCSpecTypeUDTXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCSpecTypeDefXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -176,4 +209,34 @@ sealed class SCSpecTypeDefXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is Option -> {
+        size += value.encodedSize()
+      }
+      is Result -> {
+        size += value.encodedSize()
+      }
+      is Vec -> {
+        size += value.encodedSize()
+      }
+      is Map -> {
+        size += value.encodedSize()
+      }
+      is Tuple -> {
+        size += value.encodedSize()
+      }
+      is BytesN -> {
+        size += value.encodedSize()
+      }
+      is Udt -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
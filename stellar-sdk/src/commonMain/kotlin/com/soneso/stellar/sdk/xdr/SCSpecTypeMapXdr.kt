@@ -22,10 +22,22 @@ data class SCSpecTypeMapXdr(
       val valueType = SCSpecTypeDefXdr.decode(reader)
       return SCSpecTypeMapXdr(keyType, valueType)
     }
+
+    fun skip(reader: XdrReader) {
+      SCSpecTypeDefXdr.skip(reader)
+      SCSpecTypeDefXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     keyType.encode(writer)
     valueType.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += keyType.encodedSize()
+    size += valueType.encodedSize()
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class SCSpecTypeOptionXdr(
       val valueType = SCSpecTypeDefXdr.decode(reader)
       return SCSpecTypeOptionXdr(valueType)
     }
+
+    fun skip(reader: XdrReader) {
+      SCSpecTypeDefXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     valueType.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += valueType.encodedSize()
+    return size
+  }
 }
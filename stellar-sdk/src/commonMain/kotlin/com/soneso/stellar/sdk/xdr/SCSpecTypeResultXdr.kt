@@ -22,10 +22,22 @@ data class SCSpecTypeResultXdr(
       val errorType = SCSpecTypeDefXdr.decode(reader)
       return SCSpecTypeResultXdr(okType, errorType)
     }
+
+    fun skip(reader: XdrReader) {
+      SCSpecTypeDefXdr.skip(reader)
+      SCSpecTypeDefXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     okType.encode(writer)
     errorType.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += okType.encodedSize()
+    size += errorType.encodedSize()
+    return size
+  }
 }
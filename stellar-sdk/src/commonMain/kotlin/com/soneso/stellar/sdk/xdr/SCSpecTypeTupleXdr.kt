@@ -19,6 +19,10 @@ data class SCSpecTypeTupleXdr(
       val valueTypes = List(reader.readInt()) { SCSpecTypeDefXdr.decode(reader) }
       return SCSpecTypeTupleXdr(valueTypes)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SCSpecTypeDefXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -27,4 +31,13 @@ data class SCSpecTypeTupleXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    valueTypes.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class SCSpecTypeUDTXdr(
       val name = reader.readString()
       return SCSpecTypeUDTXdr(name)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeString(name)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(name)
+    return size
+  }
 }
@@ -19,9 +19,19 @@ data class SCSpecTypeVecXdr(
       val elementType = SCSpecTypeDefXdr.decode(reader)
       return SCSpecTypeVecXdr(elementType)
     }
+
+    fun skip(reader: XdrReader) {
+      SCSpecTypeDefXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     elementType.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += elementType.encodedSize()
+    return size
+  }
 }
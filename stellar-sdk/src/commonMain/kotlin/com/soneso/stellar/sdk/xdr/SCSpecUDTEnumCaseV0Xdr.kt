@@ -25,6 +25,12 @@ data class SCSpecUDTEnumCaseV0Xdr(
       val value = Uint32Xdr.decode(reader)
       return SCSpecUDTEnumCaseV0Xdr(doc, name, value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class SCSpecUDTEnumCaseV0Xdr(
     writer.writeString(name)
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(name)
+    size += value.encodedSize()
+    return size
+  }
 }
@@ -25,6 +25,12 @@ data class SCSpecUDTStructFieldV0Xdr(
       val type = SCSpecTypeDefXdr.decode(reader)
       return SCSpecUDTStructFieldV0Xdr(doc, name, type)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      SCSpecTypeDefXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class SCSpecUDTStructFieldV0Xdr(
     writer.writeString(name)
     type.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(name)
+    size += type.encodedSize()
+    return size
+  }
 }
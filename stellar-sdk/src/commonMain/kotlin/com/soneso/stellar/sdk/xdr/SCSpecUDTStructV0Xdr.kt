@@ -28,6 +28,13 @@ data class SCSpecUDTStructV0Xdr(
       val fields = List(reader.readInt()) { SCSpecUDTStructFieldV0Xdr.decode(reader) }
       return SCSpecUDTStructV0Xdr(doc, lib, name, fields)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      repeat(reader.readInt()) { SCSpecUDTStructFieldV0Xdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +46,16 @@ data class SCSpecUDTStructV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(lib)
+    size += xdrStringSize(name)
+    size += 4
+    fields.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -25,6 +25,12 @@ data class SCSpecUDTUnionCaseTupleV0Xdr(
       val type = List(reader.readInt()) { SCSpecTypeDefXdr.decode(reader) }
       return SCSpecUDTUnionCaseTupleV0Xdr(doc, name, type)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      repeat(reader.readInt()) { SCSpecTypeDefXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +41,15 @@ data class SCSpecUDTUnionCaseTupleV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(name)
+    size += 4
+    type.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
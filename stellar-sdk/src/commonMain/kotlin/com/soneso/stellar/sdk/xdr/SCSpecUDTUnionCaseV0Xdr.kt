@@ -44,6 +44,15 @@ sealed class SCSpecUDTUnionCaseV0Xdr {
         else -> throw IllegalArgumentException("Unknown SCSpecUDTUnionCaseV0Xdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCSpecUDTUnionCaseV0KindXdr.decode(reader)
+      when (discriminant) {
+        SCSpecUDTUnionCaseV0KindXdr.SC_SPEC_UDT_UNION_CASE_VOID_V0 -> SCSpecUDTUnionCaseVoidV0Xdr.skip(reader)
+        SCSpecUDTUnionCaseV0KindXdr.SC_SPEC_UDT_UNION_CASE_TUPLE_V0 -> SCSpecUDTUnionCaseTupleV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCSpecUDTUnionCaseV0Xdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -57,4 +66,18 @@ sealed class SCSpecUDTUnionCaseV0Xdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is VoidCase -> {
+        size += value.encodedSize()
+      }
+      is TupleCase -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
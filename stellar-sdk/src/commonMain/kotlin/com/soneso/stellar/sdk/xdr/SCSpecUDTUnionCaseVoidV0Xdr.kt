@@ -22,10 +22,22 @@ data class SCSpecUDTUnionCaseVoidV0Xdr(
       val name = reader.readString()
       return SCSpecUDTUnionCaseVoidV0Xdr(doc, name)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeString(doc)
     writer.writeString(name)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(name)
+    return size
+  }
 }
@@ -28,6 +28,13 @@ data class SCSpecUDTUnionV0Xdr(
       val cases = List(reader.readInt()) { SCSpecUDTUnionCaseV0Xdr.decode(reader) }
       return SCSpecUDTUnionV0Xdr(doc, lib, name, cases)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      reader.skipVariableOpaque()
+      repeat(reader.readInt()) { SCSpecUDTUnionCaseV0Xdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +46,16 @@ data class SCSpecUDTUnionV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(doc)
+    size += xdrStringSize(lib)
+    size += xdrStringSize(name)
+    size += 4
+    cases.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
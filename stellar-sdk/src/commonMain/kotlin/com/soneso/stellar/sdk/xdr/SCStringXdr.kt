@@ -15,9 +15,19 @@ value class SCStringXdr(val value: String) {
       val value = reader.readString()
       return SCStringXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeString(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrStringSize(value)
+    return size
+  }
 }
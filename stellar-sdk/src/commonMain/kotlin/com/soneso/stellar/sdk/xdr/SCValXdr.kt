@@ -73,90 +73,285 @@ sealed class SCValXdr {
     val value: Boolean
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_BOOL
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is B || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Error(
     val value: SCErrorXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_ERROR
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Error || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class U32(
     val value: Uint32Xdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_U32
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is U32 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class I32(
     val value: Int32Xdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_I32
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is I32 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class U64(
     val value: Uint64Xdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_U64
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is U64 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class I64(
     val value: Int64Xdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_I64
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is I64 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Timepoint(
     val value: TimePointXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_TIMEPOINT
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Timepoint || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Duration(
     val value: DurationXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_DURATION
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Duration || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class U128(
     val value: UInt128PartsXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_U128
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is U128 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class I128(
     val value: Int128PartsXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_I128
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is I128 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class U256(
     val value: UInt256PartsXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_U256
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is U256 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class I256(
     val value: Int256PartsXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_I256
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is I256 || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Bytes(
     val value: SCBytesXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_BYTES
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Bytes || hashCode() != other.hashCode()) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.contentHashCode()
+      return cachedHashCode
+    }
   }
 
   data class Str(
     val value: SCStringXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_STRING
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Str || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Sym(
     val value: SCSymbolXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_SYMBOL
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Sym || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   /**
@@ -167,18 +362,57 @@ sealed class SCValXdr {
     val value: SCVecXdr?
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_VEC
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Vec || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Map(
     val value: SCMapXdr?
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_MAP
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Map || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Address(
     val value: SCAddressXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_ADDRESS
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Address || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   /**
@@ -189,12 +423,38 @@ sealed class SCValXdr {
     val value: SCContractInstanceXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_CONTRACT_INSTANCE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Instance || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class NonceKey(
     val value: SCNonceKeyXdr
   ) : SCValXdr() {
     override val discriminant: SCValTypeXdr = SCValTypeXdr.SCV_LEDGER_KEY_NONCE
+
+    private var cachedHashCode = 0
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is NonceKey || hashCode() != other.hashCode()) return false
+      return value == other.value
+    }
+
+    override fun hashCode(): Int {
+      if (cachedHashCode == 0) cachedHashCode = value.hashCode()
+      return cachedHashCode
+    }
   }
 
   data class Void(
@@ -291,6 +551,35 @@ sealed class SCValXdr {
         else -> throw IllegalArgumentException("Unknown SCValXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SCValTypeXdr.decode(reader)
+      when (discriminant) {
+        SCValTypeXdr.SCV_BOOL -> reader.skip(4)
+        SCValTypeXdr.SCV_VOID -> {}
+        SCValTypeXdr.SCV_ERROR -> SCErrorXdr.skip(reader)
+        SCValTypeXdr.SCV_U32 -> Uint32Xdr.skip(reader)
+        SCValTypeXdr.SCV_I32 -> Int32Xdr.skip(reader)
+        SCValTypeXdr.SCV_U64 -> Uint64Xdr.skip(reader)
+        SCValTypeXdr.SCV_I64 -> Int64Xdr.skip(reader)
+        SCValTypeXdr.SCV_TIMEPOINT -> TimePointXdr.skip(reader)
+        SCValTypeXdr.SCV_DURATION -> DurationXdr.skip(reader)
+        SCValTypeXdr.SCV_U128 -> UInt128PartsXdr.skip(reader)
+        SCValTypeXdr.SCV_I128 -> Int128PartsXdr.skip(reader)
+        SCValTypeXdr.SCV_U256 -> UInt256PartsXdr.skip(reader)
+        SCValTypeXdr.SCV_I256 -> Int256PartsXdr.skip(reader)
+        SCValTypeXdr.SCV_BYTES -> SCBytesXdr.skip(reader)
+        SCValTypeXdr.SCV_STRING -> SCStringXdr.skip(reader)
+        SCValTypeXdr.SCV_SYMBOL -> SCSymbolXdr.skip(reader)
+        SCValTypeXdr.SCV_VEC -> if (reader.readBoolean()) SCVecXdr.skip(reader)
+        SCValTypeXdr.SCV_MAP -> if (reader.readBoolean()) SCMapXdr.skip(reader)
+        SCValTypeXdr.SCV_ADDRESS -> SCAddressXdr.skip(reader)
+        SCValTypeXdr.SCV_CONTRACT_INSTANCE -> SCContractInstanceXdr.skip(reader)
+        SCValTypeXdr.SCV_LEDGER_KEY_CONTRACT_INSTANCE -> {}
+        SCValTypeXdr.SCV_LEDGER_KEY_NONCE -> SCNonceKeyXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SCValXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -369,4 +658,83 @@ sealed class SCValXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is B -> {
+        size += 4
+      }
+      is Void -> {}
+      is Error -> {
+        size += value.encodedSize()
+      }
+      is U32 -> {
+        size += value.encodedSize()
+      }
+      is I32 -> {
+        size += value.encodedSize()
+      }
+      is U64 -> {
+        size += value.encodedSize()
+      }
+      is I64 -> {
+        size += value.encodedSize()
+      }
+      is Timepoint -> {
+        size += value.encodedSize()
+      }
+      is Duration -> {
+        size += value.encodedSize()
+      }
+      is U128 -> {
+        size += value.encodedSize()
+      }
+      is I128 -> {
+        size += value.encodedSize()
+      }
+      is U256 -> {
+        size += value.encodedSize()
+      }
+      is I256 -> {
+        size += value.encodedSize()
+      }
+      is Bytes -> {
+        size += value.encodedSize()
+      }
+      is Str -> {
+        size += value.encodedSize()
+      }
+      is Sym -> {
+        size += value.encodedSize()
+      }
+      is Vec -> {
+        if (value != null) {
+          size += 4
+          size += value.encodedSize()
+        } else {
+          size += 4
+        }
+      }
+      is Map -> {
+        if (value != null) {
+          size += 4
+          size += value.encodedSize()
+        } else {
+          size += 4
+        }
+      }
+      is Address -> {
+        size += value.encodedSize()
+      }
+      is Instance -> {
+        size += value.encodedSize()
+      }
+      is NonceKey -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -15,6 +15,10 @@ value class SCVecXdr(val value: List<SCValXdr>) {
       val value = List(reader.readInt()) { SCValXdr.decode(reader) }
       return SCVecXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SCValXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class SCVecXdr(val value: List<SCValXdr>) {
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -15,9 +15,19 @@ value class SequenceNumberXdr(val value: Int64Xdr) {
       val value = Int64Xdr.decode(reader)
       return SequenceNumberXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     value.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += value.encodedSize()
+    return size
+  }
 }
@@ -52,6 +52,18 @@ data class SerializedBinaryFuseFilterXdr(
       val fingerprints = reader.readVariableOpaque()
       return SerializedBinaryFuseFilterXdr(type, inputHashSeed, filterSeed, segmentLength, segementLengthMask, segmentCount, segmentCountLength, fingerprintLength, fingerprints)
     }
+
+    fun skip(reader: XdrReader) {
+      BinaryFuseFilterTypeXdr.skip(reader)
+      ShortHashSeedXdr.skip(reader)
+      ShortHashSeedXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -65,4 +77,45 @@ data class SerializedBinaryFuseFilterXdr(
     fingerprintLength.encode(writer)
     writer.writeVariableOpaque(fingerprints)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += type.encodedSize()
+    size += inputHashSeed.encodedSize()
+    size += filterSeed.encodedSize()
+    size += segmentLength.encodedSize()
+    size += segementLengthMask.encodedSize()
+    size += segmentCount.encodedSize()
+    size += segmentCountLength.encodedSize()
+    size += fingerprintLength.encodedSize()
+    size += xdrVariableOpaqueSize(fingerprints)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SerializedBinaryFuseFilterXdr) return false
+    return type == other.type &&
+      inputHashSeed == other.inputHashSeed &&
+      filterSeed == other.filterSeed &&
+      segmentLength == other.segmentLength &&
+      segementLengthMask == other.segementLengthMask &&
+      segmentCount == other.segmentCount &&
+      segmentCountLength == other.segmentCountLength &&
+      fingerprintLength == other.fingerprintLength &&
+      fingerprints.contentEquals(other.fingerprints)
+  }
+
+  override fun hashCode(): Int {
+    var result = type.hashCode()
+    result = 31 * result + inputHashSeed.hashCode()
+    result = 31 * result + filterSeed.hashCode()
+    result = 31 * result + segmentLength.hashCode()
+    result = 31 * result + segementLengthMask.hashCode()
+    result = 31 * result + segmentCount.hashCode()
+    result = 31 * result + segmentCountLength.hashCode()
+    result = 31 * result + fingerprintLength.hashCode()
+    result = 31 * result + fingerprints.contentHashCode()
+    return result
+  }
 }
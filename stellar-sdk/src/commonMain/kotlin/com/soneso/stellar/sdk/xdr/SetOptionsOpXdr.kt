@@ -62,6 +62,18 @@ data class SetOptionsOpXdr(
       val signer = if (reader.readBoolean()) SignerXdr.decode(reader) else null
       return SetOptionsOpXdr(inflationDest, clearFlags, setFlags, masterWeight, lowThreshold, medThreshold, highThreshold, homeDomain, signer)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) AccountIDXdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) Uint32Xdr.skip(reader)
+      if (reader.readBoolean()) String32Xdr.skip(reader)
+      if (reader.readBoolean()) SignerXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -120,4 +132,63 @@ data class SetOptionsOpXdr(
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (inflationDest != null) {
+      size += 4
+      size += inflationDest.encodedSize()
+    } else {
+      size += 4
+    }
+    if (clearFlags != null) {
+      size += 4
+      size += clearFlags.encodedSize()
+    } else {
+      size += 4
+    }
+    if (setFlags != null) {
+      size += 4
+      size += setFlags.encodedSize()
+    } else {
+      size += 4
+    }
+    if (masterWeight != null) {
+      size += 4
+      size += masterWeight.encodedSize()
+    } else {
+      size += 4
+    }
+    if (lowThreshold != null) {
+      size += 4
+      size += lowThreshold.encodedSize()
+    } else {
+      size += 4
+    }
+    if (medThreshold != null) {
+      size += 4
+      size += medThreshold.encodedSize()
+    } else {
+      size += 4
+    }
+    if (highThreshold != null) {
+      size += 4
+      size += highThreshold.encodedSize()
+    } else {
+      size += 4
+    }
+    if (homeDomain != null) {
+      size += 4
+      size += homeDomain.encodedSize()
+    } else {
+      size += 4
+    }
+    if (signer != null) {
+      size += 4
+      size += signer.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
 }
@@ -48,6 +48,24 @@ sealed class SetOptionsResultXdr {
         else -> throw IllegalArgumentException("Unknown SetOptionsResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SetOptionsResultCodeXdr.decode(reader)
+      when (discriminant) {
+        SetOptionsResultCodeXdr.SET_OPTIONS_SUCCESS -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_LOW_RESERVE -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_TOO_MANY_SIGNERS -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_BAD_FLAGS -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_INVALID_INFLATION -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_CANT_CHANGE -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_UNKNOWN_FLAG -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_THRESHOLD_OUT_OF_RANGE -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_BAD_SIGNER -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_INVALID_HOME_DOMAIN -> {}
+        SetOptionsResultCodeXdr.SET_OPTIONS_AUTH_REVOCABLE_REQUIRED -> {}
+        else -> throw IllegalArgumentException("Unknown SetOptionsResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -56,4 +74,13 @@ sealed class SetOptionsResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -31,6 +31,13 @@ data class SetTrustLineFlagsOpXdr(
       val setFlags = Uint32Xdr.decode(reader)
       return SetTrustLineFlagsOpXdr(trustor, asset, clearFlags, setFlags)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +46,13 @@ data class SetTrustLineFlagsOpXdr(
     clearFlags.encode(writer)
     setFlags.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += trustor.encodedSize()
+    size += asset.encodedSize()
+    size += clearFlags.encodedSize()
+    size += setFlags.encodedSize()
+    return size
+  }
 }
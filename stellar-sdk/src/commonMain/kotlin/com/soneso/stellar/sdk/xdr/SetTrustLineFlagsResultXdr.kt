@@ -38,6 +38,19 @@ sealed class SetTrustLineFlagsResultXdr {
         else -> throw IllegalArgumentException("Unknown SetTrustLineFlagsResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SetTrustLineFlagsResultCodeXdr.decode(reader)
+      when (discriminant) {
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_SUCCESS -> {}
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_MALFORMED -> {}
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_NO_TRUST_LINE -> {}
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_CANT_REVOKE -> {}
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_INVALID_STATE -> {}
+        SetTrustLineFlagsResultCodeXdr.SET_TRUST_LINE_FLAGS_LOW_RESERVE -> {}
+        else -> throw IllegalArgumentException("Unknown SetTrustLineFlagsResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +59,13 @@ sealed class SetTrustLineFlagsResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -19,9 +19,27 @@ data class ShortHashSeedXdr(
       val seed = reader.readFixedOpaque(16)
       return ShortHashSeedXdr(seed)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(16)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(seed, 16)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(16)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is ShortHashSeedXdr) return false
+    return seed.contentEquals(other.seed)
+  }
+
+  override fun hashCode(): Int = seed.contentHashCode()
 }
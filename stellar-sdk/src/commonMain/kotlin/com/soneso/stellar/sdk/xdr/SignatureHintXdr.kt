@@ -15,9 +15,25 @@ value class SignatureHintXdr(val value: ByteArray) {
       val value = reader.readFixedOpaque(4)
       return SignatureHintXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(value, 4)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(4)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun SignatureHintXdr?.contentEquals(other: SignatureHintXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun SignatureHintXdr?.contentHashCode(): Int = this?.value.contentHashCode()
@@ -15,9 +15,25 @@ value class SignatureXdr(val value: ByteArray) {
       val value = reader.readVariableOpaque()
       return SignatureXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeVariableOpaque(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrVariableOpaqueSize(value)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun SignatureXdr?.contentEquals(other: SignatureXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun SignatureXdr?.contentHashCode(): Int = this?.value.contentHashCode()
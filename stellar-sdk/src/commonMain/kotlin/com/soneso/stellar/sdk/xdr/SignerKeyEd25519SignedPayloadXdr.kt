@@ -24,10 +24,35 @@ data class SignerKeyEd25519SignedPayloadXdr(
       val payload = reader.readVariableOpaque()
       return SignerKeyEd25519SignedPayloadXdr(ed25519, payload)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint256Xdr.skip(reader)
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     ed25519.encode(writer)
     writer.writeVariableOpaque(payload)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ed25519.encodedSize()
+    size += xdrVariableOpaqueSize(payload)
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is SignerKeyEd25519SignedPayloadXdr) return false
+    return ed25519.contentEquals(other.ed25519) &&
+      payload.contentEquals(other.payload)
+  }
+
+  override fun hashCode(): Int {
+    var result = ed25519.contentHashCode()
+    result = 31 * result + payload.contentHashCode()
+    return result
+  }
 }
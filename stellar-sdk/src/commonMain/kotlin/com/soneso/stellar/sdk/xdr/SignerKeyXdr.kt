@@ -32,18 +32,42 @@ sealed class SignerKeyXdr {
     val value: Uint256Xdr
   ) : SignerKeyXdr() {
     override val discriminant: SignerKeyTypeXdr = SignerKeyTypeXdr.SIGNER_KEY_TYPE_ED25519
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is Ed25519) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class PreAuthTx(
     val value: Uint256Xdr
   ) : SignerKeyXdr() {
     override val discriminant: SignerKeyTypeXdr = SignerKeyTypeXdr.SIGNER_KEY_TYPE_PRE_AUTH_TX
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is PreAuthTx) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class HashX(
     val value: Uint256Xdr
   ) : SignerKeyXdr() {
     override val discriminant: SignerKeyTypeXdr = SignerKeyTypeXdr.SIGNER_KEY_TYPE_HASH_X
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is HashX) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   data class Ed25519SignedPayload(
@@ -76,6 +100,17 @@ sealed class SignerKeyXdr {
         else -> throw IllegalArgumentException("Unknown SignerKeyXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SignerKeyTypeXdr.decode(reader)
+      when (discriminant) {
+        SignerKeyTypeXdr.SIGNER_KEY_TYPE_ED25519 -> Uint256Xdr.skip(reader)
+        SignerKeyTypeXdr.SIGNER_KEY_TYPE_PRE_AUTH_TX -> Uint256Xdr.skip(reader)
+        SignerKeyTypeXdr.SIGNER_KEY_TYPE_HASH_X -> Uint256Xdr.skip(reader)
+        SignerKeyTypeXdr.SIGNER_KEY_TYPE_ED25519_SIGNED_PAYLOAD -> SignerKeyEd25519SignedPayloadXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SignerKeyXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -95,4 +130,24 @@ sealed class SignerKeyXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Ed25519 -> {
+        size += value.encodedSize()
+      }
+      is PreAuthTx -> {
+        size += value.encodedSize()
+      }
+      is HashX -> {
+        size += value.encodedSize()
+      }
+      is Ed25519SignedPayload -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -23,10 +23,22 @@ data class SignerXdr(
       val weight = Uint32Xdr.decode(reader)
       return SignerXdr(key, weight)
     }
+
+    fun skip(reader: XdrReader) {
+      SignerKeyXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     key.encode(writer)
     weight.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += key.encodedSize()
+    size += weight.encodedSize()
+    return size
+  }
 }
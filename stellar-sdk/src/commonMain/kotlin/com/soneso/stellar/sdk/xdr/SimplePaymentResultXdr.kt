@@ -25,6 +25,12 @@ data class SimplePaymentResultXdr(
       val amount = Int64Xdr.decode(reader)
       return SimplePaymentResultXdr(destination, asset, amount)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      AssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class SimplePaymentResultXdr(
     asset.encode(writer)
     amount.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += destination.encodedSize()
+    size += asset.encodedSize()
+    size += amount.encodedSize()
+    return size
+  }
 }
@@ -28,6 +28,13 @@ data class SorobanAddressCredentialsXdr(
       val signature = SCValXdr.decode(reader)
       return SorobanAddressCredentialsXdr(address, nonce, signatureExpirationLedger, signature)
     }
+
+    fun skip(reader: XdrReader) {
+      SCAddressXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      SCValXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -36,4 +43,13 @@ data class SorobanAddressCredentialsXdr(
     signatureExpirationLedger.encode(writer)
     signature.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += address.encodedSize()
+    size += nonce.encodedSize()
+    size += signatureExpirationLedger.encodedSize()
+    size += signature.encodedSize()
+    return size
+  }
 }
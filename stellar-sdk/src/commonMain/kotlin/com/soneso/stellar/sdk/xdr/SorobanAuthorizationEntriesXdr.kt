@@ -15,6 +15,10 @@ value class SorobanAuthorizationEntriesXdr(val value: List<SorobanAuthorizationE
       val value = List(reader.readInt()) { SorobanAuthorizationEntryXdr.decode(reader) }
       return SorobanAuthorizationEntriesXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { SorobanAuthorizationEntryXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -23,4 +27,13 @@ value class SorobanAuthorizationEntriesXdr(val value: List<SorobanAuthorizationE
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    value.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
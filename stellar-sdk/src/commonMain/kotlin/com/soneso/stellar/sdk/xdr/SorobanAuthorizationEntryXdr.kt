@@ -22,10 +22,22 @@ data class SorobanAuthorizationEntryXdr(
       val rootInvocation = SorobanAuthorizedInvocationXdr.decode(reader)
       return SorobanAuthorizationEntryXdr(credentials, rootInvocation)
     }
+
+    fun skip(reader: XdrReader) {
+      SorobanCredentialsXdr.skip(reader)
+      SorobanAuthorizedInvocationXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     credentials.encode(writer)
     rootInvocation.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += credentials.encodedSize()
+    size += rootInvocation.encodedSize()
+    return size
+  }
 }
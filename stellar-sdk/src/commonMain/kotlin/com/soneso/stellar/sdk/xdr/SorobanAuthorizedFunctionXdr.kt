@@ -76,6 +76,16 @@ sealed class SorobanAuthorizedFunctionXdr {
         else -> throw IllegalArgumentException("Unknown SorobanAuthorizedFunctionXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SorobanAuthorizedFunctionTypeXdr.decode(reader)
+      when (discriminant) {
+        SorobanAuthorizedFunctionTypeXdr.SOROBAN_AUTHORIZED_FUNCTION_TYPE_CONTRACT_FN -> InvokeContractArgsXdr.skip(reader)
+        SorobanAuthorizedFunctionTypeXdr.SOROBAN_AUTHORIZED_FUNCTION_TYPE_CREATE_CONTRACT_HOST_FN -> CreateContractArgsXdr.skip(reader)
+        SorobanAuthorizedFunctionTypeXdr.SOROBAN_AUTHORIZED_FUNCTION_TYPE_CREATE_CONTRACT_V2_HOST_FN -> CreateContractArgsV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SorobanAuthorizedFunctionXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -92,4 +102,21 @@ sealed class SorobanAuthorizedFunctionXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is ContractFn -> {
+        size += value.encodedSize()
+      }
+      is CreateContractHostFn -> {
+        size += value.encodedSize()
+      }
+      is CreateContractV2HostFn -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class SorobanAuthorizedInvocationXdr(
       val subInvocations = List(reader.readInt()) { SorobanAuthorizedInvocationXdr.decode(reader) }
       return SorobanAuthorizedInvocationXdr(function, subInvocations)
     }
+
+    fun skip(reader: XdrReader) {
+      SorobanAuthorizedFunctionXdr.skip(reader)
+      repeat(reader.readInt()) { SorobanAuthorizedInvocationXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,14 @@ data class SorobanAuthorizedInvocationXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += function.encodedSize()
+    size += 4
+    subInvocations.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
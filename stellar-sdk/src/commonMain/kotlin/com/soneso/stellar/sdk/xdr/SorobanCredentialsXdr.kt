@@ -39,6 +39,15 @@ sealed class SorobanCredentialsXdr {
         else -> throw IllegalArgumentException("Unknown SorobanCredentialsXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = SorobanCredentialsTypeXdr.decode(reader)
+      when (discriminant) {
+        SorobanCredentialsTypeXdr.SOROBAN_CREDENTIALS_SOURCE_ACCOUNT -> {}
+        SorobanCredentialsTypeXdr.SOROBAN_CREDENTIALS_ADDRESS -> SorobanAddressCredentialsXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SorobanCredentialsXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class SorobanCredentialsXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is Address -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -22,6 +22,10 @@ data class SorobanResourcesExtV0Xdr(
       val archivedSorobanEntries = List(reader.readInt()) { Uint32Xdr.decode(reader) }
       return SorobanResourcesExtV0Xdr(archivedSorobanEntries)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { Uint32Xdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -30,4 +34,13 @@ data class SorobanResourcesExtV0Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    archivedSorobanEntries.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -37,6 +37,13 @@ data class SorobanResourcesXdr(
       val writeBytes = Uint32Xdr.decode(reader)
       return SorobanResourcesXdr(footprint, instructions, diskReadBytes, writeBytes)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerFootprintXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -45,4 +52,13 @@ data class SorobanResourcesXdr(
     diskReadBytes.encode(writer)
     writeBytes.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += footprint.encodedSize()
+    size += instructions.encodedSize()
+    size += diskReadBytes.encodedSize()
+    size += writeBytes.encodedSize()
+    return size
+  }
 }
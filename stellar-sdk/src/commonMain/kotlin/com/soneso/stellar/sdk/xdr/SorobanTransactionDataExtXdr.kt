@@ -39,6 +39,15 @@ sealed class SorobanTransactionDataExtXdr {
         else -> throw IllegalArgumentException("Unknown SorobanTransactionDataExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> SorobanResourcesExtV0Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown SorobanTransactionDataExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class SorobanTransactionDataExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is ResourceExt -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
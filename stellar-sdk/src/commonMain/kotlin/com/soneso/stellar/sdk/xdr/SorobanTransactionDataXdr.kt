@@ -51,6 +51,12 @@ data class SorobanTransactionDataXdr(
       val resourceFee = Int64Xdr.decode(reader)
       return SorobanTransactionDataXdr(ext, resources, resourceFee)
     }
+
+    fun skip(reader: XdrReader) {
+      SorobanTransactionDataExtXdr.skip(reader)
+      SorobanResourcesXdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -58,4 +64,12 @@ data class SorobanTransactionDataXdr(
     resources.encode(writer)
     resourceFee.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += resources.encodedSize()
+    size += resourceFee.encodedSize()
+    return size
+  }
 }
@@ -84,6 +84,13 @@ data class SorobanTransactionMetaExtV1Xdr(
       val rentFeeCharged = Int64Xdr.decode(reader)
       return SorobanTransactionMetaExtV1Xdr(ext, totalNonRefundableResourceFeeCharged, totalRefundableResourceFeeCharged, rentFeeCharged)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -92,4 +99,13 @@ data class SorobanTransactionMetaExtV1Xdr(
     totalRefundableResourceFeeCharged.encode(writer)
     rentFeeCharged.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += totalNonRefundableResourceFeeCharged.encodedSize()
+    size += totalRefundableResourceFeeCharged.encodedSize()
+    size += rentFeeCharged.encodedSize()
+    return size
+  }
 }
@@ -23,6 +23,11 @@ data class SorobanTransactionMetaV2Xdr(
       val returnValue = if (reader.readBoolean()) SCValXdr.decode(reader) else null
       return SorobanTransactionMetaV2Xdr(ext, returnValue)
     }
+
+    fun skip(reader: XdrReader) {
+      SorobanTransactionMetaExtXdr.skip(reader)
+      if (reader.readBoolean()) SCValXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -34,4 +39,16 @@ data class SorobanTransactionMetaV2Xdr(
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    if (returnValue != null) {
+      size += 4
+      size += returnValue.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
 }
@@ -38,6 +38,13 @@ data class SorobanTransactionMetaXdr(
       val diagnosticEvents = List(reader.readInt()) { DiagnosticEventXdr.decode(reader) }
       return SorobanTransactionMetaXdr(ext, events, returnValue, diagnosticEvents)
     }
+
+    fun skip(reader: XdrReader) {
+      SorobanTransactionMetaExtXdr.skip(reader)
+      repeat(reader.readInt()) { ContractEventXdr.skip(reader) }
+      SCValXdr.skip(reader)
+      repeat(reader.readInt()) { DiagnosticEventXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -52,4 +59,19 @@ data class SorobanTransactionMetaXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += 4
+    events.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += returnValue.encodedSize()
+    size += 4
+    diagnosticEvents.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -15,6 +15,10 @@ value class SponsorshipDescriptorXdr(val value: AccountIDXdr?) {
       val value = if (reader.readBoolean()) AccountIDXdr.decode(reader) else null
       return SponsorshipDescriptorXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) AccountIDXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -25,4 +29,15 @@ value class SponsorshipDescriptorXdr(val value: AccountIDXdr?) {
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (value != null) {
+      size += 4
+      size += value.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
 }
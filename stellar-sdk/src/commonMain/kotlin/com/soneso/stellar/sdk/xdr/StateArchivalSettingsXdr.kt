@@ -63,6 +63,19 @@ data class StateArchivalSettingsXdr(
       val startingEvictionScanLevel = Uint32Xdr.decode(reader)
       return StateArchivalSettingsXdr(maxEntryTtl, minTemporaryTtl, minPersistentTtl, persistentRentRateDenominator, tempRentRateDenominator, maxEntriesToArchive, liveSorobanStateSizeWindowSampleSize, liveSorobanStateSizeWindowSamplePeriod, evictionScanSize, startingEvictionScanLevel)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -77,4 +90,19 @@ data class StateArchivalSettingsXdr(
     evictionScanSize.encode(writer)
     startingEvictionScanLevel.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += maxEntryTtl.encodedSize()
+    size += minTemporaryTtl.encodedSize()
+    size += minPersistentTtl.encodedSize()
+    size += persistentRentRateDenominator.encodedSize()
+    size += tempRentRateDenominator.encodedSize()
+    size += maxEntriesToArchive.encodedSize()
+    size += liveSorobanStateSizeWindowSampleSize.encodedSize()
+    size += liveSorobanStateSizeWindowSamplePeriod.encodedSize()
+    size += evictionScanSize.encodedSize()
+    size += startingEvictionScanLevel.encodedSize()
+    return size
+  }
 }
@@ -39,6 +39,15 @@ sealed class StellarValueExtXdr {
         else -> throw IllegalArgumentException("Unknown StellarValueExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = StellarValueTypeXdr.decode(reader)
+      when (discriminant) {
+        StellarValueTypeXdr.STELLAR_VALUE_BASIC -> {}
+        StellarValueTypeXdr.STELLAR_VALUE_SIGNED -> LedgerCloseValueSignatureXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown StellarValueExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class StellarValueExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is LcValueSignature -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -45,6 +45,13 @@ data class StellarValueXdr(
       val ext = StellarValueExtXdr.decode(reader)
       return StellarValueXdr(txSetHash, closeTime, upgrades, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      TimePointXdr.skip(reader)
+      repeat(reader.readInt()) { UpgradeTypeXdr.skip(reader) }
+      StellarValueExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -56,4 +63,33 @@ data class StellarValueXdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += txSetHash.encodedSize()
+    size += closeTime.encodedSize()
+    size += 4
+    upgrades.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is StellarValueXdr) return false
+    return txSetHash.contentEquals(other.txSetHash) &&
+      closeTime == other.closeTime &&
+      upgrades.size == other.upgrades.size && upgrades.indices.all { upgrades[it].contentEquals(other.upgrades[it]) } &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = txSetHash.contentHashCode()
+    result = 31 * result + closeTime.hashCode()
+    result = 31 * result + upgrades.fold(1) { hash, item -> 31 * hash + item.contentHashCode() }
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
@@ -23,10 +23,35 @@ data class TTLEntryXdr(
       val liveUntilLedgerSeq = Uint32Xdr.decode(reader)
       return TTLEntryXdr(keyHash, liveUntilLedgerSeq)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     keyHash.encode(writer)
     liveUntilLedgerSeq.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += keyHash.encodedSize()
+    size += liveUntilLedgerSeq.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TTLEntryXdr) return false
+    return keyHash.contentEquals(other.keyHash) &&
+      liveUntilLedgerSeq == other.liveUntilLedgerSeq
+  }
+
+  override fun hashCode(): Int {
+    var result = keyHash.contentHashCode()
+    result = 31 * result + liveUntilLedgerSeq.hashCode()
+    return result
+  }
 }
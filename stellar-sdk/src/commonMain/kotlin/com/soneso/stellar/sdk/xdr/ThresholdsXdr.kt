@@ -15,9 +15,25 @@ value class ThresholdsXdr(val value: ByteArray) {
       val value = reader.readFixedOpaque(4)
       return ThresholdsXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipFixedOpaque(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeFixedOpaque(value, 4)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrPaddedSize(4)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun ThresholdsXdr?.contentEquals(other: ThresholdsXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun ThresholdsXdr?.contentHashCode(): Int = this?.value.contentHashCode()
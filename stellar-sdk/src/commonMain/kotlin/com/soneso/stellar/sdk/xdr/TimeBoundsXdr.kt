@@ -23,10 +23,22 @@ data class TimeBoundsXdr(
       val maxTime = TimePointXdr.decode(reader)
       return TimeBoundsXdr(minTime, maxTime)
     }
+
+    fun skip(reader: XdrReader) {
+      TimePointXdr.skip(reader)
+      TimePointXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     minTime.encode(writer)
     maxTime.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += minTime.encodedSize()
+    size += maxTime.encodedSize()
+    return size
+  }
 }
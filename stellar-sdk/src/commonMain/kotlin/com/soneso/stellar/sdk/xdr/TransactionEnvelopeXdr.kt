@@ -56,6 +56,16 @@ sealed class TransactionEnvelopeXdr {
         else -> throw IllegalArgumentException("Unknown TransactionEnvelopeXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = EnvelopeTypeXdr.decode(reader)
+      when (discriminant) {
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX_V0 -> TransactionV0EnvelopeXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX -> TransactionV1EnvelopeXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX_FEE_BUMP -> FeeBumpTransactionEnvelopeXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionEnvelopeXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +82,21 @@ sealed class TransactionEnvelopeXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is V0 -> {
+        size += value.encodedSize()
+      }
+      is V1 -> {
+        size += value.encodedSize()
+      }
+      is FeeBump -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -23,10 +23,22 @@ data class TransactionEventXdr(
       val event = ContractEventXdr.decode(reader)
       return TransactionEventXdr(stage, event)
     }
+
+    fun skip(reader: XdrReader) {
+      TransactionEventStageXdr.skip(reader)
+      ContractEventXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     stage.encode(writer)
     event.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += stage.encodedSize()
+    size += event.encodedSize()
+    return size
+  }
 }
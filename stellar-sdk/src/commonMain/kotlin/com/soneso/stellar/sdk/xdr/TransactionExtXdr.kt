@@ -39,6 +39,15 @@ sealed class TransactionExtXdr {
         else -> throw IllegalArgumentException("Unknown TransactionExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> SorobanTransactionDataXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class TransactionExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is SorobanData -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
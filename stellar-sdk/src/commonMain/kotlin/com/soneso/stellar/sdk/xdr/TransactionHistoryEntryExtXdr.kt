@@ -39,6 +39,15 @@ sealed class TransactionHistoryEntryExtXdr {
         else -> throw IllegalArgumentException("Unknown TransactionHistoryEntryExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> GeneralizedTransactionSetXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionHistoryEntryExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class TransactionHistoryEntryExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is GeneralizedTxSet -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -34,6 +34,12 @@ data class TransactionHistoryEntryXdr(
       val ext = TransactionHistoryEntryExtXdr.decode(reader)
       return TransactionHistoryEntryXdr(ledgerSeq, txSet, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      TransactionSetXdr.skip(reader)
+      TransactionHistoryEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -41,4 +47,12 @@ data class TransactionHistoryEntryXdr(
     txSet.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerSeq.encodedSize()
+    size += txSet.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
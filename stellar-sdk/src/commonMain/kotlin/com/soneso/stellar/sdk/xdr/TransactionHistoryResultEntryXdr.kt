@@ -32,6 +32,12 @@ data class TransactionHistoryResultEntryXdr(
       val ext = TransactionHistoryResultEntryExtXdr.decode(reader)
       return TransactionHistoryResultEntryXdr(ledgerSeq, txResultSet, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint32Xdr.skip(reader)
+      TransactionResultSetXdr.skip(reader)
+      TransactionHistoryResultEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +45,12 @@ data class TransactionHistoryResultEntryXdr(
     txResultSet.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ledgerSeq.encodedSize()
+    size += txResultSet.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -23,6 +23,11 @@ data class TransactionMetaV1Xdr(
       val operations = List(reader.readInt()) { OperationMetaXdr.decode(reader) }
       return TransactionMetaV1Xdr(txChanges, operations)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerEntryChangesXdr.skip(reader)
+      repeat(reader.readInt()) { OperationMetaXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +37,14 @@ data class TransactionMetaV1Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += txChanges.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -29,6 +29,12 @@ data class TransactionMetaV2Xdr(
       val txChangesAfter = LedgerEntryChangesXdr.decode(reader)
       return TransactionMetaV2Xdr(txChangesBefore, operations, txChangesAfter)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerEntryChangesXdr.skip(reader)
+      repeat(reader.readInt()) { OperationMetaXdr.skip(reader) }
+      LedgerEntryChangesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -39,4 +45,15 @@ data class TransactionMetaV2Xdr(
     }
     txChangesAfter.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += txChangesBefore.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += txChangesAfter.encodedSize()
+    return size
+  }
 }
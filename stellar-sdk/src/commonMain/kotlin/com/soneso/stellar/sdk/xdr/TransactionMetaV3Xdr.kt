@@ -41,6 +41,14 @@ data class TransactionMetaV3Xdr(
       val sorobanMeta = if (reader.readBoolean()) SorobanTransactionMetaXdr.decode(reader) else null
       return TransactionMetaV3Xdr(ext, txChangesBefore, operations, txChangesAfter, sorobanMeta)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+      repeat(reader.readInt()) { OperationMetaXdr.skip(reader) }
+      LedgerEntryChangesXdr.skip(reader)
+      if (reader.readBoolean()) SorobanTransactionMetaXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -58,4 +66,22 @@ data class TransactionMetaV3Xdr(
       writer.writeBoolean(false)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += txChangesBefore.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += txChangesAfter.encodedSize()
+    if (sorobanMeta != null) {
+      size += 4
+      size += sorobanMeta.encodedSize()
+    } else {
+      size += 4
+    }
+    return size
+  }
 }
@@ -48,6 +48,16 @@ data class TransactionMetaV4Xdr(
       val diagnosticEvents = List(reader.readInt()) { DiagnosticEventXdr.decode(reader) }
       return TransactionMetaV4Xdr(ext, txChangesBefore, operations, txChangesAfter, sorobanMeta, events, diagnosticEvents)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+      repeat(reader.readInt()) { OperationMetaV2Xdr.skip(reader) }
+      LedgerEntryChangesXdr.skip(reader)
+      if (reader.readBoolean()) SorobanTransactionMetaV2Xdr.skip(reader)
+      repeat(reader.readInt()) { TransactionEventXdr.skip(reader) }
+      repeat(reader.readInt()) { DiagnosticEventXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -73,4 +83,30 @@ data class TransactionMetaV4Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += txChangesBefore.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += txChangesAfter.encodedSize()
+    if (sorobanMeta != null) {
+      size += 4
+      size += sorobanMeta.encodedSize()
+    } else {
+      size += 4
+    }
+    size += 4
+    events.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += 4
+    diagnosticEvents.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
@@ -80,6 +80,18 @@ sealed class TransactionMetaXdr {
         else -> throw IllegalArgumentException("Unknown TransactionMetaXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> repeat(reader.readInt()) { OperationMetaXdr.skip(reader) }
+        1 -> TransactionMetaV1Xdr.skip(reader)
+        2 -> TransactionMetaV2Xdr.skip(reader)
+        3 -> TransactionMetaV3Xdr.skip(reader)
+        4 -> TransactionMetaV4Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionMetaXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -105,4 +117,30 @@ sealed class TransactionMetaXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Operations -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is V1 -> {
+        size += value.encodedSize()
+      }
+      is V2 -> {
+        size += value.encodedSize()
+      }
+      is V3 -> {
+        size += value.encodedSize()
+      }
+      is V4 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
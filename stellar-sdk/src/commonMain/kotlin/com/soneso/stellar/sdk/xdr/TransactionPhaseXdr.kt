@@ -44,6 +44,15 @@ sealed class TransactionPhaseXdr {
         else -> throw IllegalArgumentException("Unknown TransactionPhaseXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> repeat(reader.readInt()) { TxSetComponentXdr.skip(reader) }
+        1 -> ParallelTxsComponentXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionPhaseXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -60,4 +69,21 @@ sealed class TransactionPhaseXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is V0Components -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is ParallelTxsComponent -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
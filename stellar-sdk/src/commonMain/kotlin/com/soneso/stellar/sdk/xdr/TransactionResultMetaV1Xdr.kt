@@ -33,6 +33,14 @@ data class TransactionResultMetaV1Xdr(
       val postTxApplyFeeProcessing = LedgerEntryChangesXdr.decode(reader)
       return TransactionResultMetaV1Xdr(ext, result, feeProcessing, txApplyProcessing, postTxApplyFeeProcessing)
     }
+
+    fun skip(reader: XdrReader) {
+      ExtensionPointXdr.skip(reader)
+      TransactionResultPairXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+      TransactionMetaXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -42,4 +50,14 @@ data class TransactionResultMetaV1Xdr(
     txApplyProcessing.encode(writer)
     postTxApplyFeeProcessing.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += ext.encodedSize()
+    size += result.encodedSize()
+    size += feeProcessing.encodedSize()
+    size += txApplyProcessing.encodedSize()
+    size += postTxApplyFeeProcessing.encodedSize()
+    return size
+  }
 }
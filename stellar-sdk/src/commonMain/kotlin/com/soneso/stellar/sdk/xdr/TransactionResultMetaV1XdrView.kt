@@ -0,0 +1,61 @@
+// Automatically generated by xdrgen
+// DO NOT EDIT or your changes may be overwritten
+
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only view of a [TransactionResultMetaV1Xdr] encoded in [buffer] at [offset].
+ *
+ * Members are decoded from the buffer each time they are accessed, and members of
+ * view types are returned as views themselves, so an untouched view allocates nothing.
+ * A list of views is kept once created, since it finds its element offsets only once.
+ * Views are not thread-safe; the buffer must not be modified while they are in use.
+ */
+class TransactionResultMetaV1XdrView(val buffer: ByteArray, val offset: Int) {
+  private var memberOffsets: IntArray? = null
+  private var knownOffsets = 1
+
+  val ext: ExtensionPointXdr
+    get() = decodeXdrAt(buffer, memberOffset(0)) { reader -> ExtensionPointXdr.decode(reader) }
+
+  val result: TransactionResultPairXdr
+    get() = decodeXdrAt(buffer, memberOffset(1)) { reader -> TransactionResultPairXdr.decode(reader) }
+
+  private var feeProcessingList: XdrViewList<LedgerEntryChangeXdrView>? = null
+
+  val feeProcessing: XdrViewList<LedgerEntryChangeXdrView>
+    get() = feeProcessingList ?: XdrViewList(buffer, memberOffset(2), { reader -> LedgerEntryChangeXdr.skip(reader) }, ::LedgerEntryChangeXdrView).also { feeProcessingList = it }
+
+  val txApplyProcessing: TransactionMetaXdr
+    get() = decodeXdrAt(buffer, memberOffset(3)) { reader -> TransactionMetaXdr.decode(reader) }
+
+  private var postTxApplyFeeProcessingList: XdrViewList<LedgerEntryChangeXdrView>? = null
+
+  val postTxApplyFeeProcessing: XdrViewList<LedgerEntryChangeXdrView>
+    get() = postTxApplyFeeProcessingList ?: XdrViewList(buffer, memberOffset(4), { reader -> LedgerEntryChangeXdr.skip(reader) }, ::LedgerEntryChangeXdrView).also { postTxApplyFeeProcessingList = it }
+
+  /** Offset of the first byte after the encoded value. */
+  val endOffset: Int
+    get() = memberOffset(5)
+
+  /** Decodes the complete value. */
+  fun decode(): TransactionResultMetaV1Xdr = decodeXdrAt(buffer, offset) { reader -> TransactionResultMetaV1Xdr.decode(reader) }
+
+  private fun memberOffset(index: Int): Int {
+    if (index == 0) return offset
+    val offsets = memberOffsets ?: IntArray(6).also { it[0] = offset; memberOffsets = it }
+    if (index < knownOffsets) return offsets[index]
+    val reader = xdrReaderAt(buffer, offsets[knownOffsets - 1])
+    while (knownOffsets <= index) {
+      when (knownOffsets - 1) {
+        0 -> ExtensionPointXdr.skip(reader)
+        1 -> TransactionResultPairXdr.skip(reader)
+        2 -> LedgerEntryChangesXdr.skip(reader)
+        3 -> TransactionMetaXdr.skip(reader)
+        4 -> LedgerEntryChangesXdr.skip(reader)
+      }
+      offsets[knownOffsets++] = reader.position
+    }
+    return offsets[index]
+  }
+}
@@ -25,6 +25,12 @@ data class TransactionResultMetaXdr(
       val txApplyProcessing = TransactionMetaXdr.decode(reader)
       return TransactionResultMetaXdr(result, feeProcessing, txApplyProcessing)
     }
+
+    fun skip(reader: XdrReader) {
+      TransactionResultPairXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+      TransactionMetaXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -32,4 +38,12 @@ data class TransactionResultMetaXdr(
     feeProcessing.encode(writer)
     txApplyProcessing.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += result.encodedSize()
+    size += feeProcessing.encodedSize()
+    size += txApplyProcessing.encodedSize()
+    return size
+  }
 }
@@ -23,10 +23,35 @@ data class TransactionResultPairXdr(
       val result = TransactionResultXdr.decode(reader)
       return TransactionResultPairXdr(transactionHash, result)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      TransactionResultXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     transactionHash.encode(writer)
     result.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += transactionHash.encodedSize()
+    size += result.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TransactionResultPairXdr) return false
+    return transactionHash.contentEquals(other.transactionHash) &&
+      result == other.result
+  }
+
+  override fun hashCode(): Int {
+    var result = transactionHash.contentHashCode()
+    result = 31 * result + this.result.hashCode()
+    return result
+  }
 }
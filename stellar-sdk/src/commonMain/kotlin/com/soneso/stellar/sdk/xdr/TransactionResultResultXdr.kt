@@ -36,16 +36,14 @@ sealed class TransactionResultResultXdr {
   abstract val discriminant: TransactionResultCodeXdr
 
   data class InnerResultPair(
-    val value: InnerTransactionResultPairXdr
-  ) : TransactionResultResultXdr() {
+    val value: InnerTransactionResultPairXdr,
     override val discriminant: TransactionResultCodeXdr = TransactionResultCodeXdr.txFEE_BUMP_INNER_SUCCESS
-  }
+  ) : TransactionResultResultXdr()
 
   data class Results(
-    val value: List<OperationResultXdr>
-  ) : TransactionResultResultXdr() {
+    val value: List<OperationResultXdr>,
     override val discriminant: TransactionResultCodeXdr = TransactionResultCodeXdr.txSUCCESS
-  }
+  ) : TransactionResultResultXdr()
 
   /** case txFEE_BUMP_INNER_FAILED: handled above */
   data class Void(
@@ -59,19 +57,19 @@ sealed class TransactionResultResultXdr {
       return when (discriminant) {
         TransactionResultCodeXdr.txFEE_BUMP_INNER_SUCCESS -> {
           val value = InnerTransactionResultPairXdr.decode(reader)
-          InnerResultPair(value)
+          InnerResultPair(value, discriminant)
         }
         TransactionResultCodeXdr.txFEE_BUMP_INNER_FAILED -> {
           val value = InnerTransactionResultPairXdr.decode(reader)
-          InnerResultPair(value)
+          InnerResultPair(value, discriminant)
         }
         TransactionResultCodeXdr.txSUCCESS -> {
           val value = List(reader.readInt()) { OperationResultXdr.decode(reader) }
-          Results(value)
+          Results(value, discriminant)
         }
         TransactionResultCodeXdr.txFAILED -> {
           val value = List(reader.readInt()) { OperationResultXdr.decode(reader) }
-          Results(value)
+          Results(value, discriminant)
         }
         TransactionResultCodeXdr.txTOO_EARLY -> Void(discriminant)
         TransactionResultCodeXdr.txTOO_LATE -> Void(discriminant)
@@ -91,6 +89,32 @@ sealed class TransactionResultResultXdr {
         else -> throw IllegalArgumentException("Unknown TransactionResultResultXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = TransactionResultCodeXdr.decode(reader)
+      when (discriminant) {
+        TransactionResultCodeXdr.txFEE_BUMP_INNER_SUCCESS -> InnerTransactionResultPairXdr.skip(reader)
+        TransactionResultCodeXdr.txFEE_BUMP_INNER_FAILED -> InnerTransactionResultPairXdr.skip(reader)
+        TransactionResultCodeXdr.txSUCCESS -> repeat(reader.readInt()) { OperationResultXdr.skip(reader) }
+        TransactionResultCodeXdr.txFAILED -> repeat(reader.readInt()) { OperationResultXdr.skip(reader) }
+        TransactionResultCodeXdr.txTOO_EARLY -> {}
+        TransactionResultCodeXdr.txTOO_LATE -> {}
+        TransactionResultCodeXdr.txMISSING_OPERATION -> {}
+        TransactionResultCodeXdr.txBAD_SEQ -> {}
+        TransactionResultCodeXdr.txBAD_AUTH -> {}
+        TransactionResultCodeXdr.txINSUFFICIENT_BALANCE -> {}
+        TransactionResultCodeXdr.txNO_ACCOUNT -> {}
+        TransactionResultCodeXdr.txINSUFFICIENT_FEE -> {}
+        TransactionResultCodeXdr.txBAD_AUTH_EXTRA -> {}
+        TransactionResultCodeXdr.txINTERNAL_ERROR -> {}
+        TransactionResultCodeXdr.txNOT_SUPPORTED -> {}
+        TransactionResultCodeXdr.txBAD_SPONSORSHIP -> {}
+        TransactionResultCodeXdr.txBAD_MIN_SEQ_AGE_OR_GAP -> {}
+        TransactionResultCodeXdr.txMALFORMED -> {}
+        TransactionResultCodeXdr.txSOROBAN_INVALID -> {}
+        else -> throw IllegalArgumentException("Unknown TransactionResultResultXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -108,4 +132,22 @@ sealed class TransactionResultResultXdr {
       is Void -> {}
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is InnerResultPair -> {
+        size += value.encodedSize()
+      }
+      is Results -> {
+        size += 4
+        value.forEach { item ->
+          size += item.encodedSize()
+        }
+      }
+      is Void -> {}
+    }
+    return size
+  }
 }
@@ -19,6 +19,10 @@ data class TransactionResultSetXdr(
       val results = List(reader.readInt()) { TransactionResultPairXdr.decode(reader) }
       return TransactionResultSetXdr(results)
     }
+
+    fun skip(reader: XdrReader) {
+      repeat(reader.readInt()) { TransactionResultPairXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -27,4 +31,13 @@ data class TransactionResultSetXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    results.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
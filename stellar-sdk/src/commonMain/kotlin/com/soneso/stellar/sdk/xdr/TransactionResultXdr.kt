@@ -60,6 +60,12 @@ data class TransactionResultXdr(
       val ext = TransactionResultExtXdr.decode(reader)
       return TransactionResultXdr(feeCharged, result, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Int64Xdr.skip(reader)
+      TransactionResultResultXdr.skip(reader)
+      TransactionResultExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -67,4 +73,12 @@ data class TransactionResultXdr(
     result.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += feeCharged.encodedSize()
+    size += result.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class TransactionSetV1Xdr(
       val phases = List(reader.readInt()) { TransactionPhaseXdr.decode(reader) }
       return TransactionSetV1Xdr(previousLedgerHash, phases)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      repeat(reader.readInt()) { TransactionPhaseXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,27 @@ data class TransactionSetV1Xdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += previousLedgerHash.encodedSize()
+    size += 4
+    phases.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TransactionSetV1Xdr) return false
+    return previousLedgerHash.contentEquals(other.previousLedgerHash) &&
+      phases == other.phases
+  }
+
+  override fun hashCode(): Int {
+    var result = previousLedgerHash.contentHashCode()
+    result = 31 * result + phases.hashCode()
+    return result
+  }
 }
@@ -22,6 +22,11 @@ data class TransactionSetXdr(
       val txs = List(reader.readInt()) { TransactionEnvelopeXdr.decode(reader) }
       return TransactionSetXdr(previousLedgerHash, txs)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      repeat(reader.readInt()) { TransactionEnvelopeXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -31,4 +36,27 @@ data class TransactionSetXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += previousLedgerHash.encodedSize()
+    size += 4
+    txs.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TransactionSetXdr) return false
+    return previousLedgerHash.contentEquals(other.previousLedgerHash) &&
+      txs == other.txs
+  }
+
+  override fun hashCode(): Int {
+    var result = previousLedgerHash.contentHashCode()
+    result = 31 * result + txs.hashCode()
+    return result
+  }
 }
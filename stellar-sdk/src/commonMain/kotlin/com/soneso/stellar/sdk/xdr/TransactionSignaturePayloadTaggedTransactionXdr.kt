@@ -46,6 +46,15 @@ sealed class TransactionSignaturePayloadTaggedTransactionXdr {
         else -> throw IllegalArgumentException("Unknown TransactionSignaturePayloadTaggedTransactionXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = EnvelopeTypeXdr.decode(reader)
+      when (discriminant) {
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX -> TransactionXdr.skip(reader)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX_FEE_BUMP -> FeeBumpTransactionXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TransactionSignaturePayloadTaggedTransactionXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -59,4 +68,18 @@ sealed class TransactionSignaturePayloadTaggedTransactionXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Tx -> {
+        size += value.encodedSize()
+      }
+      is FeeBump -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -30,10 +30,35 @@ data class TransactionSignaturePayloadXdr(
       val taggedTransaction = TransactionSignaturePayloadTaggedTransactionXdr.decode(reader)
       return TransactionSignaturePayloadXdr(networkId, taggedTransaction)
     }
+
+    fun skip(reader: XdrReader) {
+      HashXdr.skip(reader)
+      TransactionSignaturePayloadTaggedTransactionXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     networkId.encode(writer)
     taggedTransaction.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += networkId.encodedSize()
+    size += taggedTransaction.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TransactionSignaturePayloadXdr) return false
+    return networkId.contentEquals(other.networkId) &&
+      taggedTransaction == other.taggedTransaction
+  }
+
+  override fun hashCode(): Int {
+    var result = networkId.contentHashCode()
+    result = 31 * result + taggedTransaction.hashCode()
+    return result
+  }
 }
@@ -42,6 +42,16 @@ data class TransactionV0Xdr(
       val ext = TransactionV0ExtXdr.decode(reader)
       return TransactionV0Xdr(sourceAccountEd25519, fee, seqNum, timeBounds, memo, operations, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint256Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      SequenceNumberXdr.skip(reader)
+      if (reader.readBoolean()) TimeBoundsXdr.skip(reader)
+      MemoXdr.skip(reader)
+      repeat(reader.readInt()) { OperationXdr.skip(reader) }
+      TransactionV0ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -61,4 +71,47 @@ data class TransactionV0Xdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sourceAccountEd25519.encodedSize()
+    size += fee.encodedSize()
+    size += seqNum.encodedSize()
+    if (timeBounds != null) {
+      size += 4
+      size += timeBounds.encodedSize()
+    } else {
+      size += 4
+    }
+    size += memo.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
+
+  override fun equals(other: Any?): Boolean {
+    if (this === other) return true
+    if (other !is TransactionV0Xdr) return false
+    return sourceAccountEd25519.contentEquals(other.sourceAccountEd25519) &&
+      fee == other.fee &&
+      seqNum == other.seqNum &&
+      timeBounds == other.timeBounds &&
+      memo == other.memo &&
+      operations == other.operations &&
+      ext == other.ext
+  }
+
+  override fun hashCode(): Int {
+    var result = sourceAccountEd25519.contentHashCode()
+    result = 31 * result + fee.hashCode()
+    result = 31 * result + seqNum.hashCode()
+    result = 31 * result + timeBounds.hashCode()
+    result = 31 * result + memo.hashCode()
+    result = 31 * result + operations.hashCode()
+    result = 31 * result + ext.hashCode()
+    return result
+  }
 }
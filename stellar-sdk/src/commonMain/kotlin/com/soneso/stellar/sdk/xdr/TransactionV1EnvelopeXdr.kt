@@ -24,6 +24,11 @@ data class TransactionV1EnvelopeXdr(
       val signatures = List(reader.readInt()) { DecoratedSignatureXdr.decode(reader) }
       return TransactionV1EnvelopeXdr(tx, signatures)
     }
+
+    fun skip(reader: XdrReader) {
+      TransactionXdr.skip(reader)
+      repeat(reader.readInt()) { DecoratedSignatureXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -33,4 +38,14 @@ data class TransactionV1EnvelopeXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += tx.encodedSize()
+    size += 4
+    signatures.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
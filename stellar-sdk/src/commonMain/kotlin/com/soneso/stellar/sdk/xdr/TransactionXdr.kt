@@ -58,6 +58,16 @@ data class TransactionXdr(
       val ext = TransactionExtXdr.decode(reader)
       return TransactionXdr(sourceAccount, fee, seqNum, cond, memo, operations, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      MuxedAccountXdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      SequenceNumberXdr.skip(reader)
+      PreconditionsXdr.skip(reader)
+      MemoXdr.skip(reader)
+      repeat(reader.readInt()) { OperationXdr.skip(reader) }
+      TransactionExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -72,4 +82,19 @@ data class TransactionXdr(
     }
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += sourceAccount.encodedSize()
+    size += fee.encodedSize()
+    size += seqNum.encodedSize()
+    size += cond.encodedSize()
+    size += memo.encodedSize()
+    size += 4
+    operations.forEach { item ->
+      size += item.encodedSize()
+    }
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -41,6 +41,14 @@ sealed class TrustLineAssetXdr {
     val value: PoolIDXdr
   ) : TrustLineAssetXdr() {
     override val discriminant: AssetTypeXdr = AssetTypeXdr.ASSET_TYPE_POOL_SHARE
+
+    override fun equals(other: Any?): Boolean {
+      if (this === other) return true
+      if (other !is LiquidityPoolID) return false
+      return value.contentEquals(other.value)
+    }
+
+    override fun hashCode(): Int = value.contentHashCode()
   }
 
   /** Not credit */
@@ -69,6 +77,17 @@ sealed class TrustLineAssetXdr {
         else -> throw IllegalArgumentException("Unknown TrustLineAssetXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = AssetTypeXdr.decode(reader)
+      when (discriminant) {
+        AssetTypeXdr.ASSET_TYPE_NATIVE -> {}
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM4 -> AlphaNum4Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_CREDIT_ALPHANUM12 -> AlphaNum12Xdr.skip(reader)
+        AssetTypeXdr.ASSET_TYPE_POOL_SHARE -> PoolIDXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TrustLineAssetXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -86,4 +105,22 @@ sealed class TrustLineAssetXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is Void -> {}
+      is AlphaNum4 -> {
+        size += value.encodedSize()
+      }
+      is AlphaNum12 -> {
+        size += value.encodedSize()
+      }
+      is LiquidityPoolID -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
@@ -51,6 +51,15 @@ sealed class TrustLineEntryExtXdr {
         else -> throw IllegalArgumentException("Unknown TrustLineEntryExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        1 -> TrustLineEntryV1Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TrustLineEntryExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -62,4 +71,16 @@ sealed class TrustLineEntryExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V1 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
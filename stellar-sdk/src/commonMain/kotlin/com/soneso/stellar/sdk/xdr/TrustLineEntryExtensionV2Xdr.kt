@@ -28,10 +28,22 @@ data class TrustLineEntryExtensionV2Xdr(
       val ext = TrustLineEntryExtensionV2ExtXdr.decode(reader)
       return TrustLineEntryExtensionV2Xdr(liquidityPoolUseCount, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      Int32Xdr.skip(reader)
+      TrustLineEntryExtensionV2ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     liquidityPoolUseCount.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liquidityPoolUseCount.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
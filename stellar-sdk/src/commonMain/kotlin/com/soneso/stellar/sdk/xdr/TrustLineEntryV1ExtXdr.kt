@@ -39,6 +39,15 @@ sealed class TrustLineEntryV1ExtXdr {
         else -> throw IllegalArgumentException("Unknown TrustLineEntryV1ExtXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = reader.readInt()
+      when (discriminant) {
+        0 -> {}
+        2 -> TrustLineEntryExtensionV2Xdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TrustLineEntryV1ExtXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -50,4 +59,16 @@ sealed class TrustLineEntryV1ExtXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    when (this) {
+      is Void -> {}
+      is V2 -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
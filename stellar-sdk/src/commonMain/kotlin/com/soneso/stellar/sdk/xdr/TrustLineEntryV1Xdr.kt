@@ -30,10 +30,22 @@ data class TrustLineEntryV1Xdr(
       val ext = TrustLineEntryV1ExtXdr.decode(reader)
       return TrustLineEntryV1Xdr(liabilities, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      LiabilitiesXdr.skip(reader)
+      TrustLineEntryV1ExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     liabilities.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += liabilities.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -65,6 +65,15 @@ data class TrustLineEntryXdr(
       val ext = TrustLineEntryExtXdr.decode(reader)
       return TrustLineEntryXdr(accountId, asset, balance, limit, flags, ext)
     }
+
+    fun skip(reader: XdrReader) {
+      AccountIDXdr.skip(reader)
+      TrustLineAssetXdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Int64Xdr.skip(reader)
+      Uint32Xdr.skip(reader)
+      TrustLineEntryExtXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -75,4 +84,15 @@ data class TrustLineEntryXdr(
     flags.encode(writer)
     ext.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += accountId.encodedSize()
+    size += asset.encodedSize()
+    size += balance.encodedSize()
+    size += limit.encodedSize()
+    size += flags.encodedSize()
+    size += ext.encodedSize()
+    return size
+  }
 }
@@ -22,6 +22,11 @@ data class TxSetComponentTxsMaybeDiscountedFeeXdr(
       val txs = List(reader.readInt()) { TransactionEnvelopeXdr.decode(reader) }
       return TxSetComponentTxsMaybeDiscountedFeeXdr(baseFee, txs)
     }
+
+    fun skip(reader: XdrReader) {
+      if (reader.readBoolean()) Int64Xdr.skip(reader)
+      repeat(reader.readInt()) { TransactionEnvelopeXdr.skip(reader) }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -36,4 +41,19 @@ data class TxSetComponentTxsMaybeDiscountedFeeXdr(
       item.encode(writer)
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    if (baseFee != null) {
+      size += 4
+      size += baseFee.encodedSize()
+    } else {
+      size += 4
+    }
+    size += 4
+    txs.forEach { item ->
+      size += item.encodedSize()
+    }
+    return size
+  }
 }
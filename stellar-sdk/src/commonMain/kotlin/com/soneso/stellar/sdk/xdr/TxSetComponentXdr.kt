@@ -36,6 +36,14 @@ sealed class TxSetComponentXdr {
         else -> throw IllegalArgumentException("Unknown TxSetComponentXdr discriminant: $discriminant")
       }
     }
+
+    fun skip(reader: XdrReader) {
+      val discriminant = TxSetComponentTypeXdr.decode(reader)
+      when (discriminant) {
+        TxSetComponentTypeXdr.TXSET_COMP_TXS_MAYBE_DISCOUNTED_FEE -> TxSetComponentTxsMaybeDiscountedFeeXdr.skip(reader)
+        else -> throw IllegalArgumentException("Unknown TxSetComponentXdr discriminant: $discriminant")
+      }
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -46,4 +54,15 @@ sealed class TxSetComponentXdr {
       }
     }
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += discriminant.encodedSize()
+    when (this) {
+      is TxsMaybeDiscountedFee -> {
+        size += value.encodedSize()
+      }
+    }
+    return size
+  }
 }
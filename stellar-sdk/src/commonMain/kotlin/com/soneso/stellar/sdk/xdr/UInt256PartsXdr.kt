@@ -27,6 +27,13 @@ data class UInt256PartsXdr(
       val loLo = Uint64Xdr.decode(reader)
       return UInt256PartsXdr(hiHi, hiLo, loHi, loLo)
     }
+
+    fun skip(reader: XdrReader) {
+      Uint64Xdr.skip(reader)
+      Uint64Xdr.skip(reader)
+      Uint64Xdr.skip(reader)
+      Uint64Xdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
@@ -35,4 +42,13 @@ data class UInt256PartsXdr(
     loHi.encode(writer)
     loLo.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += hiHi.encodedSize()
+    size += hiLo.encodedSize()
+    size += loHi.encodedSize()
+    size += loLo.encodedSize()
+    return size
+  }
 }
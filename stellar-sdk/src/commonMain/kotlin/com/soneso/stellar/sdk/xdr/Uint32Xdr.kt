@@ -15,9 +15,19 @@ value class Uint32Xdr(val value: UInt) {
       val value = reader.readUnsignedInt()
       return Uint32Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(4)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeUnsignedInt(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 4
+    return size
+  }
 }
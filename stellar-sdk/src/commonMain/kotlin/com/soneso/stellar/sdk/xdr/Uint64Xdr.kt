@@ -15,9 +15,19 @@ value class Uint64Xdr(val value: ULong) {
       val value = reader.readUnsignedLong()
       return Uint64Xdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skip(8)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeUnsignedLong(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += 8
+    return size
+  }
 }
@@ -22,10 +22,22 @@ data class UpgradeEntryMetaXdr(
       val changes = LedgerEntryChangesXdr.decode(reader)
       return UpgradeEntryMetaXdr(upgrade, changes)
     }
+
+    fun skip(reader: XdrReader) {
+      LedgerUpgradeXdr.skip(reader)
+      LedgerEntryChangesXdr.skip(reader)
+    }
   }
 
   fun encode(writer: XdrWriter) {
     upgrade.encode(writer)
     changes.encode(writer)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += upgrade.encodedSize()
+    size += changes.encodedSize()
+    return size
+  }
 }
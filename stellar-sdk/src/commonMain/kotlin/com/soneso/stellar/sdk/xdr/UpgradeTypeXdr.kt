@@ -15,9 +15,25 @@ value class UpgradeTypeXdr(val value: ByteArray) {
       val value = reader.readVariableOpaque()
       return UpgradeTypeXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeVariableOpaque(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrVariableOpaqueSize(value)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun UpgradeTypeXdr?.contentEquals(other: UpgradeTypeXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun UpgradeTypeXdr?.contentHashCode(): Int = this?.value.contentHashCode()
@@ -15,9 +15,25 @@ value class ValueXdr(val value: ByteArray) {
       val value = reader.readVariableOpaque()
       return ValueXdr(value)
     }
+
+    fun skip(reader: XdrReader) {
+      reader.skipVariableOpaque()
+    }
   }
 
   fun encode(writer: XdrWriter) {
     writer.writeVariableOpaque(value)
   }
+
+  fun encodedSize(): Int {
+    var size = 0
+    size += xdrVariableOpaqueSize(value)
+    return size
+  }
 }
+
+/** Compares the wrapped bytes by content, unlike ==. */
+fun ValueXdr?.contentEquals(other: ValueXdr?): Boolean = this?.value.contentEquals(other?.value)
+
+/** Hash code of the wrapped bytes, consistent with [contentEquals]. */
+fun ValueXdr?.contentHashCode(): Int = this?.value.contentHashCode()
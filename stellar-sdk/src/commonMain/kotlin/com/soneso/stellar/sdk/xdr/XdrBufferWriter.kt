@@ -0,0 +1,124 @@
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * XDR writer backed by a primitive, doubling [ByteArray], or by a chunk buffer that is
+ * handed to an [XdrSink] whenever it fills up. Backs [XdrWriter] on native and JS.
+ *
+ * Opaque data and strings are copied in bulk with [copyInto]; no byte is ever boxed.
+ * [toByteArray] returns a trimmed copy, so callers never share the backing array.
+ */
+internal class XdrBufferWriter private constructor(
+    private var buffer: ByteArray,
+    private val sink: XdrSink?
+) {
+    private var position = 0
+
+    constructor(initialCapacity: Int = INITIAL_CAPACITY) : this(ByteArray(initialCapacity), null)
+
+    constructor(sink: XdrSink) : this(ByteArray(XDR_SINK_CHUNK_SIZE), sink)
+
+    fun writeInt(value: Int) {
+        ensureCapacity(4)
+        val buf = buffer
+        val pos = position
+        buf[pos] = (value shr 24).toByte()
+        buf[pos + 1] = (value shr 16).toByte()
+        buf[pos + 2] = (value shr 8).toByte()
+        buf[pos + 3] = value.toByte()
+        position = pos + 4
+        drainIfFull()
+    }
+
+    fun writeUnsignedInt(value: UInt) = writeInt(value.toInt())
+
+    fun writeLong(value: Long) {
+        writeInt((value shr 32).toInt())
+        writeInt(value.toInt())
+    }
+
+    fun writeUnsignedLong(value: ULong) = writeLong(value.toLong())
+
+    fun writeFloat(value: Float) = writeInt(value.toBits())
+
+    fun writeDouble(value: Double) = writeLong(value.toBits())
+
+    fun writeBoolean(value: Boolean) = writeInt(if (value) 1 else 0)
+
+    fun writeString(value: String) {
+        val bytes = xdrEncodeUtf8(value)
+        writeInt(bytes.size)
+        writePadded(bytes)
+    }
+
+    fun writeFixedOpaque(value: ByteArray, expectedLength: Int? = null) {
+        expectedLength?.let {
+            require(value.size == it) { "Expected $it bytes, got ${value.size}" }
+        }
+        writePadded(value)
+    }
+
+    fun writeVariableOpaque(value: ByteArray) {
+        writeInt(value.size)
+        writeFixedOpaque(value)
+    }
+
+    fun flush() {
+        // Pushes pending bytes to the sink; no-op for in-memory buffer
+        if (sink != null) drain()
+    }
+
+    fun toByteArray(): ByteArray {
+        check(sink == null) { "XdrWriter writes to a sink; call flush() instead of toByteArray()" }
+        return buffer.copyOf(position)
+    }
+
+    /**
+     * Bulk-copies [bytes] followed by zero padding up to the next 4-byte boundary.
+     */
+    private fun writePadded(bytes: ByteArray) {
+        val padding = (4 - (bytes.size % 4)) % 4
+        val currentSink = sink
+        if (currentSink != null && bytes.size >= XDR_SINK_CHUNK_SIZE) {
+            // Large payloads bypass the chunk buffer entirely
+            drain()
+            currentSink.write(bytes, 0, bytes.size)
+        } else {
+            ensureCapacity(bytes.size + padding)
+            bytes.copyInto(buffer, position)
+            position += bytes.size
+        }
+        if (padding > 0) {
+            ensureCapacity(padding)
+            // The buffer may hold stale bytes after a drain, so padding is zeroed explicitly
+            buffer.fill(0, position, position + padding)
+            position += padding
+        }
+        drainIfFull()
+    }
+
+    private fun ensureCapacity(extra: Int) {
+        if (position + extra <= buffer.size) return
+        if (sink != null) {
+            drain()
+            if (extra <= buffer.size) return
+        }
+        val required = position + extra
+        var newCapacity = buffer.size * 2
+        if (newCapacity < required) newCapacity = required
+        buffer = buffer.copyOf(newCapacity)
+    }
+
+    private fun drainIfFull() {
+        if (sink != null && position >= XDR_SINK_CHUNK_SIZE) drain()
+    }
+
+    private fun drain() {
+        if (position == 0) return
+        sink?.write(buffer, 0, position)
+        position = 0
+    }
+
+    private companion object {
+        const val INITIAL_CAPACITY = 256
+    }
+}
@@ -1,7 +1,7 @@
 package com.soneso.stellar.sdk.xdr
 
-import kotlin.io.encoding.Base64
-import kotlin.io.encoding.ExperimentalEncodingApi
+import com.soneso.stellar.sdk.decodeBase64
+import com.soneso.stellar.sdk.encodeBase64
 
 /**
  * Extension functions for converting XDR types to/from base64 encoded strings.
@@ -15,11 +15,10 @@ import kotlin.io.encoding.ExperimentalEncodingApi
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerKeyXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -28,9 +27,8 @@ fun LedgerKeyXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded LedgerKeyXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerKeyXdr.Companion.fromXdrBase64(base64: String): LedgerKeyXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -40,11 +38,10 @@ fun LedgerKeyXdr.Companion.fromXdrBase64(base64: String): LedgerKeyXdr {
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionEnvelopeXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -53,9 +50,8 @@ fun TransactionEnvelopeXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded TransactionEnvelopeXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionEnvelopeXdr.Companion.fromXdrBase64(base64: String): TransactionEnvelopeXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -65,11 +61,10 @@ fun TransactionEnvelopeXdr.Companion.fromXdrBase64(base64: String): TransactionE
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerEntryDataXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -78,9 +73,8 @@ fun LedgerEntryDataXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded LedgerEntryDataXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerEntryDataXdr.Companion.fromXdrBase64(base64: String): LedgerEntryDataXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -90,11 +84,10 @@ fun LedgerEntryDataXdr.Companion.fromXdrBase64(base64: String): LedgerEntryDataX
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SorobanTransactionDataXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -103,9 +96,8 @@ fun SorobanTransactionDataXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded SorobanTransactionDataXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SorobanTransactionDataXdr.Companion.fromXdrBase64(base64: String): SorobanTransactionDataXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -115,11 +107,10 @@ fun SorobanTransactionDataXdr.Companion.fromXdrBase64(base64: String): SorobanTr
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SorobanAuthorizationEntryXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -128,9 +119,8 @@ fun SorobanAuthorizationEntryXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded SorobanAuthorizationEntryXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SorobanAuthorizationEntryXdr.Companion.fromXdrBase64(base64: String): SorobanAuthorizationEntryXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -140,11 +130,10 @@ fun SorobanAuthorizationEntryXdr.Companion.fromXdrBase64(base64: String): Soroba
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionResultXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -153,9 +142,8 @@ fun TransactionResultXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded TransactionResultXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionResultXdr.Companion.fromXdrBase64(base64: String): TransactionResultXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -165,23 +153,23 @@ fun TransactionResultXdr.Companion.fromXdrBase64(base64: String): TransactionRes
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionMetaXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
  * Decodes a TransactionMetaXdr from a base64 string.
  *
+ * The payload can be megabytes, so it is decoded straight from the Base64 text
+ * through a [Base64XdrSource] rather than from a fully decoded byte array.
+ *
  * @param base64 Base64-encoded XDR string
  * @return Decoded TransactionMetaXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionMetaXdr.Companion.fromXdrBase64(base64: String): TransactionMetaXdr {
-    val bytes = Base64.decode(base64)
-    val reader = XdrReader(bytes)
+    val reader = XdrReader(Base64XdrSource(base64))
     return decode(reader)
 }
 
@@ -190,11 +178,10 @@ fun TransactionMetaXdr.Companion.fromXdrBase64(base64: String): TransactionMetaX
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun DiagnosticEventXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -203,9 +190,8 @@ fun DiagnosticEventXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded DiagnosticEventXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun DiagnosticEventXdr.Companion.fromXdrBase64(base64: String): DiagnosticEventXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -215,11 +201,10 @@ fun DiagnosticEventXdr.Companion.fromXdrBase64(base64: String): DiagnosticEventX
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun ContractEventXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -228,9 +213,8 @@ fun ContractEventXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded ContractEventXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun ContractEventXdr.Companion.fromXdrBase64(base64: String): ContractEventXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -240,11 +224,10 @@ fun ContractEventXdr.Companion.fromXdrBase64(base64: String): ContractEventXdr {
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerEntryXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -253,9 +236,8 @@ fun LedgerEntryXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded LedgerEntryXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerEntryXdr.Companion.fromXdrBase64(base64: String): LedgerEntryXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -265,11 +247,10 @@ fun LedgerEntryXdr.Companion.fromXdrBase64(base64: String): LedgerEntryXdr {
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SCValXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -278,9 +259,8 @@ fun SCValXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded SCValXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun SCValXdr.Companion.fromXdrBase64(base64: String): SCValXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -290,11 +270,10 @@ fun SCValXdr.Companion.fromXdrBase64(base64: String): SCValXdr {
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerHeaderHistoryEntryXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -303,9 +282,8 @@ fun LedgerHeaderHistoryEntryXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded LedgerHeaderHistoryEntryXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerHeaderHistoryEntryXdr.Companion.fromXdrBase64(base64: String): LedgerHeaderHistoryEntryXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -315,23 +293,23 @@ fun LedgerHeaderHistoryEntryXdr.Companion.fromXdrBase64(base64: String): LedgerH
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerCloseMetaXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
  * Decodes a LedgerCloseMetaXdr from a base64 string.
  *
+ * The payload can be megabytes, so it is decoded straight from the Base64 text
+ * through a [Base64XdrSource] rather than from a fully decoded byte array.
+ *
  * @param base64 Base64-encoded XDR string
  * @return Decoded LedgerCloseMetaXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun LedgerCloseMetaXdr.Companion.fromXdrBase64(base64: String): LedgerCloseMetaXdr {
-    val bytes = Base64.decode(base64)
-    val reader = XdrReader(bytes)
+    val reader = XdrReader(Base64XdrSource(base64))
     return decode(reader)
 }
 
@@ -340,11 +318,10 @@ fun LedgerCloseMetaXdr.Companion.fromXdrBase64(base64: String): LedgerCloseMetaX
  *
  * @return Base64-encoded XDR representation
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionEventXdr.toXdrBase64(): String {
-    val writer = XdrWriter()
+    val writer = XdrWriter(encodedSize())
     encode(writer)
-    return Base64.encode(writer.toByteArray())
+    return encodeBase64(writer.toByteArray())
 }
 
 /**
@@ -353,9 +330,8 @@ fun TransactionEventXdr.toXdrBase64(): String {
  * @param base64 Base64-encoded XDR string
  * @return Decoded TransactionEventXdr object
  */
-@OptIn(ExperimentalEncodingApi::class)
 fun TransactionEventXdr.Companion.fromXdrBase64(base64: String): TransactionEventXdr {
-    val bytes = Base64.decode(base64)
+    val bytes = decodeBase64(base64)
     val reader = XdrReader(bytes)
     return decode(reader)
 }
@@ -0,0 +1,160 @@
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Partial decoders for XDR values that are usually inspected for a handful of fields only.
+ *
+ * They walk the encoding with the generated `skip` functions and materialize just the
+ * fields they return, so everything else is passed over without allocation. Decoding
+ * stops as soon as the requested fields have been read; the reader is not positioned
+ * at the end of the value afterwards.
+ */
+
+/**
+ * Accounts referenced by a transaction envelope, as read by
+ * [TransactionEnvelopeXdr.Companion.decodeAccounts].
+ *
+ * @property feeSource The fee source of a fee bump envelope, null otherwise
+ * @property sourceAccount The source account of the (inner) transaction
+ * @property memo The memo of the (inner) transaction
+ * @property operations The accounts of each operation, in transaction order
+ */
+data class EnvelopeAccounts(
+    val feeSource: MuxedAccountXdr?,
+    val sourceAccount: MuxedAccountXdr,
+    val memo: MemoXdr,
+    val operations: List<OperationAccounts>
+)
+
+/**
+ * Accounts referenced by a single operation.
+ *
+ * @property type The operation type
+ * @property sourceAccount The operation's own source account, if it overrides the transaction's
+ * @property destination The receiving account of payment, path payment and account merge operations
+ */
+data class OperationAccounts(
+    val type: OperationTypeXdr,
+    val sourceAccount: MuxedAccountXdr?,
+    val destination: MuxedAccountXdr?
+)
+
+/**
+ * Reads only the fee source, source account, memo and per-operation source and destination
+ * accounts of an encoded transaction envelope, skipping everything else.
+ *
+ * @param reader Reader positioned at the start of a TransactionEnvelope
+ * @return The accounts referenced by the envelope
+ * @throws IllegalArgumentException if the envelope type is unknown
+ */
+fun TransactionEnvelopeXdr.Companion.decodeAccounts(reader: XdrReader): EnvelopeAccounts {
+    return when (val envelopeType = EnvelopeTypeXdr.decode(reader)) {
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX_V0 -> {
+            val sourceAccount = MuxedAccountXdr.Ed25519(Uint256Xdr.decode(reader))
+            Uint32Xdr.skip(reader)
+            SequenceNumberXdr.skip(reader)
+            if (reader.readBoolean()) TimeBoundsXdr.skip(reader)
+            decodeTransactionAccounts(reader, null, sourceAccount)
+        }
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX -> decodeV1TransactionAccounts(reader, null)
+        EnvelopeTypeXdr.ENVELOPE_TYPE_TX_FEE_BUMP -> {
+            val feeSource = MuxedAccountXdr.decode(reader)
+            Int64Xdr.skip(reader)
+            val innerType = EnvelopeTypeXdr.decode(reader)
+            require(innerType == EnvelopeTypeXdr.ENVELOPE_TYPE_TX) {
+                "Unknown FeeBumpTransactionInnerTxXdr discriminant: $innerType"
+            }
+            decodeV1TransactionAccounts(reader, feeSource)
+        }
+        else -> throw IllegalArgumentException("Unknown TransactionEnvelopeXdr discriminant: $envelopeType")
+    }
+}
+
+/**
+ * Reads only the Soroban return value of an encoded transaction meta, skipping the ledger
+ * entry changes and operation meta in front of it.
+ *
+ * @param reader Reader positioned at the start of a TransactionMeta
+ * @return The return value, or null if the meta version carries none
+ * @throws IllegalArgumentException if the meta version is unknown
+ */
+fun TransactionMetaXdr.Companion.decodeReturnValue(reader: XdrReader): SCValXdr? {
+    return when (val version = reader.readInt()) {
+        0, 1, 2 -> null
+        3 -> {
+            ExtensionPointXdr.skip(reader)
+            LedgerEntryChangesXdr.skip(reader)
+            repeat(reader.readInt()) { OperationMetaXdr.skip(reader) }
+            LedgerEntryChangesXdr.skip(reader)
+            if (!reader.readBoolean()) return null
+            SorobanTransactionMetaExtXdr.skip(reader)
+            repeat(reader.readInt()) { ContractEventXdr.skip(reader) }
+            SCValXdr.decode(reader)
+        }
+        4 -> {
+            ExtensionPointXdr.skip(reader)
+            LedgerEntryChangesXdr.skip(reader)
+            repeat(reader.readInt()) { OperationMetaV2Xdr.skip(reader) }
+            LedgerEntryChangesXdr.skip(reader)
+            if (!reader.readBoolean()) return null
+            SorobanTransactionMetaExtXdr.skip(reader)
+            if (reader.readBoolean()) SCValXdr.decode(reader) else null
+        }
+        else -> throw IllegalArgumentException("Unknown TransactionMetaXdr discriminant: $version")
+    }
+}
+
+private fun decodeV1TransactionAccounts(reader: XdrReader, feeSource: MuxedAccountXdr?): EnvelopeAccounts {
+    val sourceAccount = MuxedAccountXdr.decode(reader)
+    Uint32Xdr.skip(reader)
+    SequenceNumberXdr.skip(reader)
+    PreconditionsXdr.skip(reader)
+    return decodeTransactionAccounts(reader, feeSource, sourceAccount)
+}
+
+/**
+ * Reads the memo and operations shared by v0 and v1 transactions.
+ */
+private fun decodeTransactionAccounts(
+    reader: XdrReader,
+    feeSource: MuxedAccountXdr?,
+    sourceAccount: MuxedAccountXdr
+): EnvelopeAccounts {
+    val memo = MemoXdr.decode(reader)
+    val operations = List(reader.readInt()) {
+        val operationSource = if (reader.readBoolean()) MuxedAccountXdr.decode(reader) else null
+        // The body type is peeked so that bodies without a destination can be skipped whole
+        val typeValue = reader.peekInt()
+        val type = OperationTypeXdr.entries.find { it.value == typeValue }
+            ?: throw IllegalArgumentException("Unknown OperationTypeXdr value: $typeValue")
+        val destination = when (type) {
+            OperationTypeXdr.PAYMENT -> {
+                reader.skip(4)
+                val destination = MuxedAccountXdr.decode(reader)
+                AssetXdr.skip(reader)
+                Int64Xdr.skip(reader)
+                destination
+            }
+            OperationTypeXdr.PATH_PAYMENT_STRICT_RECEIVE, OperationTypeXdr.PATH_PAYMENT_STRICT_SEND -> {
+                // Both path payments share the layout: asset, amount, destination, asset, amount, path
+                reader.skip(4)
+                AssetXdr.skip(reader)
+                Int64Xdr.skip(reader)
+                val destination = MuxedAccountXdr.decode(reader)
+                AssetXdr.skip(reader)
+                Int64Xdr.skip(reader)
+                repeat(reader.readInt()) { AssetXdr.skip(reader) }
+                destination
+            }
+            OperationTypeXdr.ACCOUNT_MERGE -> {
+                reader.skip(4)
+                MuxedAccountXdr.decode(reader)
+            }
+            else -> {
+                OperationBodyXdr.skip(reader)
+                null
+            }
+        }
+        OperationAccounts(type, operationSource, destination)
+    }
+    return EnvelopeAccounts(feeSource, sourceAccount, memo, operations)
+}
@@ -12,3 +12,81 @@ fun Float.encode(writer: XdrWriter) = writer.writeFloat(this)
 fun Double.encode(writer: XdrWriter) = writer.writeDouble(this)
 fun Boolean.encode(writer: XdrWriter) = writer.writeBoolean(this)
 fun String.encode(writer: XdrWriter) = writer.writeString(this)
+
+// Encoded sizes of primitive types, mirroring the encode functions above
+fun Int.encodedSize(): Int = 4
+fun UInt.encodedSize(): Int = 4
+fun Long.encodedSize(): Int = 8
+fun ULong.encodedSize(): Int = 8
+fun Float.encodedSize(): Int = 4
+fun Double.encodedSize(): Int = 8
+fun Boolean.encodedSize(): Int = 4
+fun String.encodedSize(): Int = xdrStringSize(this)
+
+/** Rounds [length] up to the next multiple of four, the XDR padding unit. */
+internal fun xdrPaddedSize(length: Int): Int = (length + 3) and 3.inv()
+
+/** Encoded size of a variable-length opaque: length prefix plus padded bytes. */
+internal fun xdrVariableOpaqueSize(value: ByteArray): Int = 4 + xdrPaddedSize(value.size)
+
+/** Encoded size of an XDR string, counting its UTF-8 bytes (see [xdrEncodeUtf8]) without encoding it. */
+internal fun xdrStringSize(value: String): Int = 4 + xdrPaddedSize(utf8Length(value))
+
+private fun utf8Length(value: String): Int {
+  var length = 0
+  var i = 0
+  while (i < value.length) {
+    val c = value[i]
+    length += when {
+      c.code < 0x80 -> 1
+      c.code < 0x800 -> 2
+      c.isHighSurrogate() && i + 1 < value.length && value[i + 1].isLowSurrogate() -> {
+        i++
+        4
+      }
+      else -> 3
+    }
+    i++
+  }
+  return length
+}
+
+/**
+ * Encodes [value] as UTF-8, replacing unpaired surrogates with U+FFFD on every platform.
+ * The result is always [utf8Length] bytes; `encodeToByteArray()` writes `?` for them on the JVM.
+ */
+internal fun xdrEncodeUtf8(value: String): ByteArray {
+  val bytes = ByteArray(utf8Length(value))
+  var position = 0
+  var i = 0
+  while (i < value.length) {
+    val c = value[i]
+    var code = c.code
+    if (c.isHighSurrogate() && i + 1 < value.length && value[i + 1].isLowSurrogate()) {
+      i++
+      code = 0x10000 + ((code - 0xD800) shl 10) + (value[i].code - 0xDC00)
+    } else if (c.isSurrogate()) {
+      code = 0xFFFD
+    }
+    when {
+      code < 0x80 -> bytes[position++] = code.toByte()
+      code < 0x800 -> {
+        bytes[position++] = (0xC0 or (code shr 6)).toByte()
+        bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+      }
+      code < 0x10000 -> {
+        bytes[position++] = (0xE0 or (code shr 12)).toByte()
+        bytes[position++] = (0x80 or ((code shr 6) and 0x3F)).toByte()
+        bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+      }
+      else -> {
+        bytes[position++] = (0xF0 or (code shr 18)).toByte()
+        bytes[position++] = (0x80 or ((code shr 12) and 0x3F)).toByte()
+        bytes[position++] = (0x80 or ((code shr 6) and 0x3F)).toByte()
+        bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+      }
+    }
+    i++
+  }
+  return bytes
+}
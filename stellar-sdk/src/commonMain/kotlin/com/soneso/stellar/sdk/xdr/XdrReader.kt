@@ -1,14 +1,207 @@
 package com.soneso.stellar.sdk.xdr
 
-expect class XdrReader(input: ByteArray) {
-    fun readInt(): Int
-    fun readUnsignedInt(): UInt
-    fun readLong(): Long
-    fun readUnsignedLong(): ULong
-    fun readFloat(): Float
-    fun readDouble(): Double
-    fun readBoolean(): Boolean
-    fun readString(): String
-    fun readFixedOpaque(length: Int): ByteArray
-    fun readVariableOpaque(): ByteArray
+/**
+ * Origin of bytes for an [XdrReader] created with a source.
+ *
+ * Lets large XDR values be decoded while their encoding is still being produced (for example
+ * by a Base64 decoder or a network stream) instead of being collected into one array first.
+ */
+fun interface XdrSource {
+    /**
+     * Reads up to [length] bytes into [buffer] starting at [offset]. Returns the number of bytes
+     * read, which is at least one unless [length] is zero, or -1 once the source is exhausted.
+     */
+    fun read(buffer: ByteArray, offset: Int, length: Int): Int
 }
+
+/**
+ * XDR reader over an in-memory array, or over a window of an [XdrSource] that is
+ * refilled as decoding advances.
+ *
+ * Input that ends early, or a negative length, fails with [IndexOutOfBoundsException] on every
+ * platform. On the JVM this replaces the `java.io.EOFException` of the former
+ * `DataInputStream`-based reader.
+ */
+class XdrReader private constructor(
+    private var data: ByteArray,
+    private var limit: Int,
+    private val source: XdrSource?
+) {
+    private var offset = 0
+    // Bytes dropped from the front of a source window, so that position stays absolute
+    private var discarded = 0
+
+    constructor(input: ByteArray) : this(input, input.size, null)
+
+    /**
+     * Creates a reader that pulls its input from [source] as decoding advances, buffering only
+     * a small window of it. Slices read from such a reader own a copy of their bytes.
+     */
+    constructor(source: XdrSource) : this(ByteArray(XDR_SOURCE_CHUNK_SIZE), 0, source)
+
+    /**
+     * Number of input bytes consumed so far.
+     */
+    val position: Int
+        get() = discarded + offset
+
+    fun readInt(): Int {
+        ensureAvailable(4)
+        val value = ((data[offset].toInt() and 0xFF) shl 24) or
+                    ((data[offset + 1].toInt() and 0xFF) shl 16) or
+                    ((data[offset + 2].toInt() and 0xFF) shl 8) or
+                    (data[offset + 3].toInt() and 0xFF)
+        offset += 4
+        return value
+    }
+
+    fun readUnsignedInt(): UInt = readInt().toUInt()
+
+    fun readLong(): Long {
+        val high = readInt().toLong()
+        val low = readInt().toLong() and 0xFFFFFFFFL
+        return (high shl 32) or low
+    }
+
+    fun readUnsignedLong(): ULong = readLong().toULong()
+
+    fun readFloat(): Float = Float.fromBits(readInt())
+
+    fun readDouble(): Double = Double.fromBits(readLong())
+
+    fun readBoolean(): Boolean = readInt() != 0
+
+    fun readString(): String {
+        val length = readInt()
+        ensureAvailable(length)
+        val value = data.decodeToString(offset, offset + length)
+        skipPadded(length)
+        return value
+    }
+
+    fun readFixedOpaque(length: Int): ByteArray {
+        ensureAvailable(length)
+        val bytes = data.copyOfRange(offset, offset + length)
+        skipPadded(length)
+        return bytes
+    }
+
+    fun readVariableOpaque(): ByteArray {
+        val length = readInt()
+        return readFixedOpaque(length)
+    }
+
+    /**
+     * Reads fixed-length opaque data as an [XdrSlice] borrowed from the input, without copying.
+     */
+    fun readFixedOpaqueSlice(length: Int): XdrSlice {
+        ensureAvailable(length)
+        // A streaming window is overwritten on refill, so slices of it must own their bytes
+        val slice = if (source == null) {
+            XdrSlice(data, offset, length)
+        } else {
+            XdrSlice(data.copyOfRange(offset, offset + length), 0, length)
+        }
+        skipPadded(length)
+        return slice
+    }
+
+    /**
+     * Reads variable-length opaque data as an [XdrSlice] borrowed from the input, without copying.
+     */
+    fun readVariableOpaqueSlice(): XdrSlice {
+        val length = readInt()
+        return readFixedOpaqueSlice(length)
+    }
+
+    /**
+     * Returns the next int, such as a union discriminant, without consuming it.
+     */
+    fun peekInt(): Int {
+        val value = readInt()
+        offset -= 4
+        return value
+    }
+
+    /**
+     * Advances past [length] bytes of input without reading them.
+     */
+    fun skip(length: Int) {
+        if (length < 0) throw IndexOutOfBoundsException("Negative XDR length: $length")
+        val buffered = limit - offset
+        if (length <= buffered || source == null) {
+            ensureAvailable(length)
+            offset += length
+            return
+        }
+        // Large skips over a source are discarded chunk by chunk instead of being buffered
+        var remaining = length - buffered
+        discarded += offset + length
+        offset = 0
+        limit = 0
+        while (remaining > 0) {
+            val read = source.read(data, 0, minOf(remaining, data.size))
+            if (read < 0) throw IndexOutOfBoundsException("XDR input too short: $remaining bytes missing")
+            remaining -= read
+        }
+    }
+
+    /**
+     * Advances past fixed-length opaque data of [length] bytes and its padding.
+     */
+    fun skipFixedOpaque(length: Int) {
+        if (length < 0) throw IndexOutOfBoundsException("Negative XDR length: $length")
+        skip(length + (4 - (length % 4)) % 4)
+    }
+
+    /**
+     * Advances past variable-length opaque data or a string, including its length prefix and padding.
+     */
+    fun skipVariableOpaque() {
+        val length = readInt()
+        skipFixedOpaque(length)
+    }
+
+    /**
+     * Advances past [length] bytes of data plus padding to the next 4-byte boundary.
+     */
+    private fun skipPadded(length: Int) {
+        val padding = (4 - (length % 4)) % 4
+        if (source != null) ensureAvailable(length + padding)
+        offset += length + padding
+    }
+
+    private fun ensureAvailable(length: Int) {
+        if (length >= 0 && length <= limit - offset) return
+        if (length < 0 || source == null) {
+            throw IndexOutOfBoundsException("XDR input too short: need $length bytes at offset $offset, size $limit")
+        }
+        fill(length)
+    }
+
+    /**
+     * Moves the unread bytes to the front of the window, growing it if needed, and reads
+     * from the source until at least [length] bytes are buffered.
+     */
+    private fun fill(length: Int) {
+        val source = checkNotNull(source)
+        val window = if (length > data.size) ByteArray(maxOf(length, data.size * 2)) else data
+        data.copyInto(window, 0, offset, limit)
+        data = window
+        discarded += offset
+        limit -= offset
+        offset = 0
+        while (limit < length) {
+            val read = source.read(data, limit, data.size - limit)
+            if (read < 0) {
+                throw IndexOutOfBoundsException("XDR input too short: need $length bytes, source ended after $limit")
+            }
+            limit += read
+        }
+    }
+}
+
+/**
+ * Number of bytes a source-backed [XdrReader] initially requests from its [XdrSource] at a time.
+ */
+internal const val XDR_SOURCE_CHUNK_SIZE = 8192
@@ -0,0 +1,80 @@
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only view over a range of an XDR input buffer.
+ *
+ * Returned by [XdrReader.readFixedOpaqueSlice] and [XdrReader.readVariableOpaqueSlice] so
+ * that hashes, keys and blobs can be inspected, compared or skipped without copying them.
+ * The bytes are only copied when [toByteArray] is called.
+ *
+ * A slice borrows the reader's input array: it stays valid as long as that array is not
+ * modified. Equality and hash code are based on content.
+ *
+ * @property size Number of bytes in the slice (padding excluded)
+ */
+class XdrSlice internal constructor(
+    private val source: ByteArray,
+    private val offset: Int,
+    val size: Int
+) {
+    init {
+        require(offset >= 0 && size >= 0 && offset + size <= source.size) { "Slice out of bounds" }
+    }
+
+    /**
+     * Returns the byte at [index] within the slice.
+     */
+    operator fun get(index: Int): Byte {
+        if (index < 0 || index >= size) throw IndexOutOfBoundsException("Index $index out of bounds for size $size")
+        return source[offset + index]
+    }
+
+    /**
+     * Copies the slice into a new array.
+     */
+    fun toByteArray(): ByteArray = source.copyOfRange(offset, offset + size)
+
+    /**
+     * Copies the slice into [destination] starting at [destinationOffset].
+     */
+    fun copyInto(destination: ByteArray, destinationOffset: Int = 0): ByteArray =
+        source.copyInto(destination, destinationOffset, offset, offset + size)
+
+    /**
+     * Decodes the slice as UTF-8 without an intermediate copy.
+     */
+    fun decodeToString(): String = source.decodeToString(offset, offset + size)
+
+    /**
+     * Returns true if the slice holds exactly the bytes of [other].
+     */
+    fun contentEquals(other: ByteArray): Boolean {
+        if (other.size != size) return false
+        for (i in 0 until size) {
+            if (source[offset + i] != other[i]) return false
+        }
+        return true
+    }
+
+    override fun equals(other: Any?): Boolean {
+        if (this === other) return true
+        if (other !is XdrSlice || other.size != size) return false
+        for (i in 0 until size) {
+            if (source[offset + i] != other.source[other.offset + i]) return false
+        }
+        return true
+    }
+
+    /**
+     * Same value as [ByteArray.contentHashCode] of [toByteArray].
+     */
+    override fun hashCode(): Int {
+        var result = 1
+        for (i in offset until offset + size) {
+            result = 31 * result + source[i]
+        }
+        return result
+    }
+
+    override fun toString(): String = "XdrSlice(size=$size)"
+}
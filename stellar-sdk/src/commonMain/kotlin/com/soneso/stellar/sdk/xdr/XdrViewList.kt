@@ -0,0 +1,65 @@
+package com.soneso.stellar.sdk.xdr
+
+/**
+ * Read-only list of views over the elements of an encoded XDR variable-length array.
+ *
+ * Returned by the generated `*XdrView` classes for array members. Creating the list reads
+ * only the element count; element offsets are found once, on first element access, by
+ * skipping over the encoding. Each element view then decodes its own members on access.
+ *
+ * @property endOffset Offset of the first byte after the encoded array
+ */
+class XdrViewList<T> internal constructor(
+    private val buffer: ByteArray,
+    private val offset: Int,
+    private val skipElement: (XdrReader) -> Unit,
+    private val createView: (ByteArray, Int) -> T
+) : AbstractList<T>() {
+    override val size: Int = decodeXdrAt(buffer, offset) { reader -> reader.readInt() }
+
+    private var elementOffsets: IntArray? = null
+
+    init {
+        if (size < 0) throw IndexOutOfBoundsException("Negative XDR array length: $size")
+        // Every element takes at least four bytes, which bounds a corrupt count before allocating for it
+        if (size > (buffer.size - offset - 4) / 4) {
+            throw IndexOutOfBoundsException("XDR input too short: $size elements at offset $offset, size ${buffer.size}")
+        }
+    }
+
+    val endOffset: Int
+        get() = elementOffsets()[size]
+
+    override fun get(index: Int): T {
+        if (index < 0 || index >= size) throw IndexOutOfBoundsException("Index $index out of bounds for size $size")
+        return createView(buffer, elementOffsets()[index])
+    }
+
+    private fun elementOffsets(): IntArray {
+        elementOffsets?.let { return it }
+        val reader = xdrReaderAt(buffer, offset + 4)
+        val offsets = IntArray(size + 1)
+        for (i in 0 until size) {
+            offsets[i] = reader.position
+            skipElement(reader)
+        }
+        offsets[size] = reader.position
+        elementOffsets = offsets
+        return offsets
+    }
+}
+
+/**
+ * Creates a reader over [buffer] positioned at [offset].
+ */
+internal fun xdrReaderAt(buffer: ByteArray, offset: Int): XdrReader {
+    val reader = XdrReader(buffer)
+    reader.skip(offset)
+    return reader
+}
+
+/**
+ * Decodes a value from [buffer] starting at [offset]; used by the generated views.
+ */
+internal inline fun <T> decodeXdrAt(buffer: ByteArray, offset: Int, decode: (XdrReader) -> T): T =
+    decode(xdrReaderAt(buffer, offset))
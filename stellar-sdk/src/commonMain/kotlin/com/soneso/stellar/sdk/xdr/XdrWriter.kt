@@ -1,6 +1,33 @@
 package com.soneso.stellar.sdk.xdr
 
+/**
+ * Destination for bytes produced by an [XdrWriter] created with a sink.
+ *
+ * Lets encoded XDR be consumed incrementally (for example fed into a SHA-256 hasher)
+ * instead of being collected into one array first.
+ */
+fun interface XdrSink {
+    /**
+     * Consumes [length] bytes of [bytes] starting at [offset]. The array may be reused by the
+     * writer after this call returns, so implementations must not keep a reference to it.
+     */
+    fun write(bytes: ByteArray, offset: Int, length: Int)
+}
+
 expect class XdrWriter() {
+    /**
+     * Creates an in-memory writer whose buffer starts at [initialCapacity] bytes. Pass the
+     * value's `encodedSize()` to encode it without any intermediate buffer growth.
+     */
+    constructor(initialCapacity: Int)
+
+    /**
+     * Creates a writer that forwards its output to [sink] in chunks instead of keeping it.
+     * Call [flush] after encoding to push the remaining buffered bytes; [toByteArray]
+     * is not available on such a writer.
+     */
+    constructor(sink: XdrSink)
+
     fun writeInt(value: Int)
     fun writeUnsignedInt(value: UInt)
     fun writeLong(value: Long)
@@ -14,3 +41,8 @@ expect class XdrWriter() {
     fun flush()
     fun toByteArray(): ByteArray
 }
+
+/**
+ * Number of bytes a sink-backed [XdrWriter] buffers before handing them to its [XdrSink].
+ */
+internal const val XDR_SINK_CHUNK_SIZE = 4096
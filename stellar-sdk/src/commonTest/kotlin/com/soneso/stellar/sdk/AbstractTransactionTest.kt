@@ -0,0 +1,133 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.flow.asFlow
+import kotlinx.coroutines.flow.flow
+import kotlinx.coroutines.flow.map
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class AbstractTransactionTest {
+
+    private suspend fun createTransaction(): Transaction {
+        val source = KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS")
+        val transaction = TransactionBuilder(Account(source.getAccountId(), 2908908335136768L), Network.TESTNET)
+            .addOperation(
+                PaymentOperation(
+                    destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ",
+                    asset = AssetTypeNative,
+                    amount = "200.0000000"
+                )
+            )
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(10, 11)))
+            .build()
+        transaction.sign(source)
+        return transaction
+    }
+
+    @Test
+    fun testCachedHashFollowsSignatures() = runTest {
+        val inner = createTransaction()
+        val innerHash = inner.hash()
+        val innerEnvelope = inner.toEnvelopeXdrBase64()
+        val feeBump = FeeBumpTransaction.createWithBaseFee(
+            feeSource = "GDQNY3PBOJOKYZSRMK2S7LHHGWZIUISD4QORETLMXEWXBI7KFZZMKTL3",
+            baseFee = AbstractTransaction.MIN_BASE_FEE * 2,
+            innerTransaction = inner
+        )
+        val feeBumpHash = feeBump.hash()
+
+        // Callers get copies, so modifying one cannot corrupt the cache
+        inner.hash()[0] = (innerHash[0] + 1).toByte()
+        assertContentEquals(innerHash, inner.hash())
+        assertContentEquals(Util.hash(inner.signatureBase()), inner.hash())
+
+        // Signing changes the envelope but not the inner hash...
+        inner.sign(KeyPair.random())
+        assertContentEquals(innerHash, inner.hash())
+        assertNotEquals(innerEnvelope, inner.toEnvelopeXdrBase64())
+        assertEquals(2, Transaction.fromEnvelopeXdr(inner.toEnvelopeXdrBase64(), Network.TESTNET).signatures.size)
+
+        // ...while the fee bump signs over the inner signatures
+        assertFalse(feeBumpHash.contentEquals(feeBump.hash()))
+        assertContentEquals(Util.hash(feeBump.signatureBase()), feeBump.hash())
+        inner.signatures.removeAt(1)
+        assertContentEquals(feeBumpHash, feeBump.hash())
+        assertEquals(innerEnvelope, inner.toEnvelopeXdrBase64())
+    }
+
+    @Test
+    fun testSubclassProvidingOnlySignatureBase() = runTest {
+        val inner = createTransaction()
+        // Written as a subclass outside the SDK would be, without the internal payload hooks
+        val custom = object : AbstractTransaction(Network.TESTNET) {
+            override suspend fun signatureBase(): ByteArray = inner.signatureBase()
+            override fun toEnvelopeXdr() = inner.toEnvelopeXdr()
+        }
+
+        assertContentEquals(inner.hash(), custom.hash())
+        assertEquals(inner.hashHex(), custom.hashHex())
+        custom.sign(KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS"))
+        inner.sign(KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS"))
+        assertContentEquals(inner.signatures[0].signature, custom.signatures[0].signature)
+    }
+
+    @Test
+    fun testSignAll() = runTest {
+        val inner = createTransaction()
+        val signers = List(5) { KeyPair.random() }
+        val feeBump = FeeBumpTransaction.createWithBaseFee(
+            feeSource = signers[0].getAccountId(),
+            baseFee = AbstractTransaction.MIN_BASE_FEE * 2,
+            innerTransaction = inner
+        )
+        val serial = FeeBumpTransaction.fromEnvelopeXdrBase64(feeBump.toEnvelopeXdrBase64(), Network.TESTNET)
+
+        feeBump.signAll(signers)
+        signers.forEach { serial.sign(it) }
+
+        // Ed25519 signatures are deterministic, so the concurrent path matches signing one by one
+        assertEquals(serial.signatures, feeBump.signatures)
+        assertEquals(serial.toEnvelopeXdrBase64(), feeBump.toEnvelopeXdrBase64())
+
+        // Nothing is added when one of the signers cannot sign
+        val publicOnly = KeyPair.fromAccountId(signers[1].getAccountId())
+        assertFailsWith<IllegalStateException> { inner.signAll(listOf(signers[0], publicOnly)) }
+        assertEquals(1, inner.signatures.size)
+        inner.signAll(emptyList())
+        assertEquals(1, inner.signatures.size)
+    }
+
+    @Test
+    fun testFromEnvelopeXdrs() = runTest {
+        val inner = createTransaction()
+        val feeBump = FeeBumpTransaction.createWithBaseFee(
+            feeSource = "GDQNY3PBOJOKYZSRMK2S7LHHGWZIUISD4QORETLMXEWXBI7KFZZMKTL3",
+            baseFee = AbstractTransaction.MIN_BASE_FEE * 2,
+            innerTransaction = inner
+        )
+        // Every third envelope is a fee bump; 1000 envelopes leave a partial last chunk
+        val expected = List(1000) { i -> if (i % 3 == 0) feeBump else inner }
+        val envelopes = expected.map { it.toEnvelopeXdrBase64() }
+
+        val decoded = AbstractTransaction.fromEnvelopeXdrs(envelopes.asFlow(), Network.TESTNET, chunkSize = 64, parallelism = 3)
+            .toList()
+        assertEquals(expected, decoded)
+
+        val fromBytes = AbstractTransaction.fromEnvelopeXdrs(
+            envelopes.asFlow().map { decodeBase64(it) }, Network.TESTNET, chunkSize = 7
+        ).toList()
+        assertEquals(expected, fromBytes)
+
+        // Transactions before a malformed envelope are still emitted
+        val emitted = mutableListOf<AbstractTransaction>()
+        assertFails {
+            AbstractTransaction.fromEnvelopeXdrs(flow {
+                envelopes.take(100).forEach { emit(it) }
+                emit("not base64!")
+            }, Network.TESTNET, chunkSize = 16).collect { emitted.add(it) }
+        }
+        assertEquals(expected.take(100), emitted)
+    }
+}
@@ -0,0 +1,114 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.async
+import kotlinx.coroutines.joinAll
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runCurrent
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.yield
+import kotlin.test.*
+
+class ChannelAccountPoolTest {
+
+    private suspend fun build(channel: ChannelAccount): Transaction =
+        TransactionBuilder(channel, Network.TESTNET)
+            .addOperation(
+                PaymentOperation(
+                    destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ",
+                    asset = AssetTypeNative,
+                    amount = "1"
+                )
+            )
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 0)))
+            .build()
+
+    @Test
+    fun testConcurrentLeasesIncrementLocally() = runTest {
+        val channels = List(3) { KeyPair.random() }
+        val loads = mutableListOf<String>()
+        val pool = ChannelAccountPool(channels) { accountId ->
+            loads.add(accountId)
+            1000L
+        }
+        val used = mutableListOf<Pair<String, Long>>()
+
+        (0 until 30).map {
+            launch {
+                pool.withChannel { channel ->
+                    val transaction = build(channel)
+                    // Hold the lease across a suspension, as a real submission would
+                    yield()
+                    used.add(transaction.sourceAccount to transaction.sequenceNumber)
+                }
+            }
+        }.joinAll()
+
+        assertEquals(channels.map { it.getAccountId() }.toSet(), loads.toSet())
+        assertEquals(3, loads.size)
+        assertEquals(30, used.toSet().size)
+        used.groupBy({ it.first }, { it.second }).values.forEach { sequenceNumbers ->
+            assertEquals((1001L..1000L + sequenceNumbers.size).toList(), sequenceNumbers.sorted())
+        }
+    }
+
+    @Test
+    fun testResynchronizesOnlyWhenMarkedStale() = runTest {
+        var networkSequenceNumber = 50L
+        var loads = 0
+        val pool = ChannelAccountPool(listOf(KeyPair.random())) {
+            loads++
+            networkSequenceNumber
+        }
+
+        assertEquals(51L, pool.withChannel { build(it).sequenceNumber })
+        assertEquals(52L, pool.withChannel { build(it).sequenceNumber })
+        assertEquals(1, loads)
+
+        // Another submitter used the account: tx_bad_seq, then reload
+        networkSequenceNumber = 60L
+        pool.withChannel { it.markBadSequence() }
+        assertEquals(61L, pool.withChannel { build(it).sequenceNumber })
+        assertEquals(2, loads)
+
+        // A failed submission leaves the sequence number uncertain
+        assertFailsWith<IllegalStateException> {
+            pool.withChannel<Unit> { build(it); throw IllegalStateException("connection lost") }
+        }
+        assertEquals(61L, pool.withChannel { build(it).sequenceNumber })
+        assertEquals(3, loads)
+    }
+
+    @Test
+    fun testInvalidPools() = runTest {
+        val keypair = KeyPair.random()
+        assertFailsWith<IllegalArgumentException> { ChannelAccountPool(emptyList()) { 0L } }
+        assertFailsWith<IllegalArgumentException> { ChannelAccountPool(listOf(keypair, keypair)) { 0L } }
+
+        val pool = ChannelAccountPool(listOf(keypair)) { 0L }
+        val other = ChannelAccountPool(listOf(KeyPair.random())) { 0L }
+        val channel = other.acquire()
+        assertFailsWith<IllegalArgumentException> { pool.release(channel) }
+        other.release(channel)
+        // A second release would let two coroutines share the sequence number
+        assertFailsWith<IllegalStateException> { other.release(channel) }
+        assertFailsWith<IllegalStateException> { other.release(ChannelAccount(other, KeyPair.random())) }
+    }
+
+    @Test
+    fun testCancelledAcquireKeepsChannel() = runTest {
+        val pool = ChannelAccountPool(listOf(KeyPair.random())) { 0L }
+        val holder = pool.acquire()
+
+        // The channel is handed to the waiting acquire, which is cancelled before it resumes
+        val waiting = async { pool.acquire() }
+        runCurrent()
+        pool.release(holder)
+        waiting.cancel()
+        runCurrent()
+
+        val channel = pool.acquire()
+        assertSame(holder, channel)
+        pool.release(channel)
+    }
+}
@@ -0,0 +1,198 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.horizon.responses.FeeStatsResponse
+import com.soneso.stellar.sdk.rpc.responses.GetFeeStatsResponse
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitCancellation
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.currentTime
+import kotlinx.coroutines.test.runCurrent
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+import kotlin.time.Duration.Companion.seconds
+
+class FeeEscalatorTest {
+
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+
+    private suspend fun transaction(preconditions: TransactionPreconditions? = null, memo: Memo = MemoNone): Transaction {
+        val source = KeyPair.random()
+        val builder = TransactionBuilder(Account(source.getAccountId(), 1L), Network.TESTNET)
+            .addOperation(PaymentOperation(destination, AssetTypeNative, "10"))
+            .addMemo(memo)
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+        if (preconditions != null) builder.addPreconditions(preconditions) else builder.setTimeout(300)
+        val transaction = builder.build()
+        transaction.sign(source)
+        return transaction
+    }
+
+    @Test
+    fun testEscalatesUntilIncluded() = runTest {
+        val feeSource = KeyPair.random()
+        var ledger = 10L
+        val submitted = mutableListOf<FeeBumpTransaction>()
+        val escalator = FeeEscalator(
+            feeSource, maxFee = 1_000_000, escalateAfterLedgers = 2, pollInterval = 5.seconds,
+            loadNetworkFees = { NetworkFees(ledger++, 500) },
+            isIncluded = { submitted.size == 2 },
+            submitTransaction = { submitted.add(it) }
+        )
+        val runner = launch { escalator.run() }
+
+        val transaction = transaction()
+        val escalation = escalator.track(transaction)
+        escalator.close()
+        runner.join()
+
+        assertTrue(escalation.included)
+        assertEquals(2, escalation.feeBumps)
+        // Each bump pays ten times the previous fee per operation, for the payment and the bump
+        assertEquals(listOf(2_000L, 20_000L), submitted.map { it.fee })
+        submitted.forEach { feeBump ->
+            assertEquals(feeSource.getAccountId(), feeBump.feeSource)
+            assertEquals(transaction, feeBump.innerTransaction)
+            assertEquals(1, feeBump.signatures.size)
+        }
+        assertSame(submitted.last(), escalation.transaction)
+    }
+
+    @Test
+    fun testNetworkFeeAndCap() = runTest {
+        var ledger = 10L
+        var polls = 0
+        val submitted = mutableListOf<FeeBumpTransaction>()
+        val escalator = FeeEscalator(
+            KeyPair.random(), maxFee = 20_000, escalateAfterLedgers = 1, pollInterval = 5.seconds,
+            loadNetworkFees = { NetworkFees(ledger++, 5_000) },
+            isIncluded = { ++polls > 6 },
+            submitTransaction = { submitted.add(it) }
+        )
+        val runner = launch { escalator.run() }
+
+        val escalation = escalator.track(transaction())
+        escalator.close()
+        runner.join()
+
+        // The network fee exceeds ten times the original fee; the next bump would exceed the cap
+        assertEquals(listOf(10_000L), submitted.map { it.fee })
+        assertEquals(1, escalation.feeBumps)
+        assertTrue(escalation.included)
+    }
+
+    @Test
+    fun testExpiredAndFailedTransactions() = runTest {
+        val escalator = FeeEscalator(
+            KeyPair.random(), maxFee = 1_000_000, pollInterval = 5.seconds,
+            loadNetworkFees = { NetworkFees(10, 100) },
+            isIncluded = { transaction ->
+                check(transaction.memo == MemoNone) { "status unavailable" }
+                false
+            },
+            submitTransaction = { fail("expired transactions are not bumped") }
+        )
+        val runner = launch { escalator.run() }
+
+        val expired = async { escalator.track(transaction(TransactionPreconditions(timeBounds = TimeBounds(0, 1)))) }
+        val failing = transaction(memo = MemoText("broken"))
+        val error = assertFailsWith<IllegalStateException> { escalator.track(failing) }
+        assertEquals("status unavailable", error.message)
+
+        val escalation = expired.await()
+        assertFalse(escalation.included)
+        assertEquals(0, escalation.feeBumps)
+        escalator.close()
+        runner.join()
+        assertFailsWith<IllegalStateException> { escalator.track(failing) }
+    }
+
+    @Test
+    fun testFeeLoadingFailuresBackOff() = runTest {
+        var loads = 0
+        val escalator = FeeEscalator(
+            KeyPair.random(), maxFee = 1_000_000, pollInterval = 5.seconds,
+            loadNetworkFees = {
+                if (++loads <= 2) throw IllegalStateException("fee stats unavailable")
+                NetworkFees(10, 100)
+            },
+            isIncluded = { true },
+            submitTransaction = { fail("included transactions are not bumped") }
+        )
+        val runner = launch { escalator.run() }
+
+        val escalation = escalator.track(transaction())
+        // Polls after 5s, then retries after 10s and 20s
+        assertEquals(35_000L, currentTime)
+        assertTrue(escalation.included)
+        assertEquals(3, loads)
+        escalator.close()
+        runner.join()
+    }
+
+    @Test
+    fun testCancelledRunnerFailsTrackedTransactions() = runTest {
+        val escalator = FeeEscalator(
+            KeyPair.random(), maxFee = 1_000_000, pollInterval = 5.seconds,
+            loadNetworkFees = { NetworkFees(10, 100) },
+            isIncluded = { false },
+            submitTransaction = {}
+        )
+        val runner = launch { escalator.run() }
+        val tracked = List(2) { async { runCatching { escalator.track(transaction()) } } }
+        runCurrent()
+
+        runner.cancel()
+        runner.join()
+
+        tracked.forEach { assertIs<IllegalStateException>(it.await().exceptionOrNull()) }
+        assertFailsWith<IllegalStateException> { escalator.track(transaction()) }
+    }
+
+    @Test
+    fun testCancelledRunnerFailsTransactionBeingChecked() = runTest {
+        val checking = CompletableDeferred<Unit>()
+        val escalator = FeeEscalator(
+            KeyPair.random(), maxFee = 1_000_000, pollInterval = 5.seconds,
+            loadNetworkFees = { NetworkFees(10, 100) },
+            isIncluded = {
+                checking.complete(Unit)
+                awaitCancellation()
+            },
+            submitTransaction = {}
+        )
+        val runner = launch { escalator.run() }
+        val tracked = async { runCatching { escalator.track(transaction()) } }
+        checking.await()
+
+        runner.cancel()
+        runner.join()
+
+        val failure = assertIs<IllegalStateException>(tracked.await().exceptionOrNull())
+        assertIs<CancellationException>(failure.cause)
+        assertFalse(tracked.isCancelled)
+    }
+
+    @Test
+    fun testNetworkFeesFromFeeStats() {
+        val horizon = FeeStatsResponse(
+            lastLedger = 42,
+            lastLedgerBaseFee = 100,
+            ledgerCapacityUsage = "0.97",
+            feeCharged = FeeStatsResponse.FeeDistribution(100, 9_000, 100, 100, 100, 100, 100, 150, 200, 300, 500, 1_000, 5_000, 9_000),
+            maxFee = FeeStatsResponse.FeeDistribution(100, 90_000, 100, 100, 100, 100, 100, 150, 200, 300, 500, 10_000, 50_000, 90_000)
+        )
+        assertEquals(NetworkFees(42, 1_000), NetworkFees.fromFeeStats(horizon))
+        assertEquals(NetworkFees(42, 150), NetworkFees.fromFeeStats(horizon, percentile = 50))
+        assertFailsWith<IllegalArgumentException> { NetworkFees.fromFeeStats(horizon, percentile = 75) }
+
+        fun distribution(p90: Long) = GetFeeStatsResponse.FeeDistribution(
+            max = p90, min = 0, mode = 0, p10 = 0, p20 = 0, p30 = 0, p40 = 0, p50 = 0, p60 = 0, p70 = 0,
+            p80 = 0, p90 = p90, p95 = p90, p99 = p90, transactionCount = 10, ledgerCount = 5
+        )
+        val rpc = GetFeeStatsResponse(sorobanInclusionFee = distribution(70_000), inclusionFee = distribution(700), latestLedger = 43)
+        assertEquals(NetworkFees(43, 700), NetworkFees.fromFeeStats(rpc))
+        assertEquals(NetworkFees(43, AbstractTransaction.MIN_BASE_FEE), NetworkFees.fromFeeStats(rpc, percentile = 10))
+    }
+}
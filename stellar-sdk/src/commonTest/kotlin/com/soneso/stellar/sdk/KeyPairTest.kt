@@ -1,5 +1,7 @@
 package com.soneso.stellar.sdk
 
+import com.soneso.stellar.sdk.crypto.VerifyItem
+import com.soneso.stellar.sdk.crypto.getEd25519Crypto
 import kotlinx.coroutines.test.runTest
 import kotlin.test.*
 
@@ -175,4 +177,63 @@ class KeyPairTest {
         val publicKey3 = keypair.getPublicKey()
         assertFalse(publicKey1.contentEquals(publicKey3))
     }
+
+    @Test
+    fun testPreparedSignerMatchesOneShotSign() = runTest {
+        val crypto = getEd25519Crypto()
+        val seed = crypto.generatePrivateKey()
+        val signingKey = crypto.prepareSigner(seed)
+        val data = "prepared signer data".encodeToByteArray()
+
+        assertTrue(signingKey.publicKey.contentEquals(crypto.derivePublicKey(seed)))
+        // Ed25519 is deterministic, so both paths must produce identical signatures
+        assertTrue(signingKey.sign(data).contentEquals(crypto.sign(data, seed)))
+        assertTrue(signingKey.sign(ByteArray(0)).contentEquals(crypto.sign(ByteArray(0), seed)))
+
+        signingKey.close()
+        assertFailsWith<IllegalStateException> {
+            signingKey.sign(data)
+        }
+    }
+
+    @Test
+    fun testRepeatedSigningReusesKey() = runTest {
+        val keypair = KeyPair.fromSecretSeed("SDJHRQF4GCMIIKAAAQ6IHY42X73FQFLHUULAPSKKD4DFDM7UXWWCRHBE")
+        val data = "repeated".encodeToByteArray()
+
+        // One-shot, then preparing the expanded key, then reusing it
+        val first = keypair.sign(data)
+        val second = keypair.sign(data)
+        val third = keypair.sign(data)
+
+        assertTrue(first.contentEquals(second))
+        assertTrue(first.contentEquals(third))
+        assertTrue(keypair.verify(data, third))
+    }
+
+    @Test
+    fun testVerifyBatch() = runTest {
+        val crypto = getEd25519Crypto()
+        val keypairs = List(3) { KeyPair.random() }
+        // More items than one chunk so the concurrent path is exercised
+        val items = List(150) { index ->
+            val keypair = keypairs[index % keypairs.size]
+            val data = "message $index".encodeToByteArray()
+            val signature = keypair.sign(data)
+            when (index % 10) {
+                3 -> VerifyItem("tampered $index".encodeToByteArray(), signature, keypair.getPublicKey())
+                7 -> VerifyItem(data, signature, keypairs[(index + 1) % keypairs.size].getPublicKey())
+                9 -> VerifyItem(data, signature.copyOf(10), keypair.getPublicKey())
+                else -> VerifyItem(data, signature, keypair.getPublicKey())
+            }
+        }
+
+        val results = crypto.verifyBatch(items)
+
+        assertEquals(items.size, results.size)
+        results.forEachIndexed { index, valid ->
+            assertEquals(index % 10 !in setOf(3, 7, 9), valid, "Unexpected result for item $index")
+        }
+        assertEquals(0, crypto.verifyBatch(emptyList()).size)
+    }
 }
@@ -22,6 +22,10 @@ class NetworkTest {
         // Verify it's deterministic
         val networkId2 = network.networkId()
         assertTrue(networkId.contentEquals(networkId2))
+
+        // The cached ID is not exposed to modification
+        networkId[0] = (networkId[0] + 1).toByte()
+        assertTrue(networkId2.contentEquals(network.networkId()))
     }
 
     @Test
@@ -0,0 +1,147 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.xdr.*
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.awaitCancellation
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runCurrent
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+import kotlin.time.Duration.Companion.milliseconds
+
+class PaymentBatcherTest {
+
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+
+    private fun paymentResult(code: PaymentResultCodeXdr): OperationResultXdr =
+        OperationResultXdr.Tr(OperationResultTrXdr.PaymentResult(PaymentResultXdr.Void(code)))
+
+    private fun transactionResult(
+        results: List<OperationResultXdr>,
+        code: TransactionResultCodeXdr = TransactionResultCodeXdr.txSUCCESS
+    ): TransactionResultXdr = TransactionResultXdr(
+        feeCharged = Int64Xdr(100L * results.size),
+        result = TransactionResultResultXdr.Results(results, code),
+        ext = TransactionResultExtXdr.Void
+    )
+
+    private suspend fun pool(): ChannelAccountPool = ChannelAccountPool(List(2) { KeyPair.random() }) { 1L }
+
+    @Test
+    fun testPaymentsAreCoalescedByMemo() = runTest {
+        val treasury = KeyPair.random()
+        val submitted = mutableListOf<Transaction>()
+        val batcher = PaymentBatcher(
+            pool(), Network.TESTNET, baseFee = 200, signers = listOf(treasury), flushInterval = 100.milliseconds
+        ) { transaction ->
+            submitted.add(transaction)
+            // The third operation of every transaction is underfunded
+            transactionResult(List(transaction.operations.size) { i ->
+                paymentResult(if (i == 2) PaymentResultCodeXdr.PAYMENT_UNDERFUNDED else PaymentResultCodeXdr.PAYMENT_SUCCESS)
+            }, TransactionResultCodeXdr.txFAILED)
+        }
+        val runner = launch { batcher.run() }
+
+        val payments = List(250) { i ->
+            PaymentOperation(destination, AssetTypeNative, "${i + 1}").apply {
+                sourceAccount = treasury.getAccountId()
+            }
+        }
+        val results = payments.mapIndexed { i, payment ->
+            async { batcher.pay(payment, if (i % 50 == 0) MemoText("bonus") else MemoNone) }
+        }.awaitAll()
+        batcher.close()
+        runner.join()
+
+        // 245 payments without memo fill two full transactions and one of 45; the 5 bonus payments share one
+        assertEquals(listOf(5, 45, 100, 100), submitted.map { it.operations.size }.sorted())
+        submitted.forEach { transaction ->
+            assertEquals(200L * transaction.operations.size, transaction.fee)
+            assertEquals(2, transaction.signatures.size)
+            assertEquals(transaction.operations.size, transaction.operations.filterIsInstance<PaymentOperation>().size)
+        }
+        results.forEachIndexed { i, result ->
+            val transaction = submitted.single { it.hashHex() == result.transactionHash }
+            val expected = if (transaction.operations.indexOf(payments[i]) == 2) {
+                PaymentResultCodeXdr.PAYMENT_UNDERFUNDED
+            } else {
+                PaymentResultCodeXdr.PAYMENT_SUCCESS
+            }
+            assertEquals(expected, result.paymentResultCode, "payment $i")
+            assertFalse(result.isSuccess)
+        }
+        assertFailsWith<IllegalStateException> { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) }
+    }
+
+    @Test
+    fun testFeeLimitAndSubmissionFailure() = runTest {
+        var calls = 0
+        val batcher = PaymentBatcher(
+            pool(), Network.TESTNET, baseFee = 100, flushInterval = 100.milliseconds, maxFee = 1000
+        ) { transaction ->
+            calls++
+            if (calls == 1) throw IllegalStateException("connection lost")
+            transactionResult(List(transaction.operations.size) { paymentResult(PaymentResultCodeXdr.PAYMENT_SUCCESS) })
+        }
+        assertEquals(10, batcher.maxOperationsPerTransaction)
+        val runner = launch { batcher.run() }
+
+        val failed = List(10) { async { runCatching { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) } } }.awaitAll()
+        assertTrue(failed.all { it.exceptionOrNull()?.message == "connection lost" })
+        val succeeded = batcher.pay(PaymentOperation(destination, AssetTypeNative, "1"))
+        assertTrue(succeeded.isSuccess)
+        batcher.close()
+        runner.join()
+
+        assertFailsWith<IllegalArgumentException> {
+            PaymentBatcher(pool(), Network.TESTNET, baseFee = 100, maxFee = 99) { error("unused") }
+        }
+    }
+
+    @Test
+    fun testCancelledRunnerFailsQueuedPayments() = runTest {
+        val batcher = PaymentBatcher(pool(), Network.TESTNET, baseFee = 100, flushInterval = 10.milliseconds) {
+            error("unused")
+        }
+        val runner = launch { batcher.run() }
+        runCurrent()
+
+        // Two payments wait for the flush; the third is handed over but not yet taken by run()
+        val payments = List(2) { async { runCatching { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) } } }
+        runCurrent()
+        val handedOver = async(start = CoroutineStart.UNDISPATCHED) {
+            runCatching { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) }
+        }
+        runner.cancel()
+        runner.join()
+
+        (payments + handedOver).awaitAll().forEach { result ->
+            assertIs<IllegalStateException>(result.exceptionOrNull())
+        }
+        assertFailsWith<IllegalStateException> { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) }
+    }
+
+    @Test
+    fun testCancelledRunnerFailsPaymentsBeingSubmitted() = runTest {
+        val submitting = CompletableDeferred<Unit>()
+        val batcher = PaymentBatcher(pool(), Network.TESTNET, baseFee = 100, flushInterval = 10.milliseconds) {
+            submitting.complete(Unit)
+            awaitCancellation()
+        }
+        val runner = launch { batcher.run() }
+
+        val payment = async { runCatching { batcher.pay(PaymentOperation(destination, AssetTypeNative, "1")) } }
+        submitting.await()
+        runner.cancel()
+        runner.join()
+
+        // The caller was not cancelled itself, so it fails instead of finishing as cancelled
+        val failure = assertIs<IllegalStateException>(payment.await().exceptionOrNull())
+        assertIs<CancellationException>(failure.cause)
+        assertFalse(payment.isCancelled)
+    }
+}
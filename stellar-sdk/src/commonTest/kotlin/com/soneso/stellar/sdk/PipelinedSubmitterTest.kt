@@ -0,0 +1,136 @@
+package com.soneso.stellar.sdk
+
+import com.soneso.stellar.sdk.xdr.*
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class PipelinedSubmitterTest {
+
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+
+    private fun payment(amount: String): List<Operation> = listOf(PaymentOperation(destination, AssetTypeNative, amount))
+
+    /**
+     * Applies transactions like the network does for a single account: a transaction with
+     * sequence number `s` is valid while `minSeqNum <= account sequence < s`.
+     */
+    private class FakeLedger(var sequenceNumber: Long) {
+        val applied = mutableListOf<Long>()
+
+        fun submit(transaction: Transaction, code: TransactionResultCodeXdr? = null): TransactionResultXdr {
+            val s = transaction.sequenceNumber
+            val min = transaction.preconditions.minSequenceNumber ?: (s - 1)
+            val result = when {
+                sequenceNumber < min || sequenceNumber >= s -> TransactionResultResultXdr.Void(TransactionResultCodeXdr.txBAD_SEQ)
+                code != null -> TransactionResultResultXdr.Void(code)
+                else -> {
+                    sequenceNumber = s
+                    applied.add(s)
+                    TransactionResultResultXdr.Results(emptyList())
+                }
+            }
+            return TransactionResultXdr(Int64Xdr(100), result, TransactionResultExtXdr.Void)
+        }
+    }
+
+    @Test
+    fun testConcurrentSubmissions() = runTest {
+        val ledger = FakeLedger(100)
+        var loads = 0
+        val submitter = PipelinedSubmitter(
+            KeyPair.random(), Network.TESTNET, baseFee = 100, windowSize = 4,
+            loadSequenceNumber = { loads++; ledger.sequenceNumber }
+        ) { transaction ->
+            delay(10)
+            ledger.submit(transaction)
+        }
+
+        val submissions = List(10) { i -> async { submitter.submit(payment("${i + 1}")) } }.awaitAll()
+
+        assertEquals(1, loads)
+        assertEquals((101L..110L).toList(), submissions.map { it.transaction.sequenceNumber }.sorted())
+        assertEquals((101L..110L).toList(), ledger.applied)
+        submissions.forEach { submission ->
+            assertEquals(1, submission.attempts)
+            assertIs<TransactionResultResultXdr.Results>(submission.result.result)
+            assertEquals(1, submission.transaction.signatures.size)
+            assertNotNull(submission.transaction.preconditions.minSequenceNumber)
+        }
+        // Transactions of a window share the minSeqNum of the account before the window
+        assertEquals(100L, submissions.first().transaction.preconditions.minSequenceNumber)
+    }
+
+    @Test
+    fun testOutOfOrderArrivalIsRebuilt() = runTest {
+        val ledger = FakeLedger(100)
+        val submitter = PipelinedSubmitter(
+            KeyPair.random(), Network.TESTNET, baseFee = 100,
+            loadSequenceNumber = { ledger.sequenceNumber }
+        ) { transaction ->
+            // The first three transactions arrive in reverse order, in different ledgers
+            if (transaction.sequenceNumber <= 103) delay((104 - transaction.sequenceNumber) * 10)
+            ledger.submit(transaction)
+        }
+
+        val submissions = List(3) { i -> async { submitter.submit(payment("${i + 1}")) } }.awaitAll()
+
+        assertEquals(listOf(103L, 104L, 105L), ledger.applied)
+        assertEquals(listOf(2, 2, 1), submissions.map { it.attempts })
+        submissions.forEach { assertIs<TransactionResultResultXdr.Results>(it.result.result) }
+        val rebuilt = submissions.first().transaction
+        assertEquals(105L, rebuilt.sequenceNumber)
+        assertEquals(104L, rebuilt.preconditions.minSequenceNumber)
+    }
+
+    @Test
+    fun testRejectedTransactionLeavesGap() = runTest {
+        val ledger = FakeLedger(100)
+        val submitter = PipelinedSubmitter(
+            KeyPair.random(), Network.TESTNET, baseFee = 100,
+            loadSequenceNumber = { ledger.sequenceNumber }
+        ) { transaction ->
+            val rejected = (transaction.operations[0] as PaymentOperation).amount == "1"
+            ledger.submit(transaction, if (rejected) TransactionResultCodeXdr.txINSUFFICIENT_FEE else null)
+        }
+
+        val rejected = submitter.submit(payment("1"))
+        val accepted = submitter.submit(payment("2"))
+
+        assertEquals(TransactionResultCodeXdr.txINSUFFICIENT_FEE, rejected.result.result.discriminant)
+        assertEquals(101L, rejected.transaction.sequenceNumber)
+        // The rejected transaction did not consume its sequence number; minSeqNum lets the next one skip it
+        assertEquals(102L, accepted.transaction.sequenceNumber)
+        assertEquals(100L, accepted.transaction.preconditions.minSequenceNumber)
+        assertEquals(listOf(102L), ledger.applied)
+    }
+
+    @Test
+    fun testBadSequenceAfterMaxAttempts() = runTest {
+        val submitter = PipelinedSubmitter(
+            KeyPair.random(), Network.TESTNET, baseFee = 100, maxAttempts = 2,
+            loadSequenceNumber = { 100L }
+        ) { TransactionResultXdr(Int64Xdr(100), TransactionResultResultXdr.Void(TransactionResultCodeXdr.txBAD_SEQ), TransactionResultExtXdr.Void) }
+
+        val submission = submitter.submit(payment("1"))
+
+        assertEquals(2, submission.attempts)
+        assertEquals(TransactionResultCodeXdr.txBAD_SEQ, submission.result.result.discriminant)
+    }
+
+    @Test
+    fun testInvalidArguments() {
+        assertFailsWith<IllegalArgumentException> {
+            PipelinedSubmitter(KeyPair.fromAccountId(destination), Network.TESTNET, 100, loadSequenceNumber = { 0 }) {
+                error("not submitted")
+            }
+        }
+        assertFailsWith<IllegalArgumentException> {
+            PipelinedSubmitter(KeyPair.random(), Network.TESTNET, 100, windowSize = 0, loadSequenceNumber = { 0 }) {
+                error("not submitted")
+            }
+        }
+    }
+}
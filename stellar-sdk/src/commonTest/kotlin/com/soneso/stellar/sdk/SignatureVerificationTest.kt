@@ -0,0 +1,84 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class SignatureVerificationTest {
+
+    private suspend fun transaction(): Transaction {
+        val source = KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS")
+        return TransactionBuilder(Account(source.getAccountId(), 2908908335136768L), Network.TESTNET)
+            .addOperation(PaymentOperation("GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ", AssetTypeNative, "10"))
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 0)))
+            .build()
+    }
+
+    @Test
+    fun testAllSignerKinds() = runTest {
+        val transaction = transaction()
+        val first = KeyPair.random()
+        val second = KeyPair.random()
+        val payloadSigner = KeyPair.random()
+        val absent = KeyPair.random()
+        val stranger = KeyPair.random()
+        val preimage = "open sesame".encodeToByteArray()
+        val payload = byteArrayOf(1, 2, 3)
+
+        transaction.signAll(listOf(first, second, stranger))
+        transaction.signHashX(preimage)
+        // CAP-40: the hint is the key hint XOR the last 4 payload bytes, zero-padded on the right
+        val keyHint = payloadSigner.getPublicKey().copyOfRange(28, 32)
+        val payloadHint = payload.copyOf(4)
+        transaction.signatures.add(
+            DecoratedSignature(ByteArray(4) { (keyHint[it].toInt() xor payloadHint[it].toInt()).toByte() }, payloadSigner.sign(payload))
+        )
+
+        val firstKey = SignerKey.ed25519PublicKey(first.getPublicKey())
+        val secondKey = SignerKey.ed25519PublicKey(second.getPublicKey())
+        val hashKey = SignerKey.hashX(Util.hash(preimage))
+        val payloadKey = SignerKey.ed25519SignedPayload(payloadSigner.getPublicKey(), payload)
+        val preAuthKey = SignerKey.preAuthTx(transaction.hash())
+        val absentKey = SignerKey.ed25519PublicKey(absent.getPublicKey())
+        val otherPreAuthKey = SignerKey.preAuthTx(ByteArray(32))
+        val signers = listOf(firstKey, secondKey, hashKey, payloadKey, preAuthKey, absentKey, otherPreAuthKey)
+
+        val verification = transaction.verifySignatures(signers)
+
+        assertEquals(setOf(firstKey, secondKey, hashKey, payloadKey, preAuthKey), verification.signers)
+        assertEquals(listOf(transaction.signatures[2]), verification.unmatchedSignatures)
+
+        val weights = mapOf(firstKey to 1, secondKey to 1, hashKey to 2, payloadKey to 5, preAuthKey to 10, absentKey to 100)
+        assertEquals(19, verification.weight(weights))
+        assertTrue(verification.meetsThreshold(weights, 19))
+        assertFalse(verification.meetsThreshold(weights, 20))
+        assertEquals(
+            setOf(SignatureVerification.Threshold.LOW, SignatureVerification.Threshold.MEDIUM),
+            verification.metThresholds(weights, low = 0, medium = 10, high = 20)
+        )
+    }
+
+    @Test
+    fun testSharedHintAndInvalidSignature() = runTest {
+        val transaction = transaction()
+        val signer = KeyPair.random()
+        transaction.sign(signer)
+        val signerKey = SignerKey.ed25519PublicKey(signer.getPublicKey())
+        // A hash(x) signer whose hint collides with the Ed25519 signer
+        val collidingKey = SignerKey.hashX(ByteArray(28) + signer.getPublicKey().copyOfRange(28, 32))
+
+        val verification = transaction.verifySignatures(listOf(collidingKey, signerKey))
+        assertEquals(setOf(signerKey), verification.signers)
+        assertTrue(verification.unmatchedSignatures.isEmpty())
+
+        // A tampered signature matches no signer, and a threshold of 0 still needs a signature
+        val signature = transaction.signatures[0].signature.copyOf()
+        signature[0] = (signature[0] + 1).toByte()
+        transaction.signatures[0] = DecoratedSignature(transaction.signatures[0].hint, signature)
+        val tampered = transaction.verifySignatures(listOf(collidingKey, signerKey))
+        assertTrue(tampered.signers.isEmpty())
+        assertEquals(transaction.signatures, tampered.unmatchedSignatures)
+        assertFalse(tampered.meetsThreshold(mapOf(signerKey to 1), 0))
+        assertTrue(tampered.metThresholds(mapOf(signerKey to 1), 0, 0, 0).isEmpty())
+    }
+}
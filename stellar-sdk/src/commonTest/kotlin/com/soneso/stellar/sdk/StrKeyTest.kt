@@ -1,5 +1,6 @@
 package com.soneso.stellar.sdk
 
+import kotlinx.coroutines.test.runTest
 import kotlin.test.*
 
 class StrKeyTest {
@@ -657,6 +658,52 @@ class StrKeyTest {
         assertTrue(data33.contentEquals(StrKey.decodeClaimableBalance(claimableBalance)))
     }
 
+    // Every signed payload length ends in a different partial base32 group
+    @Test
+    fun testSignedPayloadAllLengths() {
+        for (size in 40..100) {
+            val payload = ByteArray(size) { i -> (i * 37 + size).toByte() }
+            val encoded = StrKey.encodeSignedPayload(payload)
+            assertEquals(((size + 3) * 8 + 4) / 5, encoded.length)
+            assertTrue(payload.contentEquals(StrKey.decodeSignedPayload(encoded)), "size $size")
+        }
+        val accountId = "GCZHXL5HXQX5ABDM26LHYRCQZ5OJFHLOPLZX47WEBP3V2PF5AVFK2A5D"
+        assertFalse(StrKey.isValidEd25519PublicKey(accountId.replace('Z', 'é')))
+        assertFalse(StrKey.isValidEd25519PublicKey(accountId.lowercase()))
+    }
+
+    @Test
+    fun testDecodeEd25519PublicKeys() = runTest {
+        val accountId = "GCZHXL5HXQX5ABDM26LHYRCQZ5OJFHLOPLZX47WEBP3V2PF5AVFK2A5D"
+        val invalidInputs = listOf(
+            "",
+            "SDJHRQF4GCMIIKAAAQ6IHY42X73FQFLHUULAPSKKD4DFDM7UXWWCRHBE",
+            "GCZHXL5HXQX5ABDM26LHYRCQZ5OJFHLOPLZX47WEBP3V2PF5AVFK2A5X",
+            accountId.lowercase(),
+            accountId + "A",
+            StrKey.encodeMed25519PublicKey(ByteArray(40))
+        )
+        // More entries than one chunk so the concurrent path is exercised
+        val keys = List(9000) { i -> ByteArray(32) { (it * 13 + i).toByte() } }
+        val inputs = keys.mapIndexed { i, key ->
+            if (i % 100 == 7) invalidInputs[i % invalidInputs.size] else StrKey.encodeEd25519PublicKey(key)
+        }
+
+        val result = StrKey.decodeEd25519PublicKeys(inputs)
+
+        assertEquals(inputs.size, result.size)
+        assertEquals(inputs.size * 32, result.keys.size)
+        assertEquals(90, result.invalidCount)
+        assertEquals(inputs.indices.filter { it % 100 == 7 }, result.invalidIndices())
+        inputs.forEachIndexed { i, input ->
+            assertEquals(StrKey.isValidEd25519PublicKey(input), result.isValid(i), "entry $i")
+            if (result.isValid(i)) assertTrue(keys[i].contentEquals(result.key(i)))
+        }
+        assertFailsWith<IllegalArgumentException> { result.key(7) }
+        assertFailsWith<IndexOutOfBoundsException> { result.isValid(inputs.size) }
+        assertEquals(0, StrKey.decodeEd25519PublicKeys(emptyList()).size)
+    }
+
     // Helper functions for hex conversion
     private fun hexToBytes(hex: String): ByteArray {
         val result = ByteArray(hex.length / 2)
@@ -0,0 +1,68 @@
+package com.soneso.stellar.sdk
+
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class TransactionTemplateTest {
+
+    private val source = "SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS"
+    private val issuer = "GDQNY3PBOJOKYZSRMK2S7LHHGWZIUISD4QORETLMXEWXBI7KFZZMKTL3"
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+
+    private suspend fun build(
+        sequenceNumber: Long,
+        payments: List<TransactionTemplate.Payment>
+    ): Transaction {
+        val keypair = KeyPair.fromSecretSeed(source)
+        val assets = listOf(AssetTypeNative, Asset.createNonNativeAsset("USDC", issuer))
+        val builder = TransactionBuilder(Account(keypair.getAccountId(), sequenceNumber - 1), Network.TESTNET)
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addMemo(MemoText("payout"))
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 1_900_000_000)))
+        payments.forEachIndexed { i, payment ->
+            builder.addOperation(PaymentOperation(payment.destination, assets[i % assets.size], payment.amount))
+        }
+        return builder.build()
+    }
+
+    private fun muxed(id: Long): String = MuxedAccount(destination, id.toULong()).address
+
+    @Test
+    fun testInstantiateMatchesBuiltTransaction() = runTest {
+        val prototypePayments = listOf(
+            TransactionTemplate.Payment(destination, "1"),
+            TransactionTemplate.Payment(muxed(1), "1")
+        )
+        val template = TransactionTemplate.fromTransaction(build(100, prototypePayments))
+        assertEquals(2, template.paymentCount)
+
+        val signer = KeyPair.fromSecretSeed(source)
+        for (sequenceNumber in listOf(7L, 1L shl 40, Long.MAX_VALUE)) {
+            val payments = listOf(
+                TransactionTemplate.Payment(KeyPair.random().getAccountId(), "125.5"),
+                TransactionTemplate.Payment(muxed(sequenceNumber), "0.0000001")
+            )
+            val patched = template.instantiate(sequenceNumber, payments)
+            val expected = build(sequenceNumber, payments)
+
+            assertContentEquals(expected.signatureBase(), patched.signatureBase())
+            assertContentEquals(expected.hash(), patched.hash())
+            patched.sign(signer)
+            expected.sign(signer)
+            assertEquals(expected.toEnvelopeXdrBase64(), patched.toEnvelopeXdrBase64())
+            assertEquals(expected, patched.toTransaction())
+        }
+    }
+
+    @Test
+    fun testInstantiateRejectsValuesThatDoNotFit() = runTest {
+        val template = TransactionTemplate.fromTransaction(
+            build(100, listOf(TransactionTemplate.Payment(destination, "1")))
+        )
+        assertFailsWith<IllegalArgumentException> { template.instantiate(101, emptyList()) }
+        assertFailsWith<IllegalArgumentException> { template.instantiate(-1, listOf(TransactionTemplate.Payment(destination, "1"))) }
+        assertFailsWith<IllegalArgumentException> { template.instantiate(101, listOf(TransactionTemplate.Payment(muxed(5), "1"))) }
+        assertFailsWith<IllegalArgumentException> { template.instantiate(101, listOf(TransactionTemplate.Payment("GINVALID", "1"))) }
+        assertFailsWith<IllegalArgumentException> { template.instantiate(101, listOf(TransactionTemplate.Payment(destination, "1.00000001"))) }
+    }
+}
@@ -1,5 +1,12 @@
 package com.soneso.stellar.sdk
 
+import com.soneso.stellar.sdk.crypto.getSha256Crypto
+import com.soneso.stellar.sdk.xdr.SCBytesXdr
+import com.soneso.stellar.sdk.xdr.SCValXdr
+import com.soneso.stellar.sdk.xdr.XdrWriter
+import kotlinx.coroutines.test.runTest
+import kotlin.io.encoding.Base64
+import kotlin.io.encoding.ExperimentalEncodingApi
 import kotlin.test.*
 
 class UtilTest {
@@ -170,4 +177,84 @@ class UtilTest {
         assertEquals(12, padded12.size)
         assertEquals("TESTASSET", Util.paddedByteArrayToString(padded12))
     }
+
+    @Test
+    fun testStreamingSha256MatchesOneShot() = runTest {
+        val crypto = getSha256Crypto()
+        val data = ByteArray(10_000) { (it * 31).toByte() }
+
+        val hasher = crypto.newHasher()
+        hasher.update(data, 0, 1)
+        hasher.update(data, 1, 4_999)
+        hasher.update(data, 5_000, 0)
+        hasher.update(data, 5_000)
+
+        assertContentEquals(crypto.hash(data), hasher.digest())
+    }
+
+    @Test
+    fun testHashXdrMatchesHashOfEncodedBytes() = runTest {
+        // Larger than one sink chunk so the writer drains more than once
+        val value = SCValXdr.Bytes(SCBytesXdr(ByteArray(10_001) { it.toByte() }))
+
+        val writer = XdrWriter()
+        value.encode(writer)
+        val expected = Util.hash(writer.toByteArray())
+
+        assertContentEquals(expected, Util.hashXdr { value.encode(it) })
+    }
+
+    @Test
+    fun testSinkWriterForwardsAllBytes() {
+        val value = SCValXdr.Bytes(SCBytesXdr(ByteArray(9_000) { it.toByte() }))
+        val collected = mutableListOf<Byte>()
+
+        val sinkWriter = XdrWriter { bytes, offset, length ->
+            for (i in offset until offset + length) collected.add(bytes[i])
+        }
+        value.encode(sinkWriter)
+        sinkWriter.flush()
+
+        val writer = XdrWriter()
+        value.encode(writer)
+        assertContentEquals(writer.toByteArray(), collected.toByteArray())
+        assertFailsWith<IllegalStateException> { sinkWriter.toByteArray() }
+    }
+
+    @OptIn(ExperimentalEncodingApi::class)
+    @Test
+    fun testBase64MatchesReferenceCodec() {
+        // Sizes with every remainder modulo three, so each padding form is covered
+        for (size in listOf(0, 1, 2, 3, 31, 32, 33, 1000)) {
+            val bytes = ByteArray(size) { (it * 37 + 11).toByte() }
+            val encoded = encodeBase64(bytes)
+            assertEquals(Base64.encode(bytes), encoded)
+            assertContentEquals(bytes, decodeBase64(encoded))
+        }
+        assertFailsWith<IllegalArgumentException> { decodeBase64("not base64!") }
+    }
+
+    @Test
+    fun testBase64RequiresPadding() {
+        assertContentEquals(byteArrayOf(1), decodeBase64("AQ=="))
+        assertContentEquals(byteArrayOf(1, 2), decodeBase64("AQI="))
+        // Every platform rejects unpadded or partly padded input alike
+        for (input in listOf("AQ", "AQ=", "AQI", "AQIDBA")) {
+            assertFailsWith<IllegalArgumentException>(input) { decodeBase64(input) }
+        }
+    }
+
+    @Test
+    fun testHexRoundTrip() {
+        val bytes = ByteArray(256) { it.toByte() }
+        val hex = Util.bytesToHex(bytes)
+        assertEquals(512, hex.length)
+        assertTrue(hex.startsWith("000102") && hex.endsWith("fdfeff"))
+        assertContentEquals(bytes, Util.hexToBytes(hex))
+        assertContentEquals(bytes, Util.hexToBytes(hex.uppercase()))
+        assertEquals("", Util.bytesToHex(ByteArray(0)))
+
+        assertFailsWith<IllegalArgumentException> { Util.hexToBytes("abc") }
+        assertFailsWith<IllegalArgumentException> { Util.hexToBytes("zz") }
+    }
 }
@@ -0,0 +1,55 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.decodeBase64
+import com.soneso.stellar.sdk.encodeBase64
+import kotlin.io.encoding.Base64
+import kotlin.io.encoding.ExperimentalEncodingApi
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.time.TimeSource
+
+/**
+ * Measures Base64 throughput of the platform codec used by the `toXdrBase64`/`fromXdrBase64`
+ * helpers on a 4 MB payload, the size of a busy ledger's close meta, against the portable
+ * `kotlin.io.encoding.Base64` codec.
+ *
+ * Compare the `[benchmark]` lines per target, since each has its own platform codec; the test
+ * tasks run it only with `-Pbenchmark`.
+ */
+@OptIn(ExperimentalEncodingApi::class)
+class Base64Benchmark {
+
+    private val payload = ByteArray(4 * 1024 * 1024) { (it * 31 + it / 7).toByte() }
+
+    @Test
+    fun benchmarkBase64Encode() {
+        val encoded = measure("encode platform", iterations = 10) { encodeBase64(payload) }
+        val reference = measure("encode kotlin.io", iterations = 10) { Base64.encode(payload) }
+        assertEquals(reference, encoded)
+    }
+
+    @Test
+    fun benchmarkBase64Decode() {
+        val text = Base64.encode(payload)
+        val decoded = measure("decode platform", iterations = 10) { decodeBase64(text) }
+        val reference = measure("decode kotlin.io", iterations = 10) { Base64.decode(text) }
+        assertContentEquals(reference, decoded)
+        assertContentEquals(payload, decoded)
+    }
+
+    private fun <T> measure(name: String, iterations: Int, block: () -> T): T {
+        // Warm-up
+        var result = block()
+
+        val mark = TimeSource.Monotonic.markNow()
+        repeat(iterations) { result = block() }
+        val elapsed = mark.elapsedNow()
+
+        val microsPerOp = elapsed.inWholeMicroseconds / iterations
+        val megabytesPerSecond = if (elapsed.inWholeMicroseconds == 0L) 0 else
+            payload.size.toLong() * iterations / elapsed.inWholeMicroseconds
+        println("[benchmark] base64 $name (${payload.size} bytes): $microsPerOp µs/op, $megabytesPerSecond MB/s")
+        return result
+    }
+}
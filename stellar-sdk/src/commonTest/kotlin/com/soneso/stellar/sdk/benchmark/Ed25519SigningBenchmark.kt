@@ -0,0 +1,46 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.crypto.getEd25519Crypto
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertTrue
+import kotlin.time.TimeSource
+
+/**
+ * Compares the per-signature cost of one-shot [com.soneso.stellar.sdk.crypto.Ed25519Crypto.sign]
+ * (which re-derives the expanded secret key every call) against a prepared signing key.
+ *
+ * Part of the benchmark package that test tasks only include with `-Pbenchmark`.
+ */
+class Ed25519SigningBenchmark {
+
+    private val iterations = 500
+
+    @Test
+    fun benchmarkOneShotVersusPreparedSigning() = runTest {
+        val crypto = getEd25519Crypto()
+        val seed = crypto.generatePrivateKey()
+        val data = ByteArray(32) { it.toByte() }
+        val signingKey = crypto.prepareSigner(seed)
+
+        // Warm-up
+        repeat(50) {
+            crypto.sign(data, seed)
+            signingKey.sign(data)
+        }
+
+        var mark = TimeSource.Monotonic.markNow()
+        repeat(iterations) { crypto.sign(data, seed) }
+        val oneShot = mark.elapsedNow()
+
+        mark = TimeSource.Monotonic.markNow()
+        repeat(iterations) { signingKey.sign(data) }
+        val prepared = mark.elapsedNow()
+
+        println("[benchmark] ${crypto.libraryName} sign, one-shot: ${oneShot.inWholeMicroseconds / iterations} µs/op")
+        println("[benchmark] ${crypto.libraryName} sign, prepared: ${prepared.inWholeMicroseconds / iterations} µs/op")
+
+        assertTrue(signingKey.sign(data).contentEquals(crypto.sign(data, seed)))
+        signingKey.close()
+    }
+}
@@ -0,0 +1,50 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.*
+import kotlinx.coroutines.flow.asFlow
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.time.TimeSource
+
+/**
+ * Measures decoding of base64 transaction envelopes as done during history ingestion: one by one
+ * with [AbstractTransaction.fromEnvelopeXdr] and as a stream with [AbstractTransaction.fromEnvelopeXdrs].
+ *
+ * Skipped by the test tasks unless Gradle runs with `-Pbenchmark`; the timings are printed
+ * as `[benchmark]` lines.
+ */
+class EnvelopeDecodingBenchmark {
+
+    @Test
+    fun benchmarkDecodeEnvelopes() = runTest {
+        val source = KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS")
+        val builder = TransactionBuilder(Account(source.getAccountId(), 2908908335136768L), Network.TESTNET)
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 0)))
+        repeat(10) {
+            builder.addOperation(
+                PaymentOperation("GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ", AssetTypeNative, "${it + 1}")
+            )
+        }
+        val transaction = builder.build()
+        transaction.sign(source)
+        // A ledger range worth of envelopes
+        val envelopes = List(20_000) { transaction.toEnvelopeXdrBase64() }
+
+        // Warm-up
+        envelopes.take(2_000).forEach { AbstractTransaction.fromEnvelopeXdr(it, Network.TESTNET) }
+        AbstractTransaction.fromEnvelopeXdrs(envelopes.take(2_000).asFlow(), Network.TESTNET).toList()
+
+        var mark = TimeSource.Monotonic.markNow()
+        val serial = envelopes.map { AbstractTransaction.fromEnvelopeXdr(it, Network.TESTNET) }
+        println("[benchmark] decode 20k envelopes one by one: ${mark.elapsedNow().inWholeMilliseconds} ms")
+
+        mark = TimeSource.Monotonic.markNow()
+        val streamed = AbstractTransaction.fromEnvelopeXdrs(envelopes.asFlow(), Network.TESTNET).toList()
+        println("[benchmark] decode 20k envelopes as a flow: ${mark.elapsedNow().inWholeMilliseconds} ms")
+
+        assertEquals(serial, streamed)
+    }
+}
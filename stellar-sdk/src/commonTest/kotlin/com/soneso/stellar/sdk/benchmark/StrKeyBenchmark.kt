@@ -0,0 +1,80 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.StrKey
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.time.TimeSource
+
+/**
+ * Measures StrKey encode/decode throughput for each fixed payload size: account IDs (32 bytes),
+ * claimable balances (33), muxed accounts (40) and the largest signed payloads (100).
+ *
+ * Excluded from regular test runs; pass `-Pbenchmark` to Gradle to include it.
+ */
+class StrKeyBenchmark {
+
+    private val keys = List(1_000) { i -> ByteArray(32) { (it * 31 + i).toByte() } }
+
+    @Test
+    fun benchmarkEncode() {
+        val balances = keys.map { byteArrayOf(0) + it }
+        val muxed = keys.map { it + ByteArray(8) { b -> b.toByte() } }
+        val payloads = keys.map { it + byteArrayOf(0, 0, 0, 64) + ByteArray(64) { b -> b.toByte() } }
+
+        measure("encode account ID", keys) { StrKey.encodeEd25519PublicKey(it) }
+        measure("encode claimable balance", balances) { StrKey.encodeClaimableBalance(it) }
+        measure("encode muxed account", muxed) { StrKey.encodeMed25519PublicKey(it) }
+        measure("encode signed payload", payloads) { StrKey.encodeSignedPayload(it) }
+    }
+
+    @Test
+    fun benchmarkDecode() {
+        val accountIds = keys.map { StrKey.encodeEd25519PublicKey(it) }
+        val seeds = keys.map { StrKey.encodeEd25519SecretSeed(it) }
+        val muxed = keys.map { StrKey.encodeMed25519PublicKey(it + ByteArray(8)) }
+
+        val decoded = measure("decode account ID", accountIds) { StrKey.decodeEd25519PublicKey(it) }
+        measure("decode secret seed", seeds) { StrKey.decodeEd25519SecretSeed(it) }
+        measure("decode muxed account", muxed) { StrKey.decodeMed25519PublicKey(it) }
+        measure("validate account ID", accountIds) { StrKey.isValidEd25519PublicKey(it) }
+        assertContentEquals(keys.last(), decoded)
+    }
+
+    @Test
+    fun benchmarkBulkDecode() = runTest {
+        // A payroll-sized list of recipients
+        val accountIds = List(50) { keys.map { StrKey.encodeEd25519PublicKey(it) } }.flatten()
+
+        // Warm-up
+        accountIds.forEach { StrKey.decodeEd25519PublicKey(it) }
+        var result = StrKey.decodeEd25519PublicKeys(accountIds)
+
+        var mark = TimeSource.Monotonic.markNow()
+        repeat(5) { accountIds.forEach { StrKey.decodeEd25519PublicKey(it) } }
+        println("[benchmark] strkey decode 50k account IDs one by one: ${mark.elapsedNow().inWholeMicroseconds / 5} µs/op")
+
+        mark = TimeSource.Monotonic.markNow()
+        repeat(5) { result = StrKey.decodeEd25519PublicKeys(accountIds) }
+        println("[benchmark] strkey decode 50k account IDs in bulk: ${mark.elapsedNow().inWholeMicroseconds / 5} µs/op")
+        assertEquals(0, result.invalidCount)
+    }
+
+    private fun <I, T> measure(name: String, inputs: List<I>, iterations: Int = 100, block: (I) -> T): T {
+        // Warm-up
+        var result = block(inputs[0])
+        inputs.forEach { result = block(it) }
+
+        val mark = TimeSource.Monotonic.markNow()
+        repeat(iterations) { inputs.forEach { result = block(it) } }
+        val elapsed = mark.elapsedNow()
+
+        val operations = inputs.size.toLong() * iterations
+        val nanosPerOp = elapsed.inWholeNanoseconds / operations
+        val opsPerSecond = if (elapsed.inWholeMicroseconds == 0L) 0 else
+            operations * 1_000_000 / elapsed.inWholeMicroseconds
+        println("[benchmark] strkey $name: $nanosPerOp ns/op, $opsPerSecond ops/s")
+        return result
+    }
+}
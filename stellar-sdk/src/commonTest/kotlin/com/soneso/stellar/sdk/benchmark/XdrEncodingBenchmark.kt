@@ -0,0 +1,105 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.*
+import com.soneso.stellar.sdk.xdr.*
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.time.TimeSource
+
+/**
+ * Measures XDR encoding throughput for large values: a 100-operation transaction envelope
+ * and a ledger close meta carrying 50 such envelopes.
+ *
+ * Only runs when Gradle is given `-Pbenchmark`, e.g.
+ * `./gradlew :stellar-sdk:jvmTest -Pbenchmark --tests "*XdrEncodingBenchmark"`.
+ */
+class XdrEncodingBenchmark {
+
+    @Test
+    fun benchmarkEncodeTransactionEnvelope() = runTest {
+        val envelope = largeEnvelope()
+        val bytes = measureEncoding("TransactionEnvelopeXdr", iterations = 200) { envelope.encode(it) }
+
+        // Round trip must be lossless
+        assertContentEquals(bytes, encode { TransactionEnvelopeXdr.decode(XdrReader(bytes)).encode(it) })
+    }
+
+    @Test
+    fun benchmarkEncodeLedgerCloseMeta() = runTest {
+        val envelope = largeEnvelope()
+        val hash = HashXdr(ByteArray(32) { it.toByte() })
+        val header = LedgerHeaderXdr(
+            ledgerVersion = Uint32Xdr(23u),
+            previousLedgerHash = hash,
+            scpValue = StellarValueXdr(hash, TimePointXdr(Uint64Xdr(1_700_000_000uL)), emptyList(), StellarValueExtXdr.Void),
+            txSetResultHash = hash,
+            bucketListHash = hash,
+            ledgerSeq = Uint32Xdr(1_000_000u),
+            totalCoins = Int64Xdr(1_000_000_000_000_000L),
+            feePool = Int64Xdr(1_000_000L),
+            inflationSeq = Uint32Xdr(0u),
+            idPool = Uint64Xdr(0uL),
+            baseFee = Uint32Xdr(100u),
+            baseReserve = Uint32Xdr(5_000_000u),
+            maxTxSetSize = Uint32Xdr(1_000u),
+            skipList = Array(4) { hash },
+            ext = LedgerHeaderExtXdr.Void
+        )
+        val meta = LedgerCloseMetaXdr.V0(
+            LedgerCloseMetaV0Xdr(
+                ledgerHeader = LedgerHeaderHistoryEntryXdr(hash, header, LedgerHeaderHistoryEntryExtXdr.Void),
+                txSet = TransactionSetXdr(hash, List(50) { envelope }),
+                txProcessing = emptyList(),
+                upgradesProcessing = emptyList(),
+                scpInfo = emptyList()
+            )
+        )
+
+        val bytes = measureEncoding("LedgerCloseMetaXdr", iterations = 20) { meta.encode(it) }
+
+        assertContentEquals(bytes, encode { LedgerCloseMetaXdr.decode(XdrReader(bytes)).encode(it) })
+    }
+
+    private suspend fun largeEnvelope(): TransactionEnvelopeXdr {
+        val source = KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS")
+        val builder = TransactionBuilder(Account(source.getAccountId(), 2908908335136768L), Network.TESTNET)
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 0)))
+            .addMemo(MemoText("benchmark"))
+        repeat(100) {
+            builder.addOperation(
+                PaymentOperation(
+                    destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ",
+                    asset = AssetTypeCreditAlphaNum4("USDC", "GDQNY3PBOJOKYZSRMK2S7LHHGWZIUISD4QORETLMXEWXBI7KFZZMKTL3"),
+                    amount = "${it + 1}.0000000"
+                )
+            )
+        }
+        val transaction = builder.build()
+        transaction.sign(source)
+        return transaction.toEnvelopeXdr()
+    }
+
+    private fun encode(block: (XdrWriter) -> Unit): ByteArray {
+        val writer = XdrWriter()
+        block(writer)
+        return writer.toByteArray()
+    }
+
+    private fun measureEncoding(name: String, iterations: Int, block: (XdrWriter) -> Unit): ByteArray {
+        // Warm-up
+        repeat(iterations / 10 + 1) { encode(block) }
+
+        var bytes = ByteArray(0)
+        val mark = TimeSource.Monotonic.markNow()
+        repeat(iterations) { bytes = encode(block) }
+        val elapsed = mark.elapsedNow()
+
+        val microsPerOp = elapsed.inWholeMicroseconds / iterations
+        val megabytesPerSecond = if (elapsed.inWholeMicroseconds == 0L) 0 else
+            bytes.size.toLong() * iterations / elapsed.inWholeMicroseconds
+        println("[benchmark] encode $name (${bytes.size} bytes): $microsPerOp µs/op, $megabytesPerSecond MB/s")
+        return bytes
+    }
+}
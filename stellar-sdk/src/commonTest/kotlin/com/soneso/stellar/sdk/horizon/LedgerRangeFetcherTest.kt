@@ -0,0 +1,211 @@
+package com.soneso.stellar.sdk.horizon
+
+import com.soneso.stellar.sdk.horizon.exceptions.BadResponseException
+import com.soneso.stellar.sdk.horizon.responses.TransactionResponse
+import io.ktor.client.*
+import io.ktor.client.engine.mock.*
+import io.ktor.client.plugins.contentnegotiation.*
+import io.ktor.http.*
+import io.ktor.serialization.kotlinx.json.*
+import io.ktor.utils.io.*
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.test.runTest
+import kotlinx.serialization.json.Json
+import kotlin.test.*
+
+/**
+ * Tests for [LedgerRangeFetcher].
+ *
+ * A [MockEngine] serves ledgers 1 to [LATEST_LEDGER], where ledger `n` contains `n % 3`
+ * transactions, and the transactions of each ledger through `/ledgers/{n}/transactions`.
+ */
+class LedgerRangeFetcherTest {
+
+    companion object {
+        private const val TEST_SERVER_URL = "https://horizon-testnet.stellar.org"
+        private const val LATEST_LEDGER = 30L
+    }
+
+    private val lock = Mutex()
+    private val transactionRequests = mutableListOf<Long>()
+    private var ledgerRequests = 0
+
+    private fun toid(ledger: Long, transaction: Int): Long = (ledger shl 32) or (transaction.toLong() shl 12)
+
+    private fun transactionCount(ledger: Long): Int = (ledger % 3).toInt()
+
+    private fun ledgerJson(sequence: Long): String = """
+        {
+          "id": "ledger-$sequence",
+          "paging_token": "${toid(sequence, 0)}",
+          "hash": "hash-$sequence",
+          "sequence": $sequence,
+          "successful_transaction_count": ${transactionCount(sequence)},
+          "failed_transaction_count": 0,
+          "operation_count": ${transactionCount(sequence)},
+          "closed_at": "2024-01-01T00:00:00Z",
+          "total_coins": "100000000000.0000000",
+          "fee_pool": "0.0000000",
+          "base_fee_in_stroops": "100",
+          "base_reserve_in_stroops": "5000000",
+          "_links": {
+            "self": {"href": "$TEST_SERVER_URL/ledgers/$sequence"},
+            "transactions": {"href": "$TEST_SERVER_URL/ledgers/$sequence/transactions"},
+            "operations": {"href": "$TEST_SERVER_URL/ledgers/$sequence/operations"},
+            "payments": {"href": "$TEST_SERVER_URL/ledgers/$sequence/payments"},
+            "effects": {"href": "$TEST_SERVER_URL/ledgers/$sequence/effects"}
+          }
+        }
+    """.trimIndent()
+
+    private fun transactionJson(ledger: Long, index: Int): String = """
+        {
+          "id": "tx-$ledger-$index",
+          "paging_token": "${toid(ledger, index)}",
+          "successful": true,
+          "hash": "tx-$ledger-$index",
+          "ledger": $ledger,
+          "created_at": "2024-01-01T00:00:00Z",
+          "source_account": "GAAZI4TCR3TY5OJHCTJC2A4QSY6CJWJH5IAJTGKIN2ER7LBNVKOCCWN7",
+          "source_account_sequence": 1,
+          "fee_account": "GAAZI4TCR3TY5OJHCTJC2A4QSY6CJWJH5IAJTGKIN2ER7LBNVKOCCWN7",
+          "fee_charged": 100,
+          "max_fee": 100,
+          "operation_count": 1,
+          "signatures": [],
+          "memo_type": "none",
+          "_links": {
+            "self": {"href": "$TEST_SERVER_URL/transactions/tx-$ledger-$index"},
+            "account": {"href": "$TEST_SERVER_URL/accounts/GAAZI4TCR3TY5OJHCTJC2A4QSY6CJWJH5IAJTGKIN2ER7LBNVKOCCWN7"},
+            "ledger": {"href": "$TEST_SERVER_URL/ledgers/$ledger"},
+            "operations": {"href": "$TEST_SERVER_URL/transactions/tx-$ledger-$index/operations"},
+            "effects": {"href": "$TEST_SERVER_URL/transactions/tx-$ledger-$index/effects"},
+            "precedes": {"href": "$TEST_SERVER_URL/transactions?order=asc"},
+            "succeeds": {"href": "$TEST_SERVER_URL/transactions?order=desc"}
+          }
+        }
+    """.trimIndent()
+
+    private fun pageJson(records: List<String>, nextHref: String): String = """
+        {
+          "_embedded": {"records": [${records.joinToString(",")}]},
+          "_links": {
+            "self": {"href": "$nextHref"},
+            "next": {"href": "$nextHref"}
+          }
+        }
+    """.trimIndent()
+
+    private fun ledgersPage(url: Url): String {
+        val cursor = url.parameters["cursor"]?.toLong() ?: 0L
+        val limit = url.parameters["limit"]?.toInt() ?: 10
+        val first = (cursor shr 32) + 1
+        val sequences = (first..minOf(LATEST_LEDGER, first + limit - 1)).toList()
+        val next = sequences.lastOrNull()?.let { toid(it, 0) } ?: cursor
+        return pageJson(sequences.map { ledgerJson(it) }, "$TEST_SERVER_URL/ledgers?cursor=$next&limit=$limit&order=asc")
+    }
+
+    private fun transactionsPage(url: Url, ledger: Long): String {
+        val next = "$TEST_SERVER_URL/ledgers/$ledger/transactions?cursor=${toid(ledger + 1, 0)}&order=asc"
+        // Every ledger fits into the first page; the next page is empty
+        if (url.parameters["cursor"] != null) return pageJson(emptyList(), next)
+        return pageJson((1..transactionCount(ledger)).map { transactionJson(ledger, it) }, next)
+    }
+
+    private fun createServer(failingLedger: Long? = null): HorizonServer {
+        val mockEngine = MockEngine { requestData ->
+            val segments = requestData.url.encodedPath.trim('/').split('/')
+            val ledger = segments.getOrNull(1)?.toLong()
+            if (ledger != null && segments.getOrNull(2) == "transactions") {
+                lock.withLock { transactionRequests.add(ledger) }
+            }
+            if (ledger == null) lock.withLock { ledgerRequests++ }
+            when {
+                ledger == null -> respond(
+                    content = ByteReadChannel(ledgersPage(requestData.url)),
+                    status = HttpStatusCode.OK,
+                    headers = headersOf(HttpHeaders.ContentType, "application/json")
+                )
+                ledger == failingLedger -> respond(
+                    content = ByteReadChannel("""{"status": 500}"""),
+                    status = HttpStatusCode.InternalServerError,
+                    headers = headersOf(HttpHeaders.ContentType, "application/json")
+                )
+                else -> respond(
+                    content = ByteReadChannel(transactionsPage(requestData.url, ledger)),
+                    status = HttpStatusCode.OK,
+                    headers = headersOf(HttpHeaders.ContentType, "application/json")
+                )
+            }
+        }
+        val mockClient = HttpClient(mockEngine) {
+            install(ContentNegotiation) {
+                json(Json {
+                    ignoreUnknownKeys = true
+                    isLenient = true
+                })
+            }
+        }
+        return HorizonServer(TEST_SERVER_URL, httpClient = mockClient, submitHttpClient = mockClient)
+    }
+
+    private fun expectedTokens(ledgers: LongRange): List<String> =
+        ledgers.flatMap { ledger -> (1..transactionCount(ledger)).map { toid(ledger, it).toString() } }
+
+    @Test
+    fun testRecordsInPagingTokenOrder() = runTest {
+        val server = createServer()
+        val fetcher = LedgerRangeFetcher(server, shardSize = 4, maxConnections = 3)
+
+        val transactions = fetcher.transactions(1L..LATEST_LEDGER).toList()
+
+        assertEquals(expectedTokens(1L..LATEST_LEDGER), transactions.map { it.pagingToken })
+        // Ledgers without transactions are skipped
+        assertEquals((1L..LATEST_LEDGER).filter { transactionCount(it) > 0 }.toSet(), transactionRequests.toSet())
+        // One ledger page per shard; none is requested past a shard's last ledger
+        assertEquals(8, ledgerRequests)
+
+        server.close()
+    }
+
+    @Test
+    fun testPartialShards() = runTest {
+        val server = createServer()
+        val fetcher = LedgerRangeFetcher(server, shardSize = 3, maxConnections = 2)
+
+        val transactions = fetcher.transactions(5L..12L).toList()
+
+        assertEquals(expectedTokens(5L..12L), transactions.map { it.pagingToken })
+        assertTrue(fetcher.transactions(7L..6L).toList().isEmpty())
+
+        server.close()
+    }
+
+    @Test
+    fun testFailureAfterPrecedingShards() = runTest {
+        val server = createServer(failingLedger = 10L)
+        val fetcher = LedgerRangeFetcher(server, shardSize = 4, maxConnections = 3)
+        val received = mutableListOf<TransactionResponse>()
+
+        assertFailsWith<BadResponseException> {
+            fetcher.transactions(1L..LATEST_LEDGER).collect { received.add(it) }
+        }
+        // Ledger 10 is in the third shard; the two shards before it are emitted in full
+        assertEquals(expectedTokens(1L..8L), received.map { it.pagingToken })
+
+        server.close()
+    }
+
+    @Test
+    fun testInvalidArguments() {
+        val server = createServer()
+
+        assertFailsWith<IllegalArgumentException> { LedgerRangeFetcher(server, shardSize = 0) }
+        assertFailsWith<IllegalArgumentException> { LedgerRangeFetcher(server, maxConnections = 0) }
+        assertFailsWith<IllegalArgumentException> { LedgerRangeFetcher(server).transactions(0L..10L) }
+
+        server.close()
+    }
+}
@@ -0,0 +1,189 @@
+package com.soneso.stellar.sdk.horizon
+
+import io.ktor.client.*
+import io.ktor.client.engine.mock.*
+import io.ktor.client.plugins.contentnegotiation.*
+import io.ktor.http.*
+import io.ktor.serialization.kotlinx.json.*
+import io.ktor.utils.io.*
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.flow.take
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runTest
+import kotlinx.serialization.json.Json
+import kotlin.test.*
+
+/**
+ * Tests for the auto-paginating `asFlow()` of Horizon request builders.
+ *
+ * A [MockEngine] serves three pages of two ledgers each, followed by an empty page,
+ * selecting the page by the `cursor` query parameter of the request.
+ */
+class PagedFlowTest {
+
+    companion object {
+        private const val TEST_SERVER_URL = "https://horizon-testnet.stellar.org"
+        private const val PAGE_SIZE = 2
+        private const val PAGE_COUNT = 3
+    }
+
+    private val requestedCursors = mutableListOf<Long>()
+    private val secondPageRequested = CompletableDeferred<Unit>()
+
+    private fun ledgerJson(sequence: Long): String = """
+        {
+          "id": "ledger-$sequence",
+          "paging_token": "$sequence",
+          "hash": "hash-$sequence",
+          "sequence": $sequence,
+          "closed_at": "2024-01-01T00:00:00Z",
+          "total_coins": "100000000000.0000000",
+          "fee_pool": "0.0000000",
+          "base_fee_in_stroops": "100",
+          "base_reserve_in_stroops": "5000000",
+          "_links": {
+            "self": {"href": "$TEST_SERVER_URL/ledgers/$sequence"},
+            "transactions": {"href": "$TEST_SERVER_URL/ledgers/$sequence/transactions"},
+            "operations": {"href": "$TEST_SERVER_URL/ledgers/$sequence/operations"},
+            "payments": {"href": "$TEST_SERVER_URL/ledgers/$sequence/payments"},
+            "effects": {"href": "$TEST_SERVER_URL/ledgers/$sequence/effects"}
+          }
+        }
+    """.trimIndent()
+
+    private fun pageJson(cursor: Long): String {
+        val sequences = if (cursor < PAGE_SIZE * PAGE_COUNT) (cursor + 1..cursor + PAGE_SIZE).toList() else emptyList()
+        val next = sequences.lastOrNull() ?: cursor
+        return """
+            {
+              "_embedded": {"records": [${sequences.joinToString(",") { ledgerJson(it) }}]},
+              "_links": {
+                "self": {"href": "$TEST_SERVER_URL/ledgers?cursor=$cursor&limit=$PAGE_SIZE&order=asc"},
+                "next": {"href": "$TEST_SERVER_URL/ledgers?cursor=$next&limit=$PAGE_SIZE&order=asc"}
+              }
+            }
+        """.trimIndent()
+    }
+
+    private fun createServer(): HorizonServer {
+        val mockEngine = MockEngine { requestData ->
+            val cursor = requestData.url.parameters["cursor"]?.toLong() ?: 0L
+            requestedCursors.add(cursor)
+            if (cursor == PAGE_SIZE.toLong()) secondPageRequested.complete(Unit)
+            respond(
+                content = ByteReadChannel(pageJson(cursor)),
+                status = HttpStatusCode.OK,
+                headers = headersOf(HttpHeaders.ContentType, "application/json")
+            )
+        }
+        val mockClient = HttpClient(mockEngine) {
+            install(ContentNegotiation) {
+                json(Json {
+                    ignoreUnknownKeys = true
+                    isLenient = true
+                })
+            }
+        }
+        return HorizonServer(TEST_SERVER_URL, httpClient = mockClient, submitHttpClient = mockClient)
+    }
+
+    @Test
+    fun testCollectsAllPagesInOrder() = runTest {
+        val server = createServer()
+
+        val ledgers = server.ledgers().limit(PAGE_SIZE).asFlow().toList()
+
+        assertEquals((1L..PAGE_SIZE * PAGE_COUNT).toList(), ledgers.map { it.sequence })
+        // Three full pages and the empty page that ends pagination
+        assertEquals(listOf(0L, 2L, 4L, 6L), requestedCursors)
+
+        server.close()
+    }
+
+    @Test
+    fun testWithoutPrefetch() = runTest {
+        val server = createServer()
+
+        val ledgers = server.ledgers().limit(PAGE_SIZE).asFlow(prefetch = 0).toList()
+
+        assertEquals((1L..PAGE_SIZE * PAGE_COUNT).toList(), ledgers.map { it.sequence })
+        assertEquals(listOf(0L, 2L, 4L, 6L), requestedCursors)
+
+        server.close()
+    }
+
+    @Test
+    fun testPrefetchRequestsNextPageWhileCollectorIsBusy() = runTest {
+        val server = createServer()
+        val firstReceived = CompletableDeferred<Unit>()
+        val release = CompletableDeferred<Unit>()
+        val ledgers = mutableListOf<Long>()
+
+        val collector = launch {
+            server.ledgers().limit(PAGE_SIZE).asFlow(prefetch = 1).collect { ledger ->
+                ledgers.add(ledger.sequence)
+                firstReceived.complete(Unit)
+                release.await()
+            }
+        }
+        firstReceived.await()
+        // The collector is still suspended on the first ledger
+        secondPageRequested.await()
+        assertEquals(listOf(1L), ledgers)
+
+        release.complete(Unit)
+        collector.join()
+        assertEquals((1L..PAGE_SIZE * PAGE_COUNT).toList(), ledgers)
+
+        server.close()
+    }
+
+    @Test
+    fun testWithoutPrefetchNextPageWaitsForCollector() = runTest {
+        val server = createServer()
+        val firstReceived = CompletableDeferred<Unit>()
+        val release = CompletableDeferred<Unit>()
+
+        val collector = launch {
+            server.ledgers().limit(PAGE_SIZE).asFlow(prefetch = 0).collect {
+                firstReceived.complete(Unit)
+                release.await()
+            }
+        }
+        firstReceived.await()
+        assertEquals(listOf(0L), requestedCursors)
+        assertFalse(secondPageRequested.isCompleted)
+
+        release.complete(Unit)
+        collector.join()
+        assertEquals(listOf(0L, 2L, 4L, 6L), requestedCursors)
+
+        server.close()
+    }
+
+    @Test
+    fun testTakeStopsFetching() = runTest {
+        val server = createServer()
+
+        val ledgers = server.ledgers().limit(PAGE_SIZE).asFlow().take(3).toList()
+
+        assertEquals(listOf(1L, 2L, 3L), ledgers.map { it.sequence })
+        // At most one page beyond the one being consumed is fetched, never the end of the stream
+        assertTrue(requestedCursors.size <= 3, "Requested cursors: $requestedCursors")
+        assertFalse(6L in requestedCursors)
+
+        server.close()
+    }
+
+    @Test
+    fun testNegativePrefetch() {
+        val server = createServer()
+
+        assertFailsWith<IllegalArgumentException> {
+            server.ledgers().asFlow(prefetch = -1)
+        }
+
+        server.close()
+    }
+}
@@ -0,0 +1,67 @@
+package com.soneso.stellar.sdk.xdr
+
+import kotlin.test.*
+
+class XdrContentEqualityTest {
+
+    private fun bytes(seed: Int, size: Int = 32) = ByteArray(size) { (it * 7 + seed).toByte() }
+
+    private fun accountKey(seed: Int): LedgerKeyXdr = LedgerKeyXdr.Account(
+        LedgerKeyAccountXdr(AccountIDXdr(PublicKeyXdr.Ed25519(Uint256Xdr(bytes(seed)))))
+    )
+
+    private fun contractDataKey(seed: Int): LedgerKeyXdr = LedgerKeyXdr.ContractData(
+        LedgerKeyContractDataXdr(
+            contract = SCAddressXdr.ContractId(ContractIDXdr(HashXdr(bytes(seed)))),
+            key = SCValXdr.Vec(SCVecXdr(listOf(SCValXdr.Bytes(SCBytesXdr(bytes(seed, 5))), SCValXdr.Sym(SCSymbolXdr("k"))))),
+            durability = ContractDataDurabilityXdr.PERSISTENT
+        )
+    )
+
+    @Test
+    fun testKeysWithEqualBytesAreEqual() {
+        assertEquals(accountKey(1), accountKey(1))
+        assertEquals(accountKey(1).hashCode(), accountKey(1).hashCode())
+        assertNotEquals(accountKey(1), accountKey(2))
+
+        assertEquals(contractDataKey(3), contractDataKey(3))
+        assertEquals(contractDataKey(3).hashCode(), contractDataKey(3).hashCode())
+        assertNotEquals(contractDataKey(3), contractDataKey(4))
+    }
+
+    @Test
+    fun testKeysWorkInHashMaps() {
+        val cache = HashMap<LedgerKeyXdr, Int>()
+        for (i in 0 until 10) {
+            cache[accountKey(i)] = i
+            cache[contractDataKey(i)] = 100 + i
+        }
+        // Freshly built keys hold different arrays with the same content
+        for (i in 0 until 10) {
+            assertEquals(i, cache[accountKey(i)])
+            assertEquals(100 + i, cache[contractDataKey(i)])
+        }
+        assertEquals(20, cache.size)
+        assertEquals(setOf(contractDataKey(1)), setOf(contractDataKey(1), contractDataKey(1)))
+    }
+
+    @Test
+    fun testCachedHashIsStable() {
+        val key = contractDataKey(5)
+        val hash = key.hashCode()
+        repeat(3) { assertEquals(hash, key.hashCode()) }
+        assertEquals(hash, contractDataKey(5).hashCode())
+    }
+
+    @Test
+    fun testOptionalAndListMembers() {
+        val name = String64Xdr("name")
+        assertEquals(ManageDataOpXdr(name, DataValueXdr(bytes(1, 4))), ManageDataOpXdr(name, DataValueXdr(bytes(1, 4))))
+        assertEquals(ManageDataOpXdr(name, null), ManageDataOpXdr(name, null))
+        assertNotEquals(ManageDataOpXdr(name, DataValueXdr(bytes(1, 4))), ManageDataOpXdr(name, null))
+
+        assertTrue(HashXdr(bytes(9)).contentEquals(HashXdr(bytes(9))))
+        assertFalse(HashXdr(bytes(9)).contentEquals(null))
+        assertEquals(bytes(9).contentHashCode(), HashXdr(bytes(9)).contentHashCode())
+    }
+}
@@ -0,0 +1,80 @@
+package com.soneso.stellar.sdk.xdr
+
+import com.soneso.stellar.sdk.*
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class XdrEncodedSizeTest {
+
+    private fun encodedBytes(encode: (XdrWriter) -> Unit): ByteArray {
+        val writer = XdrWriter()
+        encode(writer)
+        return writer.toByteArray()
+    }
+
+    private suspend fun signedTransaction(builder: (TransactionBuilder) -> Unit = {}): Transaction {
+        val source = KeyPair.fromSecretSeed("SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS")
+        val account = Account(source.getAccountId(), 2908908335136768L)
+        val transactionBuilder = TransactionBuilder(account, Network.TESTNET)
+            .addOperation(
+                PaymentOperation(
+                    destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ",
+                    asset = AssetTypeNative,
+                    amount = "200.0000000"
+                )
+            )
+            .addMemo(MemoText("size check"))
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(10, 11)))
+        builder(transactionBuilder)
+        val transaction = transactionBuilder.build()
+        transaction.sign(source)
+        return transaction
+    }
+
+    @Test
+    fun testEnvelopeSizeMatchesEncoding() = runTest {
+        val envelope = signedTransaction().toEnvelopeXdr()
+        assertEquals(encodedBytes { envelope.encode(it) }.size, envelope.encodedSize())
+    }
+
+    @Test
+    fun testSizeCoversStringsOptionalsAndPadding() {
+        val values = listOf(
+            SCValXdr.Str(SCStringXdr("héllo ✓ 😀")),
+            SCValXdr.Sym(SCSymbolXdr("abc")),
+            SCValXdr.Bytes(SCBytesXdr(ByteArray(13) { it.toByte() })),
+            SCValXdr.Vec(null),
+            SCValXdr.Map(
+                SCMapXdr(
+                    listOf(SCMapEntryXdr(SCValXdr.U32(Uint32Xdr(7u)), SCValXdr.Vec(SCVecXdr(emptyList()))))
+                )
+            )
+        )
+        for (value in values) {
+            assertEquals(encodedBytes { value.encode(it) }.size, value.encodedSize(), "size of $value")
+        }
+        assertEquals(4, AssetTypeXdr.ASSET_TYPE_NATIVE.encodedSize())
+    }
+
+    @Test
+    fun testPresizedWriterProducesSameBytes() = runTest {
+        val envelope = signedTransaction().toEnvelopeXdr()
+        val writer = XdrWriter(envelope.encodedSize())
+        envelope.encode(writer)
+        assertContentEquals(encodedBytes { envelope.encode(it) }, writer.toByteArray())
+    }
+
+    @Test
+    fun testBuilderRejectsOversizedEnvelope() = runTest {
+        val size = signedTransaction().toEnvelopeXdr().encodedSize()
+
+        // A limit equal to the signed size is accepted
+        signedTransaction { it.setMaxEnvelopeSize(size) }
+
+        val exception = assertFailsWith<IllegalStateException> {
+            signedTransaction { it.setMaxEnvelopeSize(size - 1) }
+        }
+        assertTrue(exception.message!!.contains("exceeding the limit"))
+    }
+}
@@ -0,0 +1,138 @@
+package com.soneso.stellar.sdk.xdr
+
+import com.soneso.stellar.sdk.*
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+class XdrSkipTest {
+
+    private val sourceSeed = "SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS"
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+    private val feeSource = "GDQNY3PBOJOKYZSRMK2S7LHHGWZIUISD4QORETLMXEWXBI7KFZZMKTL3"
+
+    private suspend fun signedTransaction(): Transaction {
+        val source = KeyPair.fromSecretSeed(sourceSeed)
+        val usd = AssetTypeCreditAlphaNum4("USD", feeSource)
+        val transaction = TransactionBuilder(Account(source.getAccountId(), 2908908335136768L), Network.TESTNET)
+            .addOperation(ManageDataOperation("config.memo_required", "1".encodeToByteArray()))
+            .addOperation(PaymentOperation(destination = destination, asset = AssetTypeNative, amount = "10"))
+            .addOperation(
+                PathPaymentStrictSendOperation(
+                    sendAsset = AssetTypeNative,
+                    sendAmount = "5",
+                    destination = feeSource,
+                    destAsset = usd,
+                    destMin = "1",
+                    path = listOf(usd)
+                )
+            )
+            .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+            .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(10, 11)))
+            .build()
+        transaction.sign(source)
+        return transaction
+    }
+
+    private fun encodeWithTrailer(encode: (XdrWriter) -> Unit): XdrReader {
+        val writer = XdrWriter()
+        encode(writer)
+        writer.writeInt(TRAILER)
+        return XdrReader(writer.toByteArray())
+    }
+
+    @Test
+    fun testSkipConsumesExactlyTheEncoding() = runTest {
+        val transaction = signedTransaction()
+        val envelope = transaction.toEnvelopeXdr()
+        val feeBump = FeeBumpTransaction.createWithBaseFee(feeSource, 200, transaction).toEnvelopeXdr()
+        val value = SCValXdr.Vec(SCVecXdr(listOf(SCValXdr.Str(SCStringXdr("abcde")), SCValXdr.Vec(null))))
+
+        var reader = encodeWithTrailer { envelope.encode(it) }
+        TransactionEnvelopeXdr.skip(reader)
+        assertEquals(TRAILER, reader.readInt())
+
+        reader = encodeWithTrailer { feeBump.encode(it) }
+        TransactionEnvelopeXdr.skip(reader)
+        assertEquals(TRAILER, reader.readInt())
+
+        reader = encodeWithTrailer { value.encode(it) }
+        SCValXdr.skip(reader)
+        assertEquals(TRAILER, reader.readInt())
+    }
+
+    @Test
+    fun testDecodeAccountsReadsSourcesAndDestinations() = runTest {
+        val transaction = signedTransaction()
+        val source = KeyPair.fromSecretSeed(sourceSeed).getAccountId()
+
+        val accounts = TransactionEnvelopeXdr.decodeAccounts(XdrReader(transaction.toEnvelopeXdr().toXdrBytes()))
+        assertNull(accounts.feeSource)
+        assertEquals(MemoTypeXdr.MEMO_NONE, accounts.memo.discriminant)
+        assertEquals(source, accountId(accounts.sourceAccount))
+        assertEquals(
+            listOf(OperationTypeXdr.MANAGE_DATA, OperationTypeXdr.PAYMENT, OperationTypeXdr.PATH_PAYMENT_STRICT_SEND),
+            accounts.operations.map { it.type }
+        )
+        assertEquals(listOf(null, destination, feeSource), accounts.operations.map { accountId(it.destination) })
+
+        val feeBump = FeeBumpTransaction.createWithBaseFee(feeSource, 200, transaction).toEnvelopeXdr()
+        val bumped = TransactionEnvelopeXdr.decodeAccounts(XdrReader(feeBump.toXdrBytes()))
+        assertEquals(feeSource, accountId(bumped.feeSource))
+        assertEquals(source, accountId(bumped.sourceAccount))
+        assertEquals(3, bumped.operations.size)
+    }
+
+    @Test
+    fun testDecodeReturnValueSkipsMeta() {
+        val returnValue = SCValXdr.Sym(SCSymbolXdr("done"))
+        val event = ContractEventXdr(
+            ext = ExtensionPointXdr.Void,
+            contractId = null,
+            type = ContractEventTypeXdr.CONTRACT,
+            body = ContractEventBodyXdr.V0(ContractEventV0Xdr(listOf(SCValXdr.U32(Uint32Xdr(1u))), returnValue))
+        )
+        val noChanges = LedgerEntryChangesXdr(emptyList())
+        val v3 = TransactionMetaXdr.V3(
+            TransactionMetaV3Xdr(
+                ext = ExtensionPointXdr.Void,
+                txChangesBefore = noChanges,
+                operations = emptyList(),
+                txChangesAfter = noChanges,
+                sorobanMeta = SorobanTransactionMetaXdr(SorobanTransactionMetaExtXdr.Void, listOf(event), returnValue, emptyList())
+            )
+        )
+        val v4 = TransactionMetaXdr.V4(
+            TransactionMetaV4Xdr(
+                ext = ExtensionPointXdr.Void,
+                txChangesBefore = noChanges,
+                operations = emptyList(),
+                txChangesAfter = noChanges,
+                sorobanMeta = null,
+                events = emptyList(),
+                diagnosticEvents = emptyList()
+            )
+        )
+
+        assertEquals(returnValue, TransactionMetaXdr.decodeReturnValue(XdrReader(v3.toXdrBytes())))
+        assertNull(TransactionMetaXdr.decodeReturnValue(XdrReader(v4.toXdrBytes())))
+    }
+
+    private fun accountId(account: MuxedAccountXdr?): String? =
+        (account as? MuxedAccountXdr.Ed25519)?.let { StrKey.encodeEd25519PublicKey(it.value.value) }
+
+    private fun TransactionEnvelopeXdr.toXdrBytes(): ByteArray {
+        val writer = XdrWriter()
+        encode(writer)
+        return writer.toByteArray()
+    }
+
+    private fun TransactionMetaXdr.toXdrBytes(): ByteArray {
+        val writer = XdrWriter()
+        encode(writer)
+        return writer.toByteArray()
+    }
+
+    private companion object {
+        const val TRAILER = 0x5EED5EED
+    }
+}
@@ -0,0 +1,58 @@
+package com.soneso.stellar.sdk.xdr
+
+import kotlin.test.*
+
+class XdrSliceTest {
+
+    private fun encode(block: (XdrWriter) -> Unit): ByteArray {
+        val writer = XdrWriter()
+        block(writer)
+        return writer.toByteArray()
+    }
+
+    @Test
+    fun testSliceReadsMatchCopyingReads() {
+        val hash = ByteArray(32) { (it * 7).toByte() }
+        val blob = ByteArray(13) { it.toByte() }
+        val bytes = encode {
+            HashXdr(hash).encode(it)
+            SCBytesXdr(blob).encode(it)
+            it.writeInt(42)
+        }
+
+        val reader = XdrReader(bytes)
+        val hashSlice = reader.readFixedOpaqueSlice(32)
+        val blobSlice = reader.readVariableOpaqueSlice()
+        // Padding after the 13-byte blob must be skipped
+        assertEquals(42, reader.readInt())
+
+        assertEquals(32, hashSlice.size)
+        assertTrue(hashSlice.contentEquals(hash))
+        assertContentEquals(hash, hashSlice.toByteArray())
+        assertContentEquals(blob, blobSlice.toByteArray())
+        assertEquals(blob[5], blobSlice[5])
+        assertEquals(blob.contentHashCode(), blobSlice.hashCode())
+    }
+
+    @Test
+    fun testSliceEqualityIsContentBased() {
+        val bytes = encode {
+            it.writeFixedOpaque(byteArrayOf(1, 2, 3, 4))
+            it.writeFixedOpaque(byteArrayOf(1, 2, 3, 4))
+        }
+        val reader = XdrReader(bytes)
+        val first = reader.readFixedOpaqueSlice(4)
+        val second = reader.readFixedOpaqueSlice(4)
+
+        assertEquals(first, second)
+        assertEquals(first.hashCode(), second.hashCode())
+    }
+
+    @Test
+    fun testTruncatedInputFails() {
+        val reader = XdrReader(byteArrayOf(0, 0, 0, 8, 1, 2))
+        assertFailsWith<IndexOutOfBoundsException> {
+            reader.readVariableOpaqueSlice()
+        }
+    }
+}
@@ -0,0 +1,109 @@
+package com.soneso.stellar.sdk.xdr
+
+import kotlin.io.encoding.Base64
+import kotlin.io.encoding.ExperimentalEncodingApi
+import kotlin.test.*
+
+class XdrSourceTest {
+
+    /**
+     * Hands out at most [maxChunk] bytes per read to exercise every refill path.
+     */
+    private class ChunkedSource(private val bytes: ByteArray, private val maxChunk: Int) : XdrSource {
+        private var position = 0
+
+        override fun read(buffer: ByteArray, offset: Int, length: Int): Int {
+            if (position == bytes.size) return -1
+            val count = minOf(length, maxChunk, bytes.size - position)
+            bytes.copyInto(buffer, offset, position, position + count)
+            position += count
+            return count
+        }
+    }
+
+    private fun sampleValue(): SCValXdr {
+        val entries = (0 until 200).map { i ->
+            SCMapEntryXdr(
+                SCValXdr.Sym(SCSymbolXdr("key$i")),
+                SCValXdr.Bytes(SCBytesXdr(ByteArray(i * 7) { (it + i).toByte() }))
+            )
+        }
+        // A single opaque larger than the reader's initial window
+        val blob = SCValXdr.Bytes(SCBytesXdr(ByteArray(3 * XDR_SOURCE_CHUNK_SIZE + 5) { it.toByte() }))
+        return SCValXdr.Vec(SCVecXdr(listOf(SCValXdr.Map(SCMapXdr(entries)), blob, SCValXdr.Str(SCStringXdr("end")))))
+    }
+
+    private fun encode(value: SCValXdr): ByteArray {
+        val writer = XdrWriter()
+        value.encode(writer)
+        return writer.toByteArray()
+    }
+
+    @Test
+    fun testDecodeFromChunkedSource() {
+        val bytes = encode(sampleValue())
+        for (chunk in listOf(1, 3, 4096, bytes.size)) {
+            val decoded = SCValXdr.decode(XdrReader(ChunkedSource(bytes, chunk)))
+            assertContentEquals(bytes, encode(decoded), "chunk size $chunk")
+        }
+    }
+
+    @Test
+    fun testSkipAndSlicesFromSource() {
+        val bytes = encode(sampleValue()) + byteArrayOf(0, 0, 0, 42)
+        val reader = XdrReader(ChunkedSource(bytes, 5))
+        SCValXdr.skip(reader)
+        assertEquals(42, reader.readInt())
+
+        val opaque = ByteArray(10) { it.toByte() }
+        val writer = XdrWriter()
+        writer.writeVariableOpaque(opaque)
+        writer.writeVariableOpaque(opaque)
+        val sliceReader = XdrReader(ChunkedSource(writer.toByteArray(), 2))
+        val first = sliceReader.readVariableOpaqueSlice()
+        val second = sliceReader.readVariableOpaqueSlice()
+        // Slices from a source stay valid after the window moves on
+        assertContentEquals(opaque, first.toByteArray())
+        assertEquals(first, second)
+    }
+
+    @Test
+    fun testTruncatedSourceFails() {
+        val bytes = encode(sampleValue())
+        assertFailsWith<IndexOutOfBoundsException> {
+            SCValXdr.decode(XdrReader(ChunkedSource(bytes.copyOf(bytes.size - 1), 64)))
+        }
+    }
+
+    @OptIn(ExperimentalEncodingApi::class)
+    @Test
+    fun testBase64Source() {
+        val bytes = encode(sampleValue())
+        // Lengths with every remainder modulo three, so each padding form is covered
+        for (trim in 0..2) {
+            val input = bytes.copyOf(bytes.size - trim)
+            val source = Base64XdrSource(Base64.encode(input))
+            val decoded = ByteArray(input.size + 8)
+            var filled = 0
+            var request = 1
+            while (true) {
+                val read = source.read(decoded, filled, minOf(request, decoded.size - filled))
+                if (read < 0) break
+                filled += read
+                request = request % 7 + 1
+            }
+            assertEquals(input.size, filled)
+            assertContentEquals(input, decoded.copyOf(filled))
+        }
+
+        // Spans several chunks of the platform decoder
+        val text = Base64.encode(bytes)
+        assertTrue(text.length > 2 * BASE64_SOURCE_CHUNK_LENGTH)
+        val value = SCValXdr.decode(XdrReader(Base64XdrSource(text)))
+        assertContentEquals(bytes, encode(value))
+
+        assertFailsWith<IllegalArgumentException> {
+            SCValXdr.decode(XdrReader(Base64XdrSource(text.dropLast(1))))
+        }
+    }
+}
@@ -0,0 +1,33 @@
+package com.soneso.stellar.sdk.xdr
+
+import kotlin.test.*
+
+class XdrUnionTest {
+
+    private fun TransactionResultResultXdr.roundTrip(): TransactionResultResultXdr {
+        val writer = XdrWriter()
+        encode(writer)
+        return TransactionResultResultXdr.decode(XdrReader(writer.toByteArray()))
+    }
+
+    @Test
+    fun testArmSharedByCasesKeepsDiscriminant() {
+        val failed = TransactionResultResultXdr.Results(emptyList(), TransactionResultCodeXdr.txFAILED)
+        val decoded = failed.roundTrip()
+
+        assertEquals(TransactionResultCodeXdr.txFAILED, decoded.discriminant)
+        assertEquals(failed, decoded)
+        assertNotEquals<TransactionResultResultXdr>(TransactionResultResultXdr.Results(emptyList()), decoded)
+        // The first case remains the default
+        assertEquals(TransactionResultCodeXdr.txSUCCESS, TransactionResultResultXdr.Results(emptyList()).roundTrip().discriminant)
+    }
+
+    @Test
+    fun testSharedArmOfSCError() {
+        val error = SCErrorXdr.Code(SCErrorCodeXdr.SCEC_INVALID_INPUT, SCErrorTypeXdr.SCE_AUTH)
+        val writer = XdrWriter()
+        error.encode(writer)
+
+        assertEquals(error, SCErrorXdr.decode(XdrReader(writer.toByteArray())))
+    }
+}
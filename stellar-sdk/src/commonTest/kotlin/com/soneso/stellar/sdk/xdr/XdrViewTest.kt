@@ -0,0 +1,120 @@
+package com.soneso.stellar.sdk.xdr
+
+import kotlin.test.*
+
+class XdrViewTest {
+
+    private fun removed(seed: Int): LedgerEntryChangeXdr =
+        LedgerEntryChangeXdr.Removed(LedgerKeyXdr.ContractCode(LedgerKeyContractCodeXdr(HashXdr(ByteArray(32) { (it + seed).toByte() }))))
+
+    private fun resultMeta(): TransactionResultMetaXdr = TransactionResultMetaXdr(
+        result = TransactionResultPairXdr(
+            transactionHash = HashXdr(ByteArray(32) { it.toByte() }),
+            result = TransactionResultXdr(
+                feeCharged = Int64Xdr(100),
+                result = TransactionResultResultXdr.Void(TransactionResultCodeXdr.txBAD_SEQ),
+                ext = TransactionResultExtXdr.Void
+            )
+        ),
+        feeProcessing = LedgerEntryChangesXdr(listOf(removed(1), removed(2), removed(3))),
+        txApplyProcessing = TransactionMetaXdr.Operations(emptyList())
+    )
+
+    private fun encode(prefix: Int, encode: (XdrWriter) -> Unit): ByteArray {
+        val writer = XdrWriter()
+        repeat(prefix) { writer.writeInt(it) }
+        encode(writer)
+        writer.writeInt(TRAILER)
+        return writer.toByteArray()
+    }
+
+    private fun LedgerEntryChangeXdr.toXdrBytes(): ByteArray = encode(0) { encode(it) }
+
+    @Test
+    fun testStructViewReadsMembersAtOffsets() {
+        val meta = resultMeta()
+        val buffer = encode(3) { meta.encode(it) }
+        val view = TransactionResultMetaXdrView(buffer, 12)
+
+        assertEquals(100L, view.result.result.feeCharged.value)
+        assertEquals(TransactionResultCodeXdr.txBAD_SEQ, view.result.result.result.discriminant)
+        assertEquals(0, view.txApplyProcessing.discriminant)
+        assertEquals(TRAILER, XdrReader(buffer).also { it.skip(view.endOffset) }.readInt())
+        assertContentEquals(encode(0) { meta.encode(it) }, encode(0) { view.decode().encode(it) })
+    }
+
+    @Test
+    fun testViewListAndUnionView() {
+        val meta = resultMeta()
+        val view = TransactionResultMetaXdrView(encode(0) { meta.encode(it) }, 0)
+        val changes = view.feeProcessing
+
+        assertEquals(3, changes.size)
+        changes.forEachIndexed { i, change ->
+            assertEquals(LedgerEntryChangeTypeXdr.LEDGER_ENTRY_REMOVED, change.discriminant)
+            assertNull(change.created)
+            assertContentEquals(removed(i + 1).toXdrBytes(), change.decode().toXdrBytes())
+            val key = assertNotNull(change.removed) as LedgerKeyXdr.ContractCode
+            assertEquals((i + 1).toByte(), key.value.hash.value[0])
+        }
+        assertEquals(changes[2].endOffset, changes.endOffset)
+        assertFailsWith<IndexOutOfBoundsException> { changes[3] }
+        // The list and its element offsets are reused across reads of the member
+        assertSame(changes, view.feeProcessing)
+    }
+
+    @Test
+    fun testEarlyMembersDoNotSkipLaterOnes() {
+        val meta = resultMeta()
+        // Only the first two members; txApplyProcessing is missing
+        val buffer = encode(0) {
+            meta.result.encode(it)
+            meta.feeProcessing.encode(it)
+        }
+        val view = TransactionResultMetaXdrView(buffer, 0)
+
+        assertEquals(100L, view.result.result.feeCharged.value)
+        assertEquals(3, view.feeProcessing.size)
+        // Only reaching past feeProcessing runs into the trailer instead of a transaction meta
+        assertFails { view.endOffset }
+    }
+
+    @Test
+    fun testCorruptListCountFails() {
+        val meta = resultMeta()
+        val bytes = encode(0) { meta.encode(it) }
+        // feeProcessing directly follows the result pair
+        val feeProcessingOffset = meta.result.encodedSize()
+        for (count in listOf(Int.MAX_VALUE, bytes.size / 4)) {
+            val corrupt = bytes.copyOf()
+            XdrWriter().also { it.writeInt(count) }.toByteArray().copyInto(corrupt, feeProcessingOffset)
+
+            assertFailsWith<IndexOutOfBoundsException> { TransactionResultMetaXdrView(corrupt, 0).feeProcessing }
+        }
+    }
+
+    @Test
+    fun testPositionCountsSourceBytes() {
+        val bytes = encode(0) { resultMeta().encode(it) }
+        var consumed = 0
+        // One byte at a time, so the window is compacted on every refill
+        val reader = XdrReader { buffer, offset, length ->
+            when {
+                length == 0 -> 0
+                consumed == bytes.size -> -1
+                else -> {
+                    buffer[offset] = bytes[consumed++]
+                    1
+                }
+            }
+        }
+        TransactionResultMetaXdr.skip(reader)
+        assertEquals(bytes.size - 4, reader.position)
+        assertEquals(TRAILER, reader.readInt())
+        assertEquals(bytes.size, reader.position)
+    }
+
+    private companion object {
+        const val TRAILER = 0x7E57
+    }
+}
@@ -1,8 +1,26 @@
 package com.soneso.stellar.sdk
 
+import kotlin.io.encoding.Base64
+import kotlin.io.encoding.ExperimentalEncodingApi
 import kotlin.js.Date
 
 /**
  * JavaScript implementation of currentTimeMillis using Date.now().
  */
 internal actual fun currentTimeMillis(): Long = Date.now().toLong()
+
+/**
+ * JavaScript implementation using the Kotlin Base64 codec.
+ */
+@OptIn(ExperimentalEncodingApi::class)
+internal actual fun encodeBase64(bytes: ByteArray): String = Base64.encode(bytes)
+
+/**
+ * JavaScript implementation using the Kotlin Base64 codec.
+ */
+@OptIn(ExperimentalEncodingApi::class)
+internal actual fun decodeBase64(base64: String): ByteArray = Base64.decode(base64)
+
+internal actual fun encodeHex(bytes: ByteArray): String = encodeHexPortable(bytes)
+
+internal actual fun decodeHex(hex: String): ByteArray = decodeHexPortable(hex)
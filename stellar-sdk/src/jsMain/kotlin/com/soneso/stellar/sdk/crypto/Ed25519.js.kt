@@ -161,6 +161,97 @@ internal class JsEd25519Crypto : Ed25519Crypto {
         }
     }
 
+    /**
+     * Verifies a batch of Ed25519 signatures.
+     *
+     * JavaScript is single-threaded, so items are verified sequentially; libsodium is
+     * initialized once for the whole batch instead of once per item.
+     *
+     * @param items The signatures to verify
+     * @return A [BooleanArray] where index `i` is true if `items[i]` is valid
+     */
+    override suspend fun verifyBatch(items: List<VerifyItem>): BooleanArray {
+        // Ensure libsodium is initialized
+        LibsodiumInit.ensureInitialized()
+
+        val sodium = LibsodiumInit.getSodium()
+        return BooleanArray(items.size) { index ->
+            val item = items[index]
+            if (!item.hasValidLengths()) {
+                false
+            } else {
+                val dataArray = item.data.toUint8Array()
+                val signatureArray = item.signature.toUint8Array()
+                val publicKeyArray = item.publicKey.toUint8Array()
+                js(
+                    """
+                    (function() {
+                        try {
+                            return sodium.crypto_sign_verify_detached(signatureArray, dataArray, publicKeyArray);
+                        } catch (e) {
+                            return false;
+                        }
+                    })()
+                    """
+                ).unsafeCast<Boolean>()
+            }
+        }
+    }
+
+    /**
+     * Prepares a signing key whose libsodium keypair is derived once.
+     *
+     * @param privateKey The 32-byte Ed25519 seed
+     * @return A signing key that reuses the expanded 64-byte secret key
+     */
+    override suspend fun prepareSigner(privateKey: ByteArray): Ed25519SigningKey {
+        require(privateKey.size == SEED_BYTES) { "Private key must be $SEED_BYTES bytes" }
+
+        // Ensure libsodium is initialized
+        LibsodiumInit.ensureInitialized()
+
+        return try {
+            val sodium = LibsodiumInit.getSodium()
+            val seedArray = privateKey.toUint8Array()
+            val keypair: dynamic = js("sodium.crypto_sign_seed_keypair(seedArray)")
+            JsEd25519SigningKey(
+                secretKey = keypair.privateKey.unsafeCast<Uint8Array>(),
+                publicKeyBytes = keypair.publicKey.unsafeCast<Uint8Array>().toByteArray()
+            )
+        } catch (e: Throwable) {
+            throw IllegalStateException("Failed to prepare signing key: ${e.message}", e)
+        }
+    }
+
+    /**
+     * libsodium.js-backed [Ed25519SigningKey] holding the expanded secret key.
+     */
+    private inner class JsEd25519SigningKey(
+        private var secretKey: Uint8Array?,
+        private val publicKeyBytes: ByteArray
+    ) : Ed25519SigningKey {
+
+        override val publicKey: ByteArray
+            get() = publicKeyBytes.copyOf()
+
+        override suspend fun sign(data: ByteArray): ByteArray {
+            val sk = secretKey ?: throw IllegalStateException("Signing key has been closed")
+
+            return try {
+                val sodium = LibsodiumInit.getSodium()
+                val dataArray = data.toUint8Array()
+                js("sodium.crypto_sign_detached(dataArray, sk)").unsafeCast<Uint8Array>().toByteArray()
+            } catch (e: Throwable) {
+                throw IllegalStateException("Failed to sign data: ${e.message}", e)
+            }
+        }
+
+        override fun close() {
+            secretKey?.asDynamic()?.fill(0)
+            secretKey = null
+        }
+    }
+
     // Helper extension functions
     private fun ByteArray.toUint8Array(): Uint8Array {
         val array = Uint8Array(this.size)
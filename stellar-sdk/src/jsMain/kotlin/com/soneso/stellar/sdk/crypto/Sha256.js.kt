@@ -36,6 +36,33 @@ internal class Sha256CryptoJs : Sha256Crypto {
         }
     }
 
+    override suspend fun newHasher(): Sha256Hasher {
+        // Ensure libsodium is initialized before use
+        LibsodiumInit.ensureInitialized()
+
+        return LibsodiumSha256Hasher()
+    }
+
+    /**
+     * [Sha256Hasher] backed by libsodium.js `crypto_hash_sha256_init/update/final` (sumo build).
+     */
+    private inner class LibsodiumSha256Hasher : Sha256Hasher {
+        private val sodium = LibsodiumInit.getSodium()
+        private val state: dynamic = sodium.crypto_hash_sha256_init()
+
+        override fun update(data: ByteArray, offset: Int, length: Int) {
+            require(offset >= 0 && length >= 0 && offset + length <= data.size) { "Invalid range" }
+            if (length == 0) return
+
+            val chunk = data.copyOfRange(offset, offset + length).toUint8Array()
+            sodium.crypto_hash_sha256_update(state, chunk)
+        }
+
+        override fun digest(): ByteArray {
+            return sodium.crypto_hash_sha256_final(state).unsafeCast<Uint8Array>().toByteArray()
+        }
+    }
+
     // Helper extension functions
     private fun ByteArray.toUint8Array(): Uint8Array {
         val array = Uint8Array(this.size)
@@ -4,3 +4,21 @@ package com.soneso.stellar.sdk
  * JVM implementation of currentTimeMillis using System.currentTimeMillis().
  */
 internal actual fun currentTimeMillis(): Long = System.currentTimeMillis()
+
+/**
+ * JVM implementation using java.util.Base64, which is intrinsified by the JIT.
+ */
+internal actual fun encodeBase64(bytes: ByteArray): String = java.util.Base64.getEncoder().encodeToString(bytes)
+
+/**
+ * JVM implementation using java.util.Base64.
+ */
+internal actual fun decodeBase64(base64: String): ByteArray {
+    // java.util.Base64 accepts missing padding, which libsodium and the Kotlin codec reject
+    require(base64.length % 4 == 0) { "Invalid Base64 input" }
+    return java.util.Base64.getDecoder().decode(base64)
+}
+
+internal actual fun encodeHex(bytes: ByteArray): String = encodeHexPortable(bytes)
+
+internal actual fun decodeHex(hex: String): ByteArray = decodeHexPortable(hex)
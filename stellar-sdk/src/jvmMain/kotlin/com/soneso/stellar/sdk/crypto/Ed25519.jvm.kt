@@ -59,9 +59,97 @@ internal class JvmEd25519Crypto : Ed25519Crypto {
         verifier.update(data, 0, data.size)
         return verifier.verifySignature(signature)
     }
+
+    override suspend fun verifyBatch(items: List<VerifyItem>): BooleanArray {
+        return verifyChunked(items) { batch, from, to, results ->
+            // One signer per chunk; verifySignature() resets its message buffer after each item
+            val verifier = Ed25519Signer()
+            for (index in from until to) {
+                val item = batch[index]
+                results[index] = item.hasValidLengths() && try {
+                    verifier.init(false, Ed25519PublicKeyParameters(item.publicKey, 0))
+                    verifier.update(item.data, 0, item.data.size)
+                    verifier.verifySignature(item.signature)
+                } catch (e: IllegalArgumentException) {
+                    // Public key is not a valid curve point
+                    verifier.reset()
+                    false
+                }
+            }
+        }
+    }
+
+    override suspend fun prepareSigner(privateKey: ByteArray): Ed25519SigningKey {
+        require(privateKey.size == 32) { "Private key must be 32 bytes" }
+        return JvmEd25519SigningKey(Ed25519PrivateKeyParameters(privateKey, 0))
+    }
+}
+
+/**
+ * BouncyCastle-backed [Ed25519SigningKey].
+ *
+ * `Ed25519PrivateKeyParameters` caches its public key after the first derivation, so keeping
+ * the parameters alive avoids the scalar base multiplication that [JvmEd25519Crypto.sign]
+ * pays on every call. A fresh `Ed25519Signer` is still created per signature because it
+ * buffers the message and is not thread-safe.
+ */
+private class JvmEd25519SigningKey(
+    @Volatile private var privateKey: Ed25519PrivateKeyParameters?
+) : Ed25519SigningKey {
+
+    private val publicKeyBytes: ByteArray = privateKey!!.generatePublicKey().encoded
+
+    override val publicKey: ByteArray
+        get() = publicKeyBytes.copyOf()
+
+    override suspend fun sign(data: ByteArray): ByteArray {
+        val key = privateKey ?: throw IllegalStateException("Signing key has been closed")
+        val signer = Ed25519Signer()
+        signer.init(true, key)
+        signer.update(data, 0, data.size)
+        return signer.generateSignature()
+    }
+
+    override fun close() {
+        // BouncyCastle keeps the key bytes internally; dropping the reference is all we can do
+        privateKey = null
+    }
 }
 
 /**
  * Get the JVM-specific Ed25519 crypto implementation.
+ *
+ * Chosen once per JVM from the `stellar.sdk.ed25519` system property:
+ * - `bouncycastle` (default): [JvmEd25519Crypto]
+ * - `libsodium`: [JvmSodiumEd25519Crypto]; fails if JNA or libsodium cannot be loaded
+ * - `auto`: libsodium if it can be loaded, BouncyCastle otherwise
+ *
+ * ```
+ * java -Dstellar.sdk.ed25519=libsodium -jar server.jar
+ * ```
  */
-actual fun getEd25519Crypto(): Ed25519Crypto = JvmEd25519Crypto()
+actual fun getEd25519Crypto(): Ed25519Crypto = jvmEd25519Crypto
+
+private val jvmEd25519Crypto: Ed25519Crypto by lazy {
+    when (val provider = System.getProperty(ED25519_PROVIDER_PROPERTY, "bouncycastle")) {
+        "bouncycastle" -> JvmEd25519Crypto()
+        "libsodium" -> {
+            check(isSodiumAvailable()) { "$ED25519_PROVIDER_PROPERTY=libsodium, but JNA or libsodium cannot be loaded" }
+            JvmSodiumEd25519Crypto()
+        }
+        "auto" -> if (isSodiumAvailable()) JvmSodiumEd25519Crypto() else JvmEd25519Crypto()
+        else -> throw IllegalStateException("Unknown $ED25519_PROVIDER_PROPERTY provider: $provider")
+    }
+}
+
+private const val ED25519_PROVIDER_PROPERTY = "stellar.sdk.ed25519"
+
+// JNA is an optional dependency: check for it before touching any class that links against it
+private fun isSodiumAvailable(): Boolean = try {
+    Class.forName("com.sun.jna.Native")
+    JvmSodiumEd25519Crypto.isAvailable()
+} catch (e: ClassNotFoundException) {
+    false
+} catch (e: LinkageError) {
+    false
+}
@@ -0,0 +1,234 @@
+package com.soneso.stellar.sdk.crypto
+
+import com.sun.jna.Memory
+import com.sun.jna.Native
+import com.sun.jna.Pointer
+import java.lang.ref.Cleaner
+import java.util.concurrent.atomic.AtomicInteger
+
+/**
+ * JVM implementation of Ed25519 cryptographic operations calling libsodium through JNA.
+ *
+ * Produces the same signatures as [JvmEd25519Crypto] (Ed25519 is deterministic), using
+ * libsodium's optimized Ed25519 instead of BouncyCastle's pure-Java implementation. Expanded
+ * secret keys live outside the JVM heap: in JNA memory for the duration of [sign], and in
+ * `sodium_malloc` guarded memory for a [prepareSigner] key.
+ *
+ * Requirements:
+ * - JNA (`net.java.dev.jna:jna`) on the classpath; it is an optional dependency of the SDK
+ * - libsodium installed, e.g. `apt install libsodium23` or `brew install libsodium`; set
+ *   `jna.library.path` if it is not on the default library path
+ * - a 64-bit JVM, as `size_t` arguments are passed as 64-bit values
+ *
+ * Selected with the `stellar.sdk.ed25519` system property, see [getEd25519Crypto].
+ *
+ * @see <a href="https://libsodium.gitbook.io/doc/">libsodium documentation</a>
+ */
+internal class JvmSodiumEd25519Crypto : Ed25519Crypto {
+
+    override val libraryName: String = "libsodium (JNA)"
+
+    init {
+        check(Sodium.initialize()) { "libsodium is not available" }
+    }
+
+    override suspend fun generatePrivateKey(): ByteArray {
+        val seed = ByteArray(SEED_BYTES)
+        Sodium.randombytes_buf(seed, SEED_BYTES.toLong())
+        return seed
+    }
+
+    override suspend fun derivePublicKey(privateKey: ByteArray): ByteArray {
+        require(privateKey.size == SEED_BYTES) { "Private key must be $SEED_BYTES bytes" }
+        val publicKey = ByteArray(PUBLIC_KEY_BYTES)
+        val secretKey = Memory(SECRET_KEY_BYTES.toLong())
+        try {
+            check(Sodium.crypto_sign_seed_keypair(publicKey, secretKey, privateKey) == 0) {
+                "Failed to derive keypair from seed"
+            }
+        } finally {
+            secretKey.clear()
+        }
+        return publicKey
+    }
+
+    override suspend fun sign(data: ByteArray, privateKey: ByteArray): ByteArray {
+        require(privateKey.size == SEED_BYTES) { "Private key must be $SEED_BYTES bytes" }
+        val publicKey = ByteArray(PUBLIC_KEY_BYTES)
+        val secretKey = Memory(SECRET_KEY_BYTES.toLong())
+        val signature = ByteArray(SIGNATURE_BYTES)
+        try {
+            check(Sodium.crypto_sign_seed_keypair(publicKey, secretKey, privateKey) == 0) {
+                "Failed to derive keypair from seed"
+            }
+            check(Sodium.crypto_sign_detached(signature, null, data, data.size.toLong(), secretKey) == 0) {
+                "Failed to sign data"
+            }
+        } finally {
+            // Zero out sensitive key material
+            secretKey.clear()
+        }
+        return signature
+    }
+
+    override suspend fun verify(data: ByteArray, signature: ByteArray, publicKey: ByteArray): Boolean {
+        require(publicKey.size == PUBLIC_KEY_BYTES) { "Public key must be $PUBLIC_KEY_BYTES bytes" }
+        require(signature.size == SIGNATURE_BYTES) { "Signature must be $SIGNATURE_BYTES bytes" }
+        return Sodium.crypto_sign_verify_detached(signature, data, data.size.toLong(), publicKey) == 0
+    }
+
+    override suspend fun verifyBatch(items: List<VerifyItem>): BooleanArray {
+        return verifyChunked(items) { batch, from, to, results ->
+            for (index in from until to) {
+                val item = batch[index]
+                results[index] = item.hasValidLengths() &&
+                    Sodium.crypto_sign_verify_detached(item.signature, item.data, item.data.size.toLong(), item.publicKey) == 0
+            }
+        }
+    }
+
+    override suspend fun prepareSigner(privateKey: ByteArray): Ed25519SigningKey {
+        require(privateKey.size == SEED_BYTES) { "Private key must be $SEED_BYTES bytes" }
+        return JvmSodiumEd25519SigningKey(privateKey)
+    }
+
+    companion object {
+        // Ed25519 constants from libsodium
+        private const val SEED_BYTES = 32  // crypto_sign_SEEDBYTES
+        private const val PUBLIC_KEY_BYTES = 32  // crypto_sign_PUBLICKEYBYTES
+        internal const val SECRET_KEY_BYTES = 64  // crypto_sign_SECRETKEYBYTES
+        internal const val SIGNATURE_BYTES = 64  // crypto_sign_BYTES
+
+        /**
+         * Whether libsodium can be loaded in this JVM. Requires JNA on the classpath.
+         */
+        fun isAvailable(): Boolean = Sodium.initialize()
+    }
+}
+
+/**
+ * libsodium-backed [Ed25519SigningKey] for the JVM.
+ *
+ * Mirrors the native signing key: the seed is expanded with `crypto_sign_seed_keypair` once
+ * into a 64-byte secret key allocated with `sodium_malloc` and switched to read-only, so
+ * concurrent [sign] calls only read from it. The region is wiped and released by [close], or
+ * by a cleaner once the key is garbage; a [close] racing [sign] defers the release until the
+ * signatures in flight are done, as freeing it under them would crash the JVM.
+ */
+private class JvmSodiumEd25519SigningKey(seed: ByteArray) : Ed25519SigningKey {
+
+    private val secretKey = GuardedSecretKey()
+
+    @Suppress("unused")
+    private val cleanable: Cleaner.Cleanable = cleaner.register(this, secretKey::free)
+
+    private val publicKeyBytes: ByteArray = ByteArray(32)
+
+    override val publicKey: ByteArray
+        get() = publicKeyBytes.copyOf()
+
+    init {
+        if (Sodium.crypto_sign_seed_keypair(publicKeyBytes, secretKey.pointer, seed) != 0) {
+            secretKey.free()
+            throw IllegalStateException("Failed to derive keypair from seed")
+        }
+        Sodium.sodium_mprotect_readonly(secretKey.pointer)
+    }
+
+    override suspend fun sign(data: ByteArray): ByteArray {
+        val signature = ByteArray(JvmSodiumEd25519Crypto.SIGNATURE_BYTES)
+        val result = secretKey.use { sk ->
+            Sodium.crypto_sign_detached(signature, null, data, data.size.toLong(), sk)
+        }
+        check(result == 0) { "Failed to sign data" }
+        return signature
+    }
+
+    override fun close() {
+        cleanable.clean()
+    }
+
+    private companion object {
+        val cleaner: Cleaner = Cleaner.create()
+    }
+
+    /**
+     * Owns the `sodium_malloc` region. Kept separate from the signing key so the cleaner
+     * does not capture the key itself, and so [free] is idempotent between [close] and the cleaner.
+     *
+     * [use] counts the signatures in flight; [free] marks the key closed and the region is
+     * released by whichever of [free] and the last [use] finishes later.
+     */
+    private class GuardedSecretKey {
+        val pointer: Pointer = Sodium.sodium_malloc(JvmSodiumEd25519Crypto.SECRET_KEY_BYTES.toLong())
+            ?: throw IllegalStateException("Failed to allocate guarded memory for signing key")
+
+        // Number of users in flight, with CLOSED set once freed
+        private val state = AtomicInteger(0)
+
+        fun <T> use(block: (Pointer) -> T): T {
+            while (true) {
+                val current = state.get()
+                if (current and CLOSED != 0) throw IllegalStateException("Signing key has been closed")
+                if (state.compareAndSet(current, current + 1)) break
+            }
+            try {
+                return block(pointer)
+            } finally {
+                if (state.decrementAndGet() == CLOSED) release()
+            }
+        }
+
+        fun free() {
+            while (true) {
+                val current = state.get()
+                if (current and CLOSED != 0) return
+                if (state.compareAndSet(current, current or CLOSED)) {
+                    if (current == 0) release()
+                    return
+                }
+            }
+        }
+
+        private fun release() {
+            // sodium_free restores write access and zeroes the region before unmapping it
+            Sodium.sodium_free(pointer)
+        }
+
+        private companion object {
+            const val CLOSED = 1 shl 30
+        }
+    }
+}
+
+/**
+ * JNA direct mapping of the libsodium functions used for Ed25519.
+ *
+ * Direct mapping binds the static `external` functions below when [initialize] first runs,
+ * avoiding the reflection of JNA interface proxies on every call.
+ */
+@Suppress("FunctionName")
+internal object Sodium {
+
+    // True once libsodium was bound and initialized; false if the library cannot be loaded
+    private val initialized: Boolean by lazy {
+        try {
+            if (Native.SIZE_T_SIZE != 8) return@lazy false
+            Native.register(Sodium::class.java, "sodium")
+            sodium_init() >= 0
+        } catch (e: LinkageError) {
+            false
+        }
+    }
+
+    fun initialize(): Boolean = initialized
+
+    @JvmStatic external fun sodium_init(): Int
+    @JvmStatic external fun randombytes_buf(buf: ByteArray, size: Long)
+    @JvmStatic external fun sodium_malloc(size: Long): Pointer?
+    @JvmStatic external fun sodium_free(ptr: Pointer)
+    @JvmStatic external fun sodium_mprotect_readonly(ptr: Pointer): Int
+    @JvmStatic external fun crypto_sign_seed_keypair(pk: ByteArray, sk: Pointer, seed: ByteArray): Int
+    @JvmStatic external fun crypto_sign_detached(sig: ByteArray, siglen: Pointer?, m: ByteArray, mlen: Long, sk: Pointer): Int
+    @JvmStatic external fun crypto_sign_verify_detached(sig: ByteArray, m: ByteArray, mlen: Long, pk: ByteArray): Int
+}
@@ -15,6 +15,21 @@ internal class Sha256CryptoJvm : Sha256Crypto {
         val digest = MessageDigest.getInstance("SHA-256")
         return digest.digest(data)
     }
+
+    override suspend fun newHasher(): Sha256Hasher = MessageDigestSha256Hasher()
+}
+
+/**
+ * [Sha256Hasher] backed by a dedicated MessageDigest instance.
+ */
+private class MessageDigestSha256Hasher : Sha256Hasher {
+    private val digest = MessageDigest.getInstance("SHA-256")
+
+    override fun update(data: ByteArray, offset: Int, length: Int) {
+        digest.update(data, offset, length)
+    }
+
+    override fun digest(): ByteArray = digest.digest()
 }
 
 actual fun getSha256Crypto(): Sha256Crypto = Sha256CryptoJvm()
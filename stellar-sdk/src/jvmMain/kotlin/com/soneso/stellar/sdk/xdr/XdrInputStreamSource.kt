@@ -0,0 +1,11 @@
+package com.soneso.stellar.sdk.xdr
+
+import java.io.InputStream
+
+/**
+ * Adapts this stream as an [XdrSource], so an [XdrReader] can decode directly from it.
+ *
+ * Reads block on the stream; with ktor, a response channel can be decoded on an I/O thread
+ * through `channel.toInputStream().asXdrSource()`.
+ */
+fun InputStream.asXdrSource(): XdrSource = XdrSource { buffer, offset, length -> read(buffer, offset, length) }
@@ -1,12 +1,24 @@
 // JVM implementation of XDR Writer
 package com.soneso.stellar.sdk.xdr
 
+import java.io.BufferedOutputStream
 import java.io.ByteArrayOutputStream
 import java.io.DataOutputStream
+import java.io.OutputStream
 
-actual class XdrWriter actual constructor() {
-    private val byteStream = ByteArrayOutputStream()
-    private val stream = DataOutputStream(byteStream)
+actual class XdrWriter private constructor(
+    private val byteStream: ByteArrayOutputStream?,
+    output: OutputStream
+) {
+    private val stream = DataOutputStream(output)
+
+    actual constructor() : this(ByteArrayOutputStream())
+
+    actual constructor(initialCapacity: Int) : this(ByteArrayOutputStream(initialCapacity))
+
+    private constructor(byteStream: ByteArrayOutputStream) : this(byteStream, byteStream)
+
+    actual constructor(sink: XdrSink) : this(null, BufferedOutputStream(SinkOutputStream(sink), XDR_SINK_CHUNK_SIZE))
 
     actual fun writeInt(value: Int) = stream.writeInt(value)
 
@@ -23,7 +35,7 @@ actual class XdrWriter actual constructor() {
     actual fun writeBoolean(value: Boolean) = stream.writeInt(if (value) 1 else 0)
 
     actual fun writeString(value: String) {
-        val bytes = value.encodeToByteArray()
+        val bytes = xdrEncodeUtf8(value)
         stream.writeInt(bytes.size)
         stream.write(bytes)
         // Pad to 4-byte boundary
@@ -48,5 +60,14 @@ actual class XdrWriter actual constructor() {
 
     actual fun flush() = stream.flush()
 
-    actual fun toByteArray(): ByteArray = byteStream.toByteArray()
+    actual fun toByteArray(): ByteArray {
+        val bytes = checkNotNull(byteStream) { "XdrWriter writes to a sink; call flush() instead of toByteArray()" }
+        return bytes.toByteArray()
+    }
+
+    private class SinkOutputStream(private val sink: XdrSink) : OutputStream() {
+        override fun write(b: Int) = sink.write(byteArrayOf(b.toByte()), 0, 1)
+
+        override fun write(b: ByteArray, off: Int, len: Int) = sink.write(b, off, len)
+    }
 }
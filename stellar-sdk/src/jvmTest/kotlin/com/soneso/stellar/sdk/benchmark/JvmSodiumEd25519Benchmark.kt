@@ -0,0 +1,49 @@
+package com.soneso.stellar.sdk.benchmark
+
+import com.soneso.stellar.sdk.crypto.Ed25519Crypto
+import com.soneso.stellar.sdk.crypto.JvmEd25519Crypto
+import com.soneso.stellar.sdk.crypto.JvmSodiumEd25519Crypto
+import kotlinx.coroutines.test.runTest
+import org.junit.jupiter.api.Assumptions.assumeTrue
+import kotlin.test.Test
+import kotlin.time.TimeSource
+
+/**
+ * Compares sign and verify throughput of the libsodium provider with BouncyCastle on the JVM.
+ *
+ * Skipped when libsodium cannot be loaded, and by the test task unless Gradle runs with
+ * `-Pbenchmark`.
+ */
+class JvmSodiumEd25519Benchmark {
+
+    private val bouncyCastle = JvmEd25519Crypto()
+
+    @Test
+    fun benchmarkAgainstBouncyCastle() = runTest {
+        assumeTrue(JvmSodiumEd25519Crypto.isAvailable(), "libsodium is not available")
+        val sodium = JvmSodiumEd25519Crypto()
+        val seed = bouncyCastle.generatePrivateKey()
+        val publicKey = bouncyCastle.derivePublicKey(seed)
+        // A transaction hash, as signed and verified for every envelope
+        val hash = ByteArray(32) { it.toByte() }
+        val signature = bouncyCastle.sign(hash, seed)
+
+        for (crypto in listOf<Ed25519Crypto>(bouncyCastle, sodium)) {
+            val signer = crypto.prepareSigner(seed)
+            // Warm-up
+            repeat(2_000) {
+                signer.sign(hash)
+                crypto.verify(hash, signature, publicKey)
+            }
+
+            var mark = TimeSource.Monotonic.markNow()
+            repeat(10_000) { signer.sign(hash) }
+            println("[benchmark] ed25519 ${crypto.libraryName} sign: ${mark.elapsedNow().inWholeNanoseconds / 10_000} ns/op")
+
+            mark = TimeSource.Monotonic.markNow()
+            repeat(10_000) { crypto.verify(hash, signature, publicKey) }
+            println("[benchmark] ed25519 ${crypto.libraryName} verify: ${mark.elapsedNow().inWholeNanoseconds / 10_000} ns/op")
+            signer.close()
+        }
+    }
+}
@@ -0,0 +1,88 @@
+package com.soneso.stellar.sdk.crypto
+
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import org.junit.jupiter.api.Assumptions.assumeTrue
+import kotlin.test.*
+
+/**
+ * Checks the libsodium provider against BouncyCastle.
+ *
+ * Skipped when libsodium cannot be loaded.
+ */
+class JvmSodiumEd25519CryptoTest {
+
+    private val bouncyCastle = JvmEd25519Crypto()
+
+    private fun sodium(): JvmSodiumEd25519Crypto {
+        assumeTrue(JvmSodiumEd25519Crypto.isAvailable(), "libsodium is not available")
+        return JvmSodiumEd25519Crypto()
+    }
+
+    @Test
+    fun testMatchesBouncyCastle() = runTest {
+        val sodium = sodium()
+        repeat(20) { i ->
+            val seed = sodium.generatePrivateKey()
+            val data = ByteArray(i * 7) { (it * 31 + i).toByte() }
+
+            val publicKey = sodium.derivePublicKey(seed)
+            assertContentEquals(bouncyCastle.derivePublicKey(seed), publicKey)
+            val signature = sodium.sign(data, seed)
+            assertContentEquals(bouncyCastle.sign(data, seed), signature)
+
+            assertTrue(sodium.verify(data, signature, publicKey))
+            assertTrue(bouncyCastle.verify(data, signature, publicKey))
+            signature[0] = (signature[0] + 1).toByte()
+            assertFalse(sodium.verify(data, signature, publicKey))
+        }
+    }
+
+    @Test
+    fun testPreparedSignerAndBatch() = runTest {
+        val sodium = sodium()
+        val seed = sodium.generatePrivateKey()
+        val signer = sodium.prepareSigner(seed)
+        val messages = List(200) { i -> ByteArray(32) { (it + i).toByte() } }
+        val signatures = messages.map { signer.sign(it) }
+        assertContentEquals(sodium.derivePublicKey(seed), signer.publicKey)
+        messages.zip(signatures).forEach { (message, signature) ->
+            assertContentEquals(bouncyCastle.sign(message, seed), signature)
+        }
+
+        val items = messages.mapIndexed { i, message ->
+            VerifyItem(message, if (i == 5) ByteArray(64) else signatures[i], signer.publicKey)
+        } + VerifyItem(messages[0], ByteArray(10), signer.publicKey)
+        val results = sodium.verifyBatch(items)
+        assertContentEquals(bouncyCastle.verifyBatch(items), results)
+        assertEquals(listOf(5, 200), results.indices.filter { !results[it] })
+
+        signer.close()
+        assertFailsWith<IllegalStateException> { signer.sign(messages[0]) }
+    }
+
+    @Test
+    fun testCloseWhileSigning() = runTest {
+        val sodium = sodium()
+        val seed = sodium.generatePrivateKey()
+        val expected = sodium.sign(ByteArray(32), seed)
+        repeat(20) {
+            val signer = sodium.prepareSigner(seed)
+            // Freeing the key under a running signature would crash the JVM
+            val results = withContext(Dispatchers.Default) {
+                val signatures = List(8) {
+                    async { List(200) { runCatching { signer.sign(ByteArray(32)) } } }
+                }
+                signer.close()
+                signatures.awaitAll().flatten()
+            }
+            results.forEach { result ->
+                result.onSuccess { assertContentEquals(expected, it) }
+                result.onFailure { assertIs<IllegalStateException>(it) }
+            }
+        }
+    }
+}
@@ -0,0 +1,47 @@
+package com.soneso.stellar.sdk.xdr
+
+import com.soneso.stellar.sdk.*
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Checks that strings with unpaired surrogates encode to as many bytes as their encoded size
+ * reports. The JVM's own UTF-8 encoder replaces them with `?` instead of U+FFFD.
+ */
+class XdrStringEncodingTest {
+
+    private val source = "SCH27VUZZ6UAKB67BDNF6FA42YMBMQCBKXWGMFD5TZ6S5ZZCZFLRXKHS"
+    private val destination = "GA7QYNF7SOWQ3GLR2BGMZEHXAVIRZA4KVWLTJJFC7MGXUA74P7UJVSGZ"
+
+    @Test
+    fun testUnpairedSurrogatesEncodeAsReplacementCharacter() {
+        for (value in listOf("a\uD800b", "\uDC00", "x\uD83D", "😀\uDE00", "plain", "é€😀")) {
+            val writer = XdrWriter()
+            value.encode(writer)
+            val bytes = writer.toByteArray()
+
+            assertEquals(value.encodedSize(), bytes.size, "encoded size of \"$value\"")
+            val expected = value.replace(Regex("\\p{Cs}"), "\uFFFD")
+            assertEquals(expected, XdrReader(bytes).readString())
+        }
+    }
+
+    @Test
+    fun testTemplateWithUnpairedSurrogateInMemo() = runTest {
+        val keypair = KeyPair.fromSecretSeed(source)
+
+        suspend fun build(sequenceNumber: Long, payment: TransactionTemplate.Payment): Transaction =
+            TransactionBuilder(Account(keypair.getAccountId(), sequenceNumber - 1), Network.TESTNET)
+                .setBaseFee(AbstractTransaction.MIN_BASE_FEE)
+                .addMemo(MemoText("pay\uD800out"))
+                .addPreconditions(TransactionPreconditions(timeBounds = TimeBounds(0, 1_900_000_000)))
+                .addOperation(PaymentOperation(payment.destination, AssetTypeNative, payment.amount))
+                .build()
+
+        val template = TransactionTemplate.fromTransaction(build(100, TransactionTemplate.Payment(destination, "1")))
+        val payment = TransactionTemplate.Payment(KeyPair.random().getAccountId(), "42")
+        val patched = template.instantiate(7, listOf(payment))
+
+        assertContentEquals(build(7, payment).signatureBase(), patched.signatureBase())
+    }
+}
@@ -1,10 +1,20 @@
 package com.soneso.stellar.sdk
 
+import libsodium.sodium_base642bin
+import libsodium.sodium_base64_VARIANT_ORIGINAL
+import libsodium.sodium_bin2base64
+import libsodium.sodium_bin2hex
+import libsodium.sodium_hex2bin
 import platform.posix.gettimeofday
+import platform.posix.size_tVar
 import platform.posix.timeval
+import kotlinx.cinterop.addressOf
 import kotlinx.cinterop.alloc
 import kotlinx.cinterop.memScoped
 import kotlinx.cinterop.ptr
+import kotlinx.cinterop.reinterpret
+import kotlinx.cinterop.usePinned
+import kotlinx.cinterop.value
 import kotlinx.cinterop.ExperimentalForeignApi
 
 /**
@@ -16,3 +26,98 @@ internal actual fun currentTimeMillis(): Long = memScoped {
     gettimeofday(tv.ptr, null)
     tv.tv_sec * 1000L + tv.tv_usec / 1000L
 }
+
+/**
+ * Native implementation using libsodium's sodium_bin2base64 over pinned buffers.
+ */
+@OptIn(ExperimentalForeignApi::class)
+internal actual fun encodeBase64(bytes: ByteArray): String {
+    if (bytes.isEmpty()) return ""
+    // Four characters per started group of three bytes, plus the terminating NUL
+    val encoded = ByteArray((bytes.size + 2) / 3 * 4 + 1)
+    encoded.usePinned { out ->
+        bytes.usePinned { bin ->
+            sodium_bin2base64(
+                out.addressOf(0),
+                encoded.size.toULong(),
+                bin.addressOf(0).reinterpret(),
+                bytes.size.toULong(),
+                sodium_base64_VARIANT_ORIGINAL
+            )
+        }
+    }
+    return encoded.decodeToString(0, encoded.size - 1)
+}
+
+/**
+ * Native implementation using libsodium's sodium_base642bin over pinned buffers.
+ */
+@OptIn(ExperimentalForeignApi::class)
+internal actual fun decodeBase64(base64: String): ByteArray {
+    if (base64.isEmpty()) return ByteArray(0)
+    val input = base64.encodeToByteArray()
+    val decoded = ByteArray(input.size / 4 * 3 + 3)
+    val length = memScoped {
+        val binLength = alloc<size_tVar>()
+        val result = decoded.usePinned { bin ->
+            input.usePinned { b64 ->
+                // A null end pointer makes libsodium reject input that is not consumed entirely
+                sodium_base642bin(
+                    bin.addressOf(0).reinterpret(),
+                    decoded.size.toULong(),
+                    b64.addressOf(0),
+                    input.size.toULong(),
+                    null,
+                    binLength.ptr,
+                    null,
+                    sodium_base64_VARIANT_ORIGINAL
+                )
+            }
+        }
+        require(result == 0) { "Invalid Base64 input" }
+        binLength.value.toInt()
+    }
+    return if (length == decoded.size) decoded else decoded.copyOf(length)
+}
+
+/**
+ * Native implementation using libsodium's sodium_bin2hex over pinned buffers.
+ */
+@OptIn(ExperimentalForeignApi::class)
+internal actual fun encodeHex(bytes: ByteArray): String {
+    if (bytes.isEmpty()) return ""
+    val encoded = ByteArray(bytes.size * 2 + 1)
+    encoded.usePinned { out ->
+        bytes.usePinned { bin ->
+            sodium_bin2hex(out.addressOf(0), encoded.size.toULong(), bin.addressOf(0).reinterpret(), bytes.size.toULong())
+        }
+    }
+    return encoded.decodeToString(0, encoded.size - 1)
+}
+
+/**
+ * Native implementation using libsodium's sodium_hex2bin over pinned buffers.
+ */
+@OptIn(ExperimentalForeignApi::class)
+internal actual fun decodeHex(hex: String): ByteArray {
+    require(hex.length % 2 == 0) { "Hex string must have even length" }
+    if (hex.isEmpty()) return ByteArray(0)
+    val input = hex.encodeToByteArray()
+    val decoded = ByteArray(hex.length / 2)
+    val result = decoded.usePinned { bin ->
+        input.usePinned { chars ->
+            // A null end pointer makes libsodium reject any non-hex character
+            sodium_hex2bin(
+                bin.addressOf(0).reinterpret(),
+                decoded.size.toULong(),
+                chars.addressOf(0),
+                input.size.toULong(),
+                null,
+                null,
+                null
+            )
+        }
+    }
+    require(result == 0) { "Invalid hex string" }
+    return decoded
+}
@@ -3,6 +3,10 @@ package com.soneso.stellar.sdk.crypto
 import kotlinx.cinterop.*
 import libsodium.*
 import platform.posix.memcpy
+import kotlin.concurrent.AtomicInt
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.Cleaner
+import kotlin.native.ref.createCleaner
 
 /**
  * Native (iOS/macOS) implementation of Ed25519 cryptographic operations using libsodium.
@@ -163,6 +167,162 @@ internal class NativeEd25519Crypto : Ed25519Crypto {
             }
         }
     }
+
+    override suspend fun verifyBatch(items: List<VerifyItem>): BooleanArray {
+        return verifyChunked(items) { batch, from, to, results ->
+            memScoped {
+                // Signature and public key buffers are allocated once per chunk and refilled per item
+                val sigBuffer = allocArray<UByteVar>(SIGNATURE_BYTES)
+                val pkBuffer = allocArray<UByteVar>(PUBLIC_KEY_BYTES)
+
+                for (index in from until to) {
+                    val item = batch[index]
+                    if (!item.hasValidLengths()) {
+                        results[index] = false
+                        continue
+                    }
+                    item.signature.usePinned { memcpy(sigBuffer, it.addressOf(0), SIGNATURE_BYTES.toULong()) }
+                    item.publicKey.usePinned { memcpy(pkBuffer, it.addressOf(0), PUBLIC_KEY_BYTES.toULong()) }
+
+                    results[index] = item.data.asUByteArray().usePinned { dataPinned ->
+                        crypto_sign_verify_detached(
+                            sig = sigBuffer,
+                            m = if (item.data.isEmpty()) null else dataPinned.addressOf(0),
+                            mlen = item.data.size.toULong(),
+                            pk = pkBuffer
+                        ) == 0
+                    }
+                }
+            }
+        }
+    }
+
+    override suspend fun prepareSigner(privateKey: ByteArray): Ed25519SigningKey {
+        require(privateKey.size == SEED_BYTES) { "Private key must be $SEED_BYTES bytes" }
+        return NativeEd25519SigningKey(privateKey)
+    }
+}
+
+/**
+ * libsodium-backed [Ed25519SigningKey].
+ *
+ * The seed is expanded with `crypto_sign_seed_keypair` exactly once into a 64-byte secret key
+ * allocated with `sodium_malloc` (guard pages, canary, locked against swapping). The region is
+ * switched to read-only right after derivation, so concurrent [sign] calls only read from it.
+ * The secret key is wiped and released by [close], or by a cleaner once the key is garbage;
+ * a [close] racing [sign] defers the release until the signatures in flight are done.
+ */
+@OptIn(ExperimentalForeignApi::class, ExperimentalNativeApi::class)
+private class NativeEd25519SigningKey(seed: ByteArray) : Ed25519SigningKey {
+
+    private val secretKey = GuardedSecretKey()
+
+    @Suppress("unused")
+    private val cleaner: Cleaner = createCleaner(secretKey) { it.free() }
+
+    override val publicKey: ByteArray
+        get() = publicKeyBytes.copyOf()
+
+    private val publicKeyBytes: ByteArray
+
+    init {
+        val pk = UByteArray(PUBLIC_KEY_BYTES)
+        val result = seed.asUByteArray().usePinned { seedPinned ->
+            pk.usePinned { pkPinned ->
+                crypto_sign_seed_keypair(
+                    pk = pkPinned.addressOf(0),
+                    sk = secretKey.pointer,
+                    seed = seedPinned.addressOf(0)
+                )
+            }
+        }
+        if (result != 0) {
+            secretKey.free()
+            throw IllegalStateException("Failed to derive keypair from seed")
+        }
+        sodium_mprotect_readonly(secretKey.pointer)
+        publicKeyBytes = pk.asByteArray()
+    }
+
+    override suspend fun sign(data: ByteArray): ByteArray {
+        val signature = ByteArray(SIGNATURE_BYTES)
+        val result = secretKey.use { sk ->
+            signature.asUByteArray().usePinned { sigPinned ->
+                data.asUByteArray().usePinned { dataPinned ->
+                    crypto_sign_detached(
+                        sig = sigPinned.addressOf(0),
+                        siglen_p = null,
+                        m = if (data.isEmpty()) null else dataPinned.addressOf(0),
+                        mlen = data.size.toULong(),
+                        sk = sk
+                    )
+                }
+            }
+        }
+        if (result != 0) {
+            throw IllegalStateException("Failed to sign data")
+        }
+        return signature
+    }
+
+    override fun close() {
+        secretKey.free()
+    }
+
+    private companion object {
+        const val PUBLIC_KEY_BYTES = 32  // crypto_sign_PUBLICKEYBYTES
+        const val SECRET_KEY_BYTES = 64  // crypto_sign_SECRETKEYBYTES
+        const val SIGNATURE_BYTES = 64  // crypto_sign_BYTES
+    }
+
+    /**
+     * Owns the `sodium_malloc` region. Kept separate from the signing key so the cleaner
+     * does not capture the key itself, and so [free] is idempotent between [close] and the cleaner.
+     *
+     * [use] counts the signatures in flight; [free] marks the key closed and the region is
+     * released by whichever of [free] and the last [use] finishes later.
+     */
+    private class GuardedSecretKey {
+        val pointer: CPointer<UByteVar> = sodium_malloc(SECRET_KEY_BYTES.toULong())
+            ?.reinterpret()
+            ?: throw IllegalStateException("Failed to allocate guarded memory for signing key")
+
+        // Number of users in flight, with CLOSED set once freed
+        private val state = AtomicInt(0)
+
+        fun <T> use(block: (CPointer<UByteVar>) -> T): T {
+            while (true) {
+                val current = state.value
+                if (current and CLOSED != 0) throw IllegalStateException("Signing key has been closed")
+                if (state.compareAndSet(current, current + 1)) break
+            }
+            try {
+                return block(pointer)
+            } finally {
+                if (state.decrementAndGet() == CLOSED) release()
+            }
+        }
+
+        fun free() {
+            while (true) {
+                val current = state.value
+                if (current and CLOSED != 0) return
+                if (state.compareAndSet(current, current or CLOSED)) {
+                    if (current == 0) release()
+                    return
+                }
+            }
+        }
+
+        private fun release() {
+            // sodium_free restores write access and zeroes the region before unmapping it
+            sodium_free(pointer)
+        }
+
+        private companion object {
+            const val CLOSED = 1 shl 30
+        }
+    }
 }
 
 /**
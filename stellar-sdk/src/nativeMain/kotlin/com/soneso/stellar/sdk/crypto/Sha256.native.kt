@@ -49,6 +49,54 @@ internal class Sha256CryptoNative : Sha256Crypto {
             }
         }
     }
+
+    override suspend fun newHasher(): Sha256Hasher = LibsodiumSha256Hasher()
+}
+
+/**
+ * [Sha256Hasher] backed by libsodium's `crypto_hash_sha256_init/update/final`.
+ *
+ * `crypto_hash_sha256_state` is a plain struct without pointers, so it is kept in a Kotlin
+ * `LongArray` (8-byte aligned) and only pinned for the duration of each libsodium call.
+ * Nothing is allocated on the native heap and nothing needs to be freed.
+ */
+@OptIn(ExperimentalForeignApi::class, UnsafeNumber::class)
+private class LibsodiumSha256Hasher : Sha256Hasher {
+    private val state = LongArray(((crypto_hash_sha256_statebytes().toInt() + 7) / 8))
+
+    init {
+        state.usePinned { pinnedState ->
+            crypto_hash_sha256_init(pinnedState.addressOf(0).reinterpret())
+        }
+    }
+
+    override fun update(data: ByteArray, offset: Int, length: Int) {
+        require(offset >= 0 && length >= 0 && offset + length <= data.size) { "Invalid range" }
+        if (length == 0) return
+
+        state.usePinned { pinnedState ->
+            data.usePinned { pinnedData ->
+                crypto_hash_sha256_update(
+                    pinnedState.addressOf(0).reinterpret(),
+                    pinnedData.addressOf(offset).reinterpret(),
+                    length.toULong()
+                )
+            }
+        }
+    }
+
+    override fun digest(): ByteArray {
+        val output = UByteArray(32)
+        state.usePinned { pinnedState ->
+            output.usePinned { pinnedOutput ->
+                crypto_hash_sha256_final(
+                    pinnedState.addressOf(0).reinterpret(),
+                    pinnedOutput.addressOf(0)
+                )
+            }
+        }
+        return output.asByteArray()
+    }
 }
 
 actual fun getSha256Crypto(): Sha256Crypto = Sha256CryptoNative()
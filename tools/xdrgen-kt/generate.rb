@@ -53,7 +53,25 @@ Xdrgen::Compilation.new(
   output_dir: output_dir,
   generator: Xdrgen::Generators::Kotlin,
   namespace: 'com.soneso.stellar.sdk.xdr',
-  options: {}
+  options: {
+    # Types that also get a read-only *XdrView over their encoded bytes (see render_struct_view).
+    # Views are meant for ingestion code that reads a few fields out of large ledger metadata.
+    views: %w[
+      LedgerCloseMeta
+      LedgerCloseMetaV0
+      LedgerCloseMetaV1
+      LedgerCloseMetaV2
+      TransactionResultMeta
+      TransactionResultMetaV1
+      LedgerEntryChange
+    ],
+    # Types used as hash map keys in caches; their equals/hashCode cache the hash code
+    cached_hash: %w[
+      LedgerKey
+      SCAddress
+      SCVal
+    ]
+  }
 ).compile
 
 puts ""
@@ -43,10 +43,12 @@ module Xdrgen
         case defn
         when AST::Definitions::Struct
           render_struct(defn)
+          render_struct_view(defn) if view_type?(defn)
         when AST::Definitions::Enum
           render_enum(defn)
         when AST::Definitions::Union
           render_union(defn)
+          render_union_view(defn) if view_type?(defn)
         when AST::Definitions::Typedef
           render_typedef(defn)
         when AST::Definitions::Const
@@ -106,6 +108,13 @@ module Xdrgen
               end
             end
             out.puts "}"
+
+            out.puts
+            out.puts "fun skip(reader: XdrReader) {"
+            out.indent do
+              out.puts "reader.skip(4)"
+            end
+            out.puts "}"
           end
           out.puts "}"
 
@@ -115,6 +124,9 @@ module Xdrgen
             out.puts "writer.writeInt(value)"
           end
           out.puts "}"
+
+          out.puts
+          out.puts "fun encodedSize(): Int = 4"
         end
         out.puts "}"
 
@@ -144,6 +156,13 @@ module Xdrgen
               out.puts "return #{typedef_name}(value)"
             end
             out.puts "}"
+
+            out.puts
+            out.puts "fun skip(reader: XdrReader) {"
+            out.indent do
+              out.puts skip_statement(typedef.declaration, 'reader')
+            end
+            out.puts "}"
           end
           out.puts "}"
 
@@ -153,9 +172,32 @@ module Xdrgen
             encode_statement(typedef.declaration, 'value', 'writer', out)
           end
           out.puts "}"
+
+          out.puts
+          out.puts "fun encodedSize(): Int {"
+          out.indent do
+            out.puts "var size = 0"
+            size_statement(typedef.declaration, 'value', out)
+            out.puts "return size"
+          end
+          out.puts "}"
         end
         out.puts "}"
 
+        # Value classes cannot override equals, so == compares a wrapped ByteArray by identity.
+        # Opaque typedefs get content comparison helpers that generated equals methods call.
+        case content_kind(typedef.declaration)
+        when :bytes
+          out.puts
+          out.puts "/** Compares the wrapped bytes by content, unlike ==. */"
+          out.puts "fun #{typedef_name}?.contentEquals(other: #{typedef_name}?): Boolean = this?.value.contentEquals(other?.value)"
+          out.puts
+          out.puts "/** Hash code of the wrapped bytes, consistent with [contentEquals]. */"
+          out.puts "fun #{typedef_name}?.contentHashCode(): Int = this?.value.contentHashCode()"
+        when :bytes_list
+          raise "#{typedef_name}: content equality for typedefs of opaque arrays is not supported"
+        end
+
         out.close
       end
 
@@ -202,6 +244,16 @@ module Xdrgen
               out.puts "return #{struct_name}(#{param_list})"
             end
             out.puts "}"
+
+            # Advances past an encoded value without materializing it
+            out.puts
+            out.puts "fun skip(reader: XdrReader) {"
+            out.indent do
+              struct.members.each do |member|
+                out.puts skip_statement(member.declaration, 'reader')
+              end
+            end
+            out.puts "}"
           end
           out.puts "}"
 
@@ -215,6 +267,22 @@ module Xdrgen
             end
           end
           out.puts "}"
+
+          # Exact number of bytes encode() will write, without encoding
+          out.puts
+          out.puts "fun encodedSize(): Int {"
+          out.indent do
+            out.puts "var size = 0"
+            struct.members.each do |member|
+              member_name = escape_kotlin_keyword(member.name.underscore.camelize(:lower))
+              size_statement(member.declaration, member_name, out)
+            end
+            out.puts "return size"
+          end
+          out.puts "}"
+
+          members = struct.members.map { |m| [escape_kotlin_keyword(m.name.underscore.camelize(:lower)), m.declaration] }
+          render_content_equality(out, struct_name, members, cached_hash_type?(struct))
         end
         out.puts "}"
 
@@ -251,12 +319,41 @@ module Xdrgen
 
             if is_default
               # Default arm needs discriminant as constructor parameter
+              members = [['discriminant', nil], ['value', arm.declaration]]
+              cached = cached_hash_type?(union)
               out.puts "data class #{arm_class_name}("
               out.indent do
                 out.puts "override val discriminant: #{discriminant_type},"
                 out.puts "val value: #{arm_type}"
               end
-              out.puts ") : #{union_name}()"
+              if cached || content_kind(arm.declaration)
+                out.puts ") : #{union_name}() {"
+                out.indent do
+                  render_content_equality(out, arm_class_name, members, cached)
+                end
+                out.puts "}"
+              else
+                out.puts ") : #{union_name}()"
+              end
+            elsif arm.cases.length > 1
+              # Arm shared by several cases keeps the decoded discriminant, defaulting to the first case
+              members = [['value', arm.declaration], ['discriminant', nil]]
+              cached = cached_hash_type?(union)
+              discriminant_value = arm_discriminant_value(arm, union.discriminant)
+              out.puts "data class #{arm_class_name}("
+              out.indent do
+                out.puts "val value: #{arm_type},"
+                out.puts "override val discriminant: #{discriminant_type} = #{discriminant_value}"
+              end
+              if cached || content_kind(arm.declaration)
+                out.puts ") : #{union_name}() {"
+                out.indent do
+                  render_content_equality(out, arm_class_name, members, cached)
+                end
+                out.puts "}"
+              else
+                out.puts ") : #{union_name}()"
+              end
             else
               out.puts "data class #{arm_class_name}("
               out.indent do
@@ -267,6 +364,7 @@ module Xdrgen
                 # Discriminant value
                 discriminant_value = arm_discriminant_value(arm, union.discriminant)
                 out.puts "override val discriminant: #{discriminant_type} = #{discriminant_value}"
+                render_content_equality(out, arm_class_name, [['value', arm.declaration]], cached_hash_type?(union))
               end
               out.puts "}"
             end
@@ -359,7 +457,7 @@ module Xdrgen
                       out.puts "#{discriminant_value} -> {"
                       out.indent do
                         out.puts "val value = #{decode_expression(arm.declaration, 'reader')}"
-                        out.puts "#{arm_class_name}(value)"
+                        out.puts arm.cases.length > 1 ? "#{arm_class_name}(value, discriminant)" : "#{arm_class_name}(value)"
                       end
                       out.puts "}"
                     end
@@ -387,6 +485,35 @@ module Xdrgen
               out.puts "}"
             end
             out.puts "}"
+
+            # Advances past an encoded value without materializing it
+            out.puts
+            out.puts "fun skip(reader: XdrReader) {"
+            out.indent do
+              out.puts "val discriminant = #{decode_expression(union.discriminant, 'reader')}"
+              out.puts "when (discriminant) {"
+              out.indent do
+                union.normal_arms.each do |arm|
+                  arm.cases.each do |c|
+                    discriminant_value = format_discriminant_value(c, union)
+                    if arm.void?
+                      out.puts "#{discriminant_value} -> {}"
+                    else
+                      out.puts "#{discriminant_value} -> #{skip_statement(arm.declaration, 'reader')}"
+                    end
+                  end
+                end
+
+                if union.default_arm.present?
+                  arm = union.default_arm
+                  out.puts "else -> #{arm.void? ? '{}' : skip_statement(arm.declaration, 'reader')}"
+                else
+                  out.puts "else -> throw IllegalArgumentException(\"Unknown #{union_name} discriminant: \$discriminant\")"
+                end
+              end
+              out.puts "}"
+            end
+            out.puts "}"
           end
           out.puts "}"
 
@@ -415,12 +542,352 @@ module Xdrgen
             out.puts "}"
           end
           out.puts "}"
+
+          # Exact number of bytes encode() will write, without encoding
+          out.puts
+          out.puts "fun encodedSize(): Int {"
+          out.indent do
+            out.puts "var size = 0"
+            size_statement(union.discriminant, 'discriminant', out)
+            out.puts "when (this) {"
+            out.indent do
+              arms_by_class = union.arms.group_by { |arm| arm.name.camelize }
+              arms_by_class.each do |class_name, _|
+                arm = union.arms.find { |a| a.name.camelize == class_name }
+                if arm.void?
+                  out.puts "is #{class_name} -> {}"
+                else
+                  out.puts "is #{class_name} -> {"
+                  out.indent do
+                    size_statement(arm.declaration, 'value', out)
+                  end
+                  out.puts "}"
+                end
+              end
+            end
+            out.puts "}"
+            out.puts "return size"
+          end
+          out.puts "}"
         end
         out.puts "}"
 
         out.close
       end
 
+      # :bytes for opaque data, including typedefs of it, whose ByteArray == compares by
+      # identity; :bytes_list for arrays of opaque typedefs; nil when == compares content
+      def content_kind(decl)
+        return nil if decl.is_a?(AST::Declarations::Void)
+        return :bytes if kotlin_type_for(decl) == 'ByteArray'
+        return nil unless opaque_typedef?(decl.type)
+
+        decl.is_a?(AST::Declarations::Array) ? :bytes_list : :bytes
+      end
+
+      def opaque_typedef?(typespec)
+        return false unless typespec.is_a?(AST::Typespecs::Simple)
+
+        defn = typespec.resolved_type
+        defn.is_a?(AST::Definitions::Typedef) && content_kind(defn.declaration) == :bytes
+      end
+
+      # Types listed in the :cached_hash option keep their hash code once computed
+      def cached_hash_type?(defn)
+        Array(@options[:cached_hash]).include?(defn.name)
+      end
+
+      def content_equals_expression(decl, member_name)
+        # A member called other would be shadowed by the equals parameter
+        own = member_name == 'other' ? 'this.other' : member_name
+        case decl && content_kind(decl)
+        when :bytes
+          "#{own}.contentEquals(other.#{member_name})"
+        when :bytes_list
+          "#{own}.size == other.#{member_name}.size && " \
+            "#{own}.indices.all { #{own}[it].contentEquals(other.#{member_name}[it]) }"
+        else
+          "#{own} == other.#{member_name}"
+        end
+      end
+
+      def content_hash_expression(decl, member_name)
+        # A member called result would be shadowed by the local accumulating the hash
+        own = member_name == 'result' ? 'this.result' : member_name
+        case decl && content_kind(decl)
+        when :bytes
+          "#{own}.contentHashCode()"
+        when :bytes_list
+          "#{own}.fold(1) { hash, item -> 31 * hash + item.contentHashCode() }"
+        else
+          "#{own}.hashCode()"
+        end
+      end
+
+      # Data classes compare ByteArray members by identity, so classes holding opaque data get
+      # equals/hashCode over the bytes' content. members holds [name, declaration] pairs; a nil
+      # declaration is compared with ==. Cached types also short-circuit equals on the hash.
+      def render_content_equality(out, class_name, members, cached)
+        return unless cached || members.any? { |_, decl| decl && content_kind(decl) }
+
+        out.puts
+        if cached
+          out.puts "private var cachedHashCode = 0"
+          out.puts
+        end
+
+        out.puts "override fun equals(other: Any?): Boolean {"
+        out.indent do
+          out.puts "if (this === other) return true"
+          guard = "other !is #{class_name}"
+          guard += " || hashCode() != other.hashCode()" if cached
+          out.puts "if (#{guard}) return false"
+          conditions = members.map { |member_name, decl| content_equals_expression(decl, member_name) }
+          out.puts "return #{conditions.first}#{conditions.length > 1 ? ' &&' : ''}"
+          out.indent do
+            conditions.drop(1).each_with_index do |condition, idx|
+              out.puts "#{condition}#{idx < conditions.length - 2 ? ' &&' : ''}"
+            end
+          end
+        end
+        out.puts "}"
+
+        out.puts
+        hashes = members.map { |member_name, decl| content_hash_expression(decl, member_name) }
+        if hashes.length == 1 && !cached
+          out.puts "override fun hashCode(): Int = #{hashes.first}"
+          return
+        end
+
+        out.puts "override fun hashCode(): Int {"
+        out.indent do
+          if cached && hashes.length == 1
+            out.puts "if (cachedHashCode == 0) cachedHashCode = #{hashes.first}"
+            out.puts "return cachedHashCode"
+          elsif cached
+            out.puts "if (cachedHashCode == 0) {"
+            out.indent do
+              out.puts "var result = #{hashes.first}"
+              hashes.drop(1).each { |hash| out.puts "result = 31 * result + #{hash}" }
+              out.puts "cachedHashCode = result"
+            end
+            out.puts "}"
+            out.puts "return cachedHashCode"
+          else
+            out.puts "var result = #{hashes.first}"
+            hashes.drop(1).each { |hash| out.puts "result = 31 * result + #{hash}" }
+            out.puts "return result"
+          end
+        end
+        out.puts "}"
+      end
+
+      # Structs and unions listed in the :views option additionally get a flyweight view class
+      def view_type?(defn)
+        (defn.is_a?(AST::Definitions::Struct) || defn.is_a?(AST::Definitions::Union)) &&
+          Array(@options[:views]).include?(defn.name)
+      end
+
+      def render_view_header(out, type_name)
+        render_file_header(out)
+        out.puts "/**"
+        out.puts " * Read-only view of a [#{type_name}] encoded in [buffer] at [offset]."
+        out.puts " *"
+        out.puts " * Members are decoded from the buffer each time they are accessed, and members of"
+        out.puts " * view types are returned as views themselves, so an untouched view allocates nothing."
+        out.puts " * A list of views is kept once created, since it finds its element offsets only once."
+        out.puts " * Views are not thread-safe; the buffer must not be modified while they are in use."
+        out.puts " */"
+      end
+
+      def render_struct_view(struct)
+        struct_name = name(struct)
+        view_name = "#{struct_name}View"
+        out = @output.open("#{view_name}.kt")
+        member_count = struct.members.length
+
+        render_view_header(out, struct_name)
+        out.puts "class #{view_name}(val buffer: ByteArray, val offset: Int) {"
+        out.indent do
+          out.puts "private var memberOffsets: IntArray? = null"
+          out.puts "private var knownOffsets = 1"
+
+          struct.members.each_with_index do |member, idx|
+            member_name = escape_kotlin_keyword(member.name.underscore.camelize(:lower))
+            member_type = view_member_type(member.declaration)
+            expression = view_member_expression(member.declaration, "memberOffset(#{idx})")
+            out.puts
+            if view_member_kind(member.declaration) == :view_list
+              # A list finds its element offsets once, so it is kept for index loops over it
+              cache = "#{member.name.underscore.camelize(:lower)}List"
+              out.puts "private var #{cache}: #{member_type}? = null"
+              out.puts
+              out.puts "val #{member_name}: #{member_type}"
+              out.indent do
+                out.puts "get() = #{cache} ?: #{expression}.also { #{cache} = it }"
+              end
+            else
+              out.puts "val #{member_name}: #{member_type}"
+              out.indent do
+                out.puts "get() = #{expression}"
+              end
+            end
+          end
+
+          out.puts
+          out.puts "/** Offset of the first byte after the encoded value. */"
+          out.puts "val endOffset: Int"
+          out.indent do
+            out.puts "get() = memberOffset(#{member_count})"
+          end
+
+          out.puts
+          out.puts "/** Decodes the complete value. */"
+          out.puts "fun decode(): #{struct_name} = decodeXdrAt(buffer, offset) { reader -> #{struct_name}.decode(reader) }"
+
+          # Member offsets are found once by skipping over the members in front of them, and
+          # only up to the requested member, so reading an early member skips nothing after it
+          out.puts
+          out.puts "private fun memberOffset(index: Int): Int {"
+          out.indent do
+            out.puts "if (index == 0) return offset"
+            out.puts "val offsets = memberOffsets ?: IntArray(#{member_count + 1}).also { it[0] = offset; memberOffsets = it }"
+            out.puts "if (index < knownOffsets) return offsets[index]"
+            out.puts "val reader = xdrReaderAt(buffer, offsets[knownOffsets - 1])"
+            out.puts "while (knownOffsets <= index) {"
+            out.indent do
+              out.puts "when (knownOffsets - 1) {"
+              out.indent do
+                struct.members.each_with_index do |member, idx|
+                  out.puts "#{idx} -> #{skip_statement(member.declaration, 'reader')}"
+                end
+              end
+              out.puts "}"
+              out.puts "offsets[knownOffsets++] = reader.position"
+            end
+            out.puts "}"
+            out.puts "return offsets[index]"
+          end
+          out.puts "}"
+        end
+        out.puts "}"
+
+        out.close
+      end
+
+      def render_union_view(union)
+        union_name = name(union)
+        view_name = "#{union_name}View"
+        out = @output.open("#{view_name}.kt")
+        discriminant_type = kotlin_type_for(union.discriminant)
+
+        render_view_header(out, union_name)
+        out.puts "class #{view_name}(val buffer: ByteArray, val offset: Int) {"
+        out.indent do
+          out.puts "val discriminant: #{discriminant_type}"
+          out.indent do
+            out.puts "get() = decodeXdrAt(buffer, offset) { reader -> #{decode_expression(union.discriminant, 'reader')} }"
+          end
+
+          # Discriminants are always 4 bytes, so every arm starts at offset + 4
+          union.normal_arms.reject(&:void?).each do |arm|
+            arm_name = escape_kotlin_keyword(arm.name.underscore.camelize(:lower))
+            arm_type = view_member_type(arm.declaration)
+            cases = arm.cases.map { |c| format_discriminant_value(c, union) }.join(', ')
+            out.puts
+            out.puts "/** The #{arm_name} arm, or null if [discriminant] selects another arm. */"
+            out.puts "val #{arm_name}: #{arm_type.end_with?('?') ? arm_type : "#{arm_type}?"}"
+            out.indent do
+              out.puts "get() = when (discriminant) {"
+              out.indent do
+                out.puts "#{cases} -> #{view_member_expression(arm.declaration, 'offset + 4')}"
+                out.puts "else -> null"
+              end
+              out.puts "}"
+            end
+          end
+
+          if union.default_arm.present? && !union.default_arm.void?
+            arm = union.default_arm
+            arm_name = escape_kotlin_keyword(arm.name.underscore.camelize(:lower))
+            arm_type = view_member_type(arm.declaration)
+            cases = union.normal_arms.flat_map { |a| a.cases.map { |c| format_discriminant_value(c, union) } }
+            out.puts
+            out.puts "/** The #{arm_name} arm, or null if [discriminant] selects another arm. */"
+            out.puts "val #{arm_name}: #{arm_type.end_with?('?') ? arm_type : "#{arm_type}?"}"
+            out.indent do
+              out.puts "get() = when (discriminant) {"
+              out.indent do
+                out.puts "#{cases.join(', ')} -> null" unless cases.empty?
+                out.puts "else -> #{view_member_expression(arm.declaration, 'offset + 4')}"
+              end
+              out.puts "}"
+            end
+          end
+
+          out.puts
+          out.puts "/** Offset of the first byte after the encoded value. */"
+          out.puts "val endOffset: Int"
+          out.indent do
+            out.puts "get() = xdrReaderAt(buffer, offset).also { reader -> #{union_name}.skip(reader) }.position"
+          end
+
+          out.puts
+          out.puts "/** Decodes the complete value. */"
+          out.puts "fun decode(): #{union_name} = decodeXdrAt(buffer, offset) { reader -> #{union_name}.decode(reader) }"
+        end
+        out.puts "}"
+
+        out.close
+      end
+
+      # How a member is exposed by a view: :view, :optional_view or :view_list when its
+      # (typedef-resolved) type has a view itself, nil when it is decoded on access
+      def view_member_kind(decl)
+        resolved = resolve_typedef_declaration(decl)
+        return nil if resolved.is_a?(AST::Declarations::Void)
+        return nil unless resolved.type.is_a?(AST::Typespecs::Simple)
+        return nil unless view_type?(resolved.type.resolved_type)
+
+        case resolved
+        when AST::Declarations::Optional
+          :optional_view
+        when AST::Declarations::Array
+          resolved.fixed? ? nil : :view_list
+        else
+          :view
+        end
+      end
+
+      def view_member_type(decl)
+        kind = view_member_kind(decl)
+        return kotlin_type_for(decl) unless kind
+
+        element_view = "#{name(resolve_typedef_declaration(decl).type.resolved_type)}View"
+        case kind
+        when :view then element_view
+        when :optional_view then "#{element_view}?"
+        else "XdrViewList<#{element_view}>"
+        end
+      end
+
+      def view_member_expression(decl, offset_expr)
+        kind = view_member_kind(decl)
+        unless kind
+          return "decodeXdrAt(buffer, #{offset_expr}) { reader -> #{decode_expression(decl, 'reader')} }"
+        end
+
+        element_name = name(resolve_typedef_declaration(decl).type.resolved_type)
+        case kind
+        when :view
+          "#{element_name}View(buffer, #{offset_expr})"
+        when :optional_view
+          "(#{offset_expr}).let { at -> if (decodeXdrAt(buffer, at) { reader -> reader.readBoolean() }) #{element_name}View(buffer, at + 4) else null }"
+        else
+          "XdrViewList(buffer, #{offset_expr}, { reader -> #{element_name}.skip(reader) }, ::#{element_name}View)"
+        end
+      end
+
       # Helper method to format a discriminant value for use in when expressions
       def format_discriminant_value(case_stmt, union)
         if case_stmt.value.is_a?(AST::Identifier)
@@ -470,6 +937,84 @@ module Xdrgen
           fun Double.encode(writer: XdrWriter) = writer.writeDouble(this)
           fun Boolean.encode(writer: XdrWriter) = writer.writeBoolean(this)
           fun String.encode(writer: XdrWriter) = writer.writeString(this)
+
+          // Encoded sizes of primitive types, mirroring the encode functions above
+          fun Int.encodedSize(): Int = 4
+          fun UInt.encodedSize(): Int = 4
+          fun Long.encodedSize(): Int = 8
+          fun ULong.encodedSize(): Int = 8
+          fun Float.encodedSize(): Int = 4
+          fun Double.encodedSize(): Int = 8
+          fun Boolean.encodedSize(): Int = 4
+          fun String.encodedSize(): Int = xdrStringSize(this)
+
+          /** Rounds [length] up to the next multiple of four, the XDR padding unit. */
+          internal fun xdrPaddedSize(length: Int): Int = (length + 3) and 3.inv()
+
+          /** Encoded size of a variable-length opaque: length prefix plus padded bytes. */
+          internal fun xdrVariableOpaqueSize(value: ByteArray): Int = 4 + xdrPaddedSize(value.size)
+
+          /** Encoded size of an XDR string, counting its UTF-8 bytes (see [xdrEncodeUtf8]) without encoding it. */
+          internal fun xdrStringSize(value: String): Int = 4 + xdrPaddedSize(utf8Length(value))
+
+          private fun utf8Length(value: String): Int {
+            var length = 0
+            var i = 0
+            while (i < value.length) {
+              val c = value[i]
+              length += when {
+                c.code < 0x80 -> 1
+                c.code < 0x800 -> 2
+                c.isHighSurrogate() && i + 1 < value.length && value[i + 1].isLowSurrogate() -> {
+                  i++
+                  4
+                }
+                else -> 3
+              }
+              i++
+            }
+            return length
+          }
+
+          /**
+           * Encodes [value] as UTF-8, replacing unpaired surrogates with U+FFFD on every platform.
+           * The result is always [utf8Length] bytes; `encodeToByteArray()` writes `?` for them on the JVM.
+           */
+          internal fun xdrEncodeUtf8(value: String): ByteArray {
+            val bytes = ByteArray(utf8Length(value))
+            var position = 0
+            var i = 0
+            while (i < value.length) {
+              val c = value[i]
+              var code = c.code
+              if (c.isHighSurrogate() && i + 1 < value.length && value[i + 1].isLowSurrogate()) {
+                i++
+                code = 0x10000 + ((code - 0xD800) shl 10) + (value[i].code - 0xDC00)
+              } else if (c.isSurrogate()) {
+                code = 0xFFFD
+              }
+              when {
+                code < 0x80 -> bytes[position++] = code.toByte()
+                code < 0x800 -> {
+                  bytes[position++] = (0xC0 or (code shr 6)).toByte()
+                  bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+                }
+                code < 0x10000 -> {
+                  bytes[position++] = (0xE0 or (code shr 12)).toByte()
+                  bytes[position++] = (0x80 or ((code shr 6) and 0x3F)).toByte()
+                  bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+                }
+                else -> {
+                  bytes[position++] = (0xF0 or (code shr 18)).toByte()
+                  bytes[position++] = (0x80 or ((code shr 12) and 0x3F)).toByte()
+                  bytes[position++] = (0x80 or ((code shr 6) and 0x3F)).toByte()
+                  bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+                }
+              }
+              i++
+            }
+            return bytes
+          }
         KOTLIN
 
         out.close
@@ -829,6 +1374,49 @@ module Xdrgen
         end
       end
 
+      # Statement that advances reader_var past decl without allocating
+      def skip_statement(decl, reader_var)
+        case decl
+        when AST::Declarations::Optional
+          "if (#{reader_var}.readBoolean()) #{skip_statement_for_typespec(decl.type, reader_var)}"
+        when AST::Declarations::Array
+          if kotlin_type_for_typespec(decl.type) == 'Byte'
+            if decl.fixed?
+              _, size = decl.type.array_size
+              "#{reader_var}.skipFixedOpaque(#{size})"
+            else
+              "#{reader_var}.skipVariableOpaque()"
+            end
+          else
+            count = decl.fixed? ? decl.type.array_size.last : "#{reader_var}.readInt()"
+            "repeat(#{count}) { #{skip_statement_for_typespec(decl.type, reader_var)} }"
+          end
+        else
+          skip_statement_for_typespec(decl.type, reader_var)
+        end
+      end
+
+      def skip_statement_for_typespec(typespec, reader_var)
+        case typespec
+        when AST::Typespecs::Int, AST::Typespecs::UnsignedInt, AST::Typespecs::Float, AST::Typespecs::Bool
+          "#{reader_var}.skip(4)"
+        when AST::Typespecs::Hyper, AST::Typespecs::UnsignedHyper, AST::Typespecs::Double
+          "#{reader_var}.skip(8)"
+        when AST::Typespecs::String
+          "#{reader_var}.skipVariableOpaque()"
+        when AST::Typespecs::Opaque
+          if typespec.fixed?
+            "#{reader_var}.skipFixedOpaque(#{typespec.size})"
+          else
+            "#{reader_var}.skipVariableOpaque()"
+          end
+        when AST::Typespecs::Simple
+          "#{name(typespec.resolved_type)}.skip(#{reader_var})"
+        else
+          "#{name(typespec)}.skip(#{reader_var})"
+        end
+      end
+
       def decode_expression_for_typespec(typespec, reader_var)
         case typespec
         when AST::Typespecs::Int
@@ -937,6 +1525,70 @@ module Xdrgen
         end
       end
 
+      # Mirrors encode_statement, accumulating into a local `size` instead of writing
+      def size_statement(decl, value_expr, out)
+        case decl
+        when AST::Declarations::Void
+          # Nothing to encode
+        when AST::Declarations::Optional
+          out.puts "if (#{value_expr} != null) {"
+          out.indent do
+            out.puts "size += 4"
+            size_statement_for_typespec(decl.type, value_expr, out)
+          end
+          out.puts "} else {"
+          out.indent do
+            out.puts "size += 4"
+          end
+          out.puts "}"
+        when AST::Declarations::Array
+          if decl.fixed?
+            if kotlin_type_for_typespec(decl.type) == 'Byte'
+              _, size = decl.type.array_size
+              out.puts "size += xdrPaddedSize(#{size})"
+            else
+              out.puts "#{value_expr}.forEach { item ->"
+              out.indent do
+                size_statement_for_typespec(decl.type, 'item', out)
+              end
+              out.puts "}"
+            end
+          else
+            if kotlin_type_for_typespec(decl.type) == 'Byte'
+              out.puts "size += xdrVariableOpaqueSize(#{value_expr})"
+            else
+              out.puts "size += 4"
+              out.puts "#{value_expr}.forEach { item ->"
+              out.indent do
+                size_statement_for_typespec(decl.type, 'item', out)
+              end
+              out.puts "}"
+            end
+          end
+        else
+          size_statement_for_typespec(decl.type, value_expr, out)
+        end
+      end
+
+      def size_statement_for_typespec(typespec, value_expr, out)
+        case typespec
+        when AST::Typespecs::Int, AST::Typespecs::UnsignedInt, AST::Typespecs::Float, AST::Typespecs::Bool
+          out.puts "size += 4"
+        when AST::Typespecs::Hyper, AST::Typespecs::UnsignedHyper, AST::Typespecs::Double
+          out.puts "size += 8"
+        when AST::Typespecs::String
+          out.puts "size += xdrStringSize(#{value_expr})"
+        when AST::Typespecs::Opaque
+          if typespec.fixed?
+            out.puts "size += xdrPaddedSize(#{typespec.size})"
+          else
+            out.puts "size += xdrVariableOpaqueSize(#{value_expr})"
+          end
+        else
+          out.puts "size += #{value_expr}.encodedSize()"
+        end
+      end
+
       def arm_discriminant_value(arm, discriminant)
         # Handle default arm separately
         return 'else' if arm.is_a?(AST::Definitions::UnionDefaultArm)